@@ -0,0 +1,253 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_BROADCAST_EVENT_H
+#define NSF_BROADCAST_EVENT_H
+
+#include "NSFEvent.h"
+#include "NSFEventHandler.h"
+#include "NSFEventPool.h"
+#include "NSFOSThread.h"
+
+#include <list>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents an immutable data payload shared by the copies of a broadcast event.
+    /// </summary>
+    /// <remarks>
+    /// The payload is deleted when the last event referring to it is deleted.
+    /// </remarks>
+    template<class DataType>
+    class NSFSharedPayload
+    {
+    public:
+
+        /// <summary>
+        /// Creates a shared payload with a single reference.
+        /// </summary>
+        /// <param name="data">The data of the payload.</param>
+        NSFSharedPayload(const DataType& data)
+            : data(data), referenceCount(1)
+        {
+        }
+
+        /// <summary>
+        /// Gets the data of the payload.
+        /// </summary>
+        const DataType& getData() const { return data; }
+
+        /// <summary>
+        /// Gets the number of references to the payload.
+        /// </summary>
+        UInt32 getReferenceCount() const { return referenceCount; }
+
+        /// <summary>
+        /// Adds a reference to the payload.
+        /// </summary>
+        void addReference() { NSFOSThread::atomicIncrement(referenceCount); }
+
+        /// <summary>
+        /// Removes a reference to the payload, deleting the payload if it was the last reference.
+        /// </summary>
+        void release()
+        {
+            if (NSFOSThread::atomicDecrement(referenceCount) == 0)
+            {
+                delete this;
+            }
+        }
+
+    private:
+
+        const DataType data;
+        volatile UInt32 referenceCount;
+
+        /// <summary>
+        /// Destroys a shared payload.
+        /// </summary>
+        /// <remarks>
+        /// A payload is only deleted by releasing its last reference.
+        /// </remarks>
+        ~NSFSharedPayload() {}
+
+        // Payloads are shared, never copied
+        NSFSharedPayload(const NSFSharedPayload<DataType>&);
+        NSFSharedPayload<DataType>& operator=(const NSFSharedPayload<DataType>&);
+    };
+
+    /// <summary>
+    /// Represents an event that delivers one immutable data payload to many event handlers.
+    /// </summary>
+    /// <remarks>
+    /// Broadcasting creates a single shared payload, and queues a light-weight copy of the event to each destination.
+    /// The copies refer to the shared payload rather than copying it, and the payload is deleted when the last copy has been handled.
+    /// Copies have the same id as the broadcast event, so they trigger the same transitions and event reactions.
+    /// The memory for copies is pooled by NSFEventPool, so that broadcasting repeatedly does not allocate memory for each destination.
+    /// The payload must not be modified by handlers, as it is shared across threads without locking.
+    /// </remarks>
+    template<class DataType>
+    class NSFBroadcastEvent : public NSFEvent
+    {
+    public:
+
+        /// <summary>
+        /// Creates a broadcast event.
+        /// </summary>
+        /// <param name="name">The name of the event.</param>
+        /// <param name="parent">The parent of the event.</param>
+        /// <remarks>
+        /// The event source and destination will be set to the parent.
+        /// </remarks>
+        NSFBroadcastEvent(const NSFString& name, INSFEventHandler* parent)
+            : NSFEvent(name, parent), payload(NULL)
+        {
+        }
+
+        /// <summary>
+        /// Creates a broadcast event.
+        /// </summary>
+        /// <param name="name">The name of the event.</param>
+        /// <param name="source">The source of the event.</param>
+        /// <param name="destination">The destination of the event.</param>
+        NSFBroadcastEvent(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination)
+            : NSFEvent(name, source, destination), payload(NULL)
+        {
+        }
+
+        /// <summary>
+        /// Creates a broadcast event that shares the payload of another.
+        /// </summary>
+        /// <param name="nsfEvent">The event to copy.</param>
+        NSFBroadcastEvent(const NSFBroadcastEvent<DataType>& nsfEvent)
+            : NSFEvent(nsfEvent), payload(nsfEvent.payload)
+        {
+            if (payload != NULL)
+            {
+                payload->addReference();
+            }
+        }
+
+        /// <summary>
+        /// Destroys a broadcast event, releasing its reference to the shared payload.
+        /// </summary>
+        virtual ~NSFBroadcastEvent()
+        {
+            if (payload != NULL)
+            {
+                payload->release();
+            }
+        }
+
+        /// <summary>
+        /// Gets the data payload.
+        /// </summary>
+        /// <returns>The data payload.</returns>
+        /// <remarks>
+        /// An exception is thrown if the event has no payload, which is the case for an event that has not been broadcast.
+        /// </remarks>
+        const DataType& getData() const
+        {
+            if (payload == NULL)
+            {
+                throw std::runtime_error(getName() + " broadcast event has no payload");
+            }
+
+            return payload->getData();
+        }
+
+        /// <summary>
+        /// Indicates if the event has a data payload.
+        /// </summary>
+        bool hasData() const { return (payload != NULL); }
+
+        /// <summary>
+        /// Gets the shared payload, or NULL if the event has no payload.
+        /// </summary>
+        const NSFSharedPayload<DataType>* getPayload() const { return payload; }
+
+        /// <summary>
+        /// Queues a copy of the event, sharing a single copy of the data, to each of the specified destinations.
+        /// </summary>
+        /// <param name="data">The data to broadcast.</param>
+        /// <param name="destinations">The event handlers to queue the event to.</param>
+        /// <remarks>
+        /// The data is copied once, into the shared payload.
+        /// Each destination's copy is deleted after it is handled, and the payload is deleted after the last copy.
+        /// The destinations may be on different event threads.
+        /// </remarks>
+        void broadcast(const DataType& data, const std::list<INSFEventHandler*>& destinations)
+        {
+            NSFSharedPayload<DataType>* sharedPayload = new NSFSharedPayload<DataType>(data);
+
+            std::list<INSFEventHandler*>::const_iterator destinationIterator;
+            for (destinationIterator = destinations.begin(); destinationIterator != destinations.end(); ++destinationIterator)
+            {
+                NSFBroadcastEvent<DataType>* eventCopy = new NSFBroadcastEvent<DataType>(*this, sharedPayload);
+                eventCopy->setDeleteAfterHandling(true);
+                (*destinationIterator)->queueEvent(eventCopy);
+            }
+
+            // Release the broadcaster's reference, so that the last copy handled deletes the payload
+            sharedPayload->release();
+        }
+
+        /// <summary>
+        /// Creates a copy of the event that shares its payload.
+        /// </summary>
+        /// <param name="deleteAfterHandling">Flag indicating if the event should be deleted after handled by an event handler.</param>
+        /// <returns>A copy of the event.</returns>
+        virtual NSFEvent* copy(bool deleteAfterHandling)
+        {
+            NSFEvent* eventCopy = new NSFBroadcastEvent<DataType>(*this);
+            eventCopy->setDeleteAfterHandling(deleteAfterHandling);
+            return eventCopy;
+        }
+
+        /// <summary>
+        /// Allocates memory for a broadcast event from the event pool.
+        /// </summary>
+        static void* operator new(size_t size) { return NSFEventPool<NSFBroadcastEvent<DataType> >::allocate(size); }
+
+        /// <summary>
+        /// Returns the memory of a broadcast event to the event pool.
+        /// </summary>
+        static void operator delete(void* memory, size_t size) { NSFEventPool<NSFBroadcastEvent<DataType> >::release(memory, size); }
+
+    private:
+
+        NSFSharedPayload<DataType>* payload;
+
+        /// <summary>
+        /// Creates a copy of a broadcast event that refers to the specified payload.
+        /// </summary>
+        NSFBroadcastEvent(const NSFBroadcastEvent<DataType>& nsfEvent, NSFSharedPayload<DataType>* payload)
+            : NSFEvent(nsfEvent), payload(payload)
+        {
+            payload->addReference();
+        }
+    };
+}
+
+#endif // NSF_BROADCAST_EVENT_H
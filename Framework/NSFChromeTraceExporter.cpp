@@ -0,0 +1,434 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFChromeTraceExporter.h"
+
+#include "NSFTraceLog.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <stdio.h>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFChromeTraceExporter::NSFChromeTraceExporter()
+        : queueWaitEnabled(true), traceCount(0), lastTime(0), nextFlowId(1)
+    {
+        events = ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"North State Framework\"}}";
+    }
+
+    bool NSFChromeTraceExporter::addTraceFile(const NSFString& fileName)
+    {
+        NSFXMLDocument traceLog;
+
+        if (!traceLog.loadFile(fileName))
+        {
+            return false;
+        }
+
+        addTraceLog(traceLog);
+        return true;
+    }
+
+    void NSFChromeTraceExporter::addTraceLog(NSFXMLDocument& traceLog)
+    {
+        if (!traceLog.jumpToRootElement() || !traceLog.jumpToChildElementFront())
+        {
+            return;
+        }
+
+        do
+        {
+            NSFString timeText;
+            NSFString type;
+            TagList tags;
+
+            // Each trace holds its time, followed by an element named for its type, which holds the trace's tags
+            if (traceLog.getChildElementText(TimeTag(), timeText) && traceLog.jumpToChildElementFront())
+            {
+                if (traceLog.jumpToNextElement())
+                {
+                    traceLog.getCurrentElementTag(type);
+
+                    if (traceLog.jumpToChildElementFront())
+                    {
+                        do
+                        {
+                            NSFString tag;
+                            NSFString data;
+                            traceLog.getCurrentElementTag(tag);
+                            traceLog.getCurrentElementText(data);
+                            tags.push_back(std::make_pair(tag, data));
+                        }
+                        while (traceLog.jumpToNextElement());
+
+                        traceLog.jumpToParentElement();
+                    }
+                }
+
+                traceLog.jumpToParentElement();
+            }
+
+            if (!type.empty())
+            {
+                NSFTime time = 0;
+                std::istringstream timeStream(timeText);
+                timeStream >> time;
+
+                convertTrace(toMicroSeconds(time), type, tags);
+            }
+        }
+        while (traceLog.jumpToNextElement());
+    }
+
+    void NSFChromeTraceExporter::save(const NSFString& fileName)
+    {
+        // Events that complete the timeline are added to a copy, so that more traces can still be added after saving
+        NSFString endEvents;
+
+        std::map<UInt32, StateSlice>::iterator sliceIterator;
+        for (sliceIterator = stateSlices.begin(); sliceIterator != stateSlices.end(); ++sliceIterator)
+        {
+            TagList args(1, std::make_pair(NSFString("states"), sliceIterator->second.states));
+            addCompleteEvent(endEvents, sliceIterator->second.name, StateCategory(), sliceIterator->first, sliceIterator->second.startTime, lastTime, args);
+        }
+
+        // Events that were never handled, or whose handling precedes the traces, end at their destination when queued
+        std::map<NSFString, std::list<QueuedEvent> >::iterator queueIterator;
+        for (queueIterator = queuedEvents.begin(); queueIterator != queuedEvents.end(); ++queueIterator)
+        {
+            std::list<QueuedEvent>::iterator eventIterator;
+            for (eventIterator = queueIterator->second.begin(); eventIterator != queueIterator->second.end(); ++eventIterator)
+            {
+                endFlow(endEvents, *eventIterator, eventIterator->queuedTime);
+            }
+        }
+
+        std::ofstream file;
+        file.open(fileName.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+        if (file.fail())
+        {
+            throw std::runtime_error("Unable to open file: " + fileName);
+        }
+
+        // Each event is preceded by a separator, which is skipped for the first event
+        file << "{\"traceEvents\":[\n";
+        file.write(events.data() + 2, events.size() - 2);
+        file.write(endEvents.data(), endEvents.size());
+        file << "\n],\n\"displayTimeUnit\":\"ms\"}\n";
+        file.close();
+    }
+
+    // Private
+
+    void NSFChromeTraceExporter::addCompleteEvent(NSFString& text, const NSFString& name, const NSFString& category, UInt32 trackId, NSFTime startTime, NSFTime endTime, const TagList& args)
+    {
+        addEventStart(text, name, category, "X", trackId);
+        text += ",\"dur\":" + toString(endTime - startTime);
+        addEventEnd(text, startTime, args);
+    }
+
+    void NSFChromeTraceExporter::addEventEnd(NSFString& text, NSFTime time, const TagList& args)
+    {
+        text += ",\"ts\":" + toString(time);
+
+        if (!args.empty())
+        {
+            text += ",\"args\":{";
+
+            for (TagList::size_type i = 0; i < args.size(); ++i)
+            {
+                if (i != 0)
+                {
+                    text += ",";
+                }
+
+                appendJsonString(text, args[i].first);
+                text += ":";
+                appendJsonString(text, args[i].second);
+            }
+
+            text += "}";
+        }
+
+        text += "}";
+    }
+
+    void NSFChromeTraceExporter::addEventStart(NSFString& text, const NSFString& name, const NSFString& category, const NSFString& phase, UInt32 trackId)
+    {
+        text += ",\n{\"name\":";
+        appendJsonString(text, name);
+        text += ",\"cat\":";
+        appendJsonString(text, category);
+        text += ",\"ph\":\"" + phase + "\",\"pid\":1,\"tid\":" + toString(trackId);
+    }
+
+    void NSFChromeTraceExporter::addFlowEvent(NSFString& text, const NSFString& name, bool isStart, UInt32 flowId, UInt32 trackId, NSFTime time)
+    {
+        addEventStart(text, name, EventCategory(), isStart ? "s" : "f", trackId);
+
+        // The end of the flow binds to the slice enclosing it, rather than the next slice to start
+        if (!isStart)
+        {
+            text += ",\"bp\":\"e\"";
+        }
+
+        text += ",\"id\":" + toString(flowId);
+        addEventEnd(text, time, TagList());
+    }
+
+    void NSFChromeTraceExporter::addInstantEvent(const NSFString& name, const NSFString& category, UInt32 trackId, NSFTime time, const TagList& args)
+    {
+        addEventStart(events, name, category, "i", trackId);
+        events += ",\"s\":\"t\"";
+        addEventEnd(events, time, args);
+    }
+
+    void NSFChromeTraceExporter::appendJsonString(NSFString& text, const NSFString& value)
+    {
+        text += '"';
+
+        for (NSFString::size_type i = 0; i < value.size(); ++i)
+        {
+            char character = value[i];
+
+            switch (character)
+            {
+            case '"':
+                text += "\\\"";
+                break;
+
+            case '\\':
+                text += "\\\\";
+                break;
+
+            case '\n':
+                text += "\\n";
+                break;
+
+            case '\r':
+                text += "\\r";
+                break;
+
+            case '\t':
+                text += "\\t";
+                break;
+
+            default:
+                if ((UInt8)character < 0x20)
+                {
+                    char escape[8];
+                    sprintf(escape, "\\u%04x", (unsigned int)(UInt8)character);
+                    text += escape;
+                }
+                else
+                {
+                    text += character;
+                }
+                break;
+            }
+        }
+
+        text += '"';
+    }
+
+    void NSFChromeTraceExporter::convertTrace(NSFTime time, const NSFString& type, const TagList& tags)
+    {
+        ++traceCount;
+
+        if (time > lastTime)
+        {
+            lastTime = time;
+        }
+
+        if (type == NSFTraceTags::StateEnteredTag())
+        {
+            UInt32 trackId = getTrackId(getTagData(tags, NSFTraceTags::StateMachineTag()));
+            const NSFString& state = getTagData(tags, NSFTraceTags::StateTag());
+
+            std::map<UInt32, StateSlice>::iterator sliceIterator = stateSlices.find(trackId);
+
+            if (sliceIterator != stateSlices.end())
+            {
+                // States entered at the same time are part of the same transition
+                if (sliceIterator->second.startTime == time)
+                {
+                    sliceIterator->second.name = state;
+                    sliceIterator->second.states += ", " + state;
+                    return;
+                }
+
+                TagList args(1, std::make_pair(NSFString("states"), sliceIterator->second.states));
+                addCompleteEvent(events, sliceIterator->second.name, StateCategory(), trackId, sliceIterator->second.startTime, time, args);
+            }
+
+            StateSlice& slice = stateSlices[trackId];
+            slice.name = state;
+            slice.states = state;
+            slice.startTime = time;
+        }
+        else if (type == NSFTraceTags::EventQueuedTag())
+        {
+            QueuedEvent queuedEvent;
+            queuedEvent.name = getTagData(tags, NSFTraceTags::NameTag());
+            queuedEvent.flowId = nextFlowId++;
+            queuedEvent.sourceTrackId = getTrackId(getTagData(tags, NSFTraceTags::SourceTag()));
+            queuedEvent.destinationTrackId = getTrackId(getTagData(tags, NSFTraceTags::DestinationTag()));
+            queuedEvent.queuedTime = time;
+
+            // A zero length slice marks the queuing, so that the flow arrow has a slice to start from even on tracks without states
+            TagList args(1, std::make_pair(NSFTraceTags::DestinationTag(), getTagData(tags, NSFTraceTags::DestinationTag())));
+            addCompleteEvent(events, queuedEvent.name, EventCategory(), queuedEvent.sourceTrackId, time, time, args);
+            addFlowEvent(events, queuedEvent.name, true, queuedEvent.flowId, queuedEvent.sourceTrackId, time);
+
+            if (!queueWaitEnabled)
+            {
+                endFlow(events, queuedEvent, time);
+                return;
+            }
+
+            const NSFString& destination = getTagData(tags, NSFTraceTags::DestinationTag());
+            NSFString queueKey = destination + "\n" + queuedEvent.name;
+
+            // An event handled at the same time as it was queued may have been converted first
+            std::map<NSFString, std::list<HandledEvent> >::iterator handledIterator = handledEvents.find(queueKey);
+
+            if (handledIterator != handledEvents.end())
+            {
+                while (!handledIterator->second.empty() && (handledIterator->second.front().handledTime < time))
+                {
+                    handledIterator->second.pop_front();
+                }
+
+                if (!handledIterator->second.empty())
+                {
+                    HandledEvent handledEvent = handledIterator->second.front();
+                    handledIterator->second.pop_front();
+
+                    endQueueWait(queuedEvent, destination, handledEvent.source, time);
+                    return;
+                }
+            }
+
+            queuedEvents[queueKey].push_back(queuedEvent);
+        }
+        else if (type == NSFTraceTags::EventHandledTag())
+        {
+            if (!queueWaitEnabled)
+            {
+                return;
+            }
+
+            const NSFString& destination = getTagData(tags, NSFTraceTags::DestinationTag());
+            NSFString queueKey = destination + "\n" + getTagData(tags, NSFTraceTags::NameTag());
+
+            // Events to the same destination are handled in the order they are queued, apart from rarely used priority events
+            std::map<NSFString, std::list<QueuedEvent> >::iterator queueIterator = queuedEvents.find(queueKey);
+
+            if ((queueIterator == queuedEvents.end()) || queueIterator->second.empty())
+            {
+                // The queued trace may follow, if it has the same time
+                HandledEvent handledEvent;
+                handledEvent.source = getTagData(tags, NSFTraceTags::SourceTag());
+                handledEvent.handledTime = time;
+                handledEvents[queueKey].push_back(handledEvent);
+                return;
+            }
+
+            QueuedEvent queuedEvent = queueIterator->second.front();
+            queueIterator->second.pop_front();
+
+            endQueueWait(queuedEvent, destination, getTagData(tags, NSFTraceTags::SourceTag()), time);
+        }
+        else if (type == NSFTraceTags::ActionExecutedTag())
+        {
+            addInstantEvent(getTagData(tags, NSFTraceTags::ActionTag()), TimerCategory(), getTrackId(TimersTrack()), time, TagList());
+        }
+        else
+        {
+            addInstantEvent(type, TraceCategory(), getTrackId(TracesTrack()), time, tags);
+        }
+    }
+
+    void NSFChromeTraceExporter::endFlow(NSFString& text, const QueuedEvent& queuedEvent, NSFTime time)
+    {
+        // As at the source, a zero length slice marks the end of the flow arrow
+        addCompleteEvent(text, queuedEvent.name, EventCategory(), queuedEvent.destinationTrackId, time, time, TagList());
+        addFlowEvent(text, queuedEvent.name, false, queuedEvent.flowId, queuedEvent.destinationTrackId, time);
+    }
+
+    void NSFChromeTraceExporter::endQueueWait(const QueuedEvent& queuedEvent, const NSFString& destination, const NSFString& source, NSFTime time)
+    {
+        endFlow(events, queuedEvent, time);
+
+        TagList args;
+        if (!source.empty())
+        {
+            args.push_back(std::make_pair(NSFTraceTags::SourceTag(), source));
+        }
+
+        addCompleteEvent(events, queuedEvent.name, QueueWaitCategory(), getTrackId(destination + QueueTrackSuffix()), queuedEvent.queuedTime, time, args);
+    }
+
+    const NSFString& NSFChromeTraceExporter::getTagData(const TagList& tags, const NSFString& tag)
+    {
+        for (TagList::size_type i = 0; i < tags.size(); ++i)
+        {
+            if (tags[i].first == tag)
+            {
+                return tags[i].second;
+            }
+        }
+
+        return emptyString();
+    }
+
+    UInt32 NSFChromeTraceExporter::getTrackId(const NSFString& trackName)
+    {
+        std::map<NSFString, UInt32>::iterator trackIterator = trackIds.find(trackName);
+
+        if (trackIterator != trackIds.end())
+        {
+            return trackIterator->second;
+        }
+
+        UInt32 trackId = (UInt32)trackIds.size() + 1;
+        trackIds[trackName] = trackId;
+
+        // Name the track, and keep tracks in the order they first appear
+        events += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + toString(trackId) + ",\"args\":{\"name\":";
+        appendJsonString(events, trackName);
+        events += "}}";
+        events += ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":" + toString(trackId) + ",\"args\":{\"sort_index\":" + toString(trackId) + "}}";
+
+        return trackId;
+    }
+
+    NSFTime NSFChromeTraceExporter::toMicroSeconds(NSFTime time)
+    {
+        return convertTime(time, TimeUnitsPerSecond, MicroSecondsPerSecond);
+    }
+}
@@ -0,0 +1,219 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_CHROME_TRACE_EXPORTER_H
+#define NSF_CHROME_TRACE_EXPORTER_H
+
+#include "NSFXMLDocument.h"
+
+#include <map>
+#include <vector>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a converter from trace logs to the Chrome trace event format, which can be viewed in chrome://tracing or Perfetto.
+    /// </summary>
+    /// <remarks>
+    /// Trace logs are added in time order, either as saved or streamed trace log files or as loaded documents,
+    /// and the converted timeline is written with save().
+    /// Each state machine, and each other source or destination of events, is shown as a track.
+    /// State entries become slices on the state machine's track, each lasting until the state machine's next state entry.
+    /// States entered at the same time, such as a composite state and its substate, share a slice named for the last state entered.
+    /// Queued events are shown as flow arrows from their source to their destination.
+    /// Scheduled actions are shown as instants on a timers track, and all other traces as instants on a traces track.
+    /// When queue wait timing is enabled and the trace log holds event handled traces (see NSFEventThread::setEventHandledLoggingEnabled()),
+    /// flow arrows end where the destination handled the event, and the time each event waited in the queue is shown as a slice
+    /// on a queue track for the destination.
+    /// </remarks>
+    class NSFChromeTraceExporter
+    {
+    public:
+
+        /// <summary>
+        /// Creates a Chrome trace exporter.
+        /// </summary>
+        NSFChromeTraceExporter();
+
+        /// <summary>
+        /// Gets the flag indicating if queue wait timing is enabled.
+        /// </summary>
+        bool getQueueWaitEnabled() const { return queueWaitEnabled; }
+
+        /// <summary>
+        /// Sets the flag indicating if queue wait timing is enabled.
+        /// </summary>
+        /// <remarks>
+        /// The flag must be set before trace logs are added.
+        /// </remarks>
+        void setQueueWaitEnabled(bool value) { queueWaitEnabled = value; }
+
+        /// <summary>
+        /// Gets the number of traces converted so far.
+        /// </summary>
+        UInt32 getTraceCount() const { return traceCount; }
+
+        /// <summary>
+        /// Adds the traces of a trace log file.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name of a saved or streamed trace log file.</param>
+        /// <returns>True if the file was loaded, otherwise false.</returns>
+        bool addTraceFile(const NSFString& fileName);
+
+        /// <summary>
+        /// Adds the traces of a trace log document.
+        /// </summary>
+        /// <param name="traceLog">The trace log document.  Its current element is moved by the conversion.</param>
+        void addTraceLog(NSFXMLDocument& traceLog);
+
+        /// <summary>
+        /// Saves the converted traces to the specified file in Chrome trace event json format.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name for the file.</param>
+        /// <remarks>
+        /// State slices still open at the end of the traces end at the time of the last trace.
+        /// An exception is thrown if the file cannot be opened.
+        /// </remarks>
+        void save(const NSFString& fileName);
+
+    private:
+
+        /// <summary>
+        /// Represents the state slice in progress on a state machine track.
+        /// </summary>
+        struct StateSlice
+        {
+            NSFString name;
+            NSFString states;
+            NSFTime startTime;
+        };
+
+        /// <summary>
+        /// Represents a queued event that has not yet been handled.
+        /// </summary>
+        struct QueuedEvent
+        {
+            NSFString name;
+            UInt32 flowId;
+            UInt32 sourceTrackId;
+            UInt32 destinationTrackId;
+            NSFTime queuedTime;
+        };
+
+        /// <summary>
+        /// Represents a handled event whose queued trace has not yet been converted.
+        /// </summary>
+        /// <remarks>
+        /// Traces from different threads with the same time may be saved in either order, so an event may appear to be handled before it is queued.
+        /// </remarks>
+        struct HandledEvent
+        {
+            NSFString source;
+            NSFTime handledTime;
+        };
+
+        typedef std::vector<std::pair<NSFString, NSFString> > TagList;
+
+        bool queueWaitEnabled;
+        UInt32 traceCount;
+        NSFString events;
+        NSFTime lastTime;
+        UInt32 nextFlowId;
+        std::map<NSFString, UInt32> trackIds;
+        std::map<UInt32, StateSlice> stateSlices;
+        std::map<NSFString, std::list<QueuedEvent> > queuedEvents;
+        std::map<NSFString, std::list<HandledEvent> > handledEvents;
+
+        /// <summary>
+        /// Adds a complete (duration) event.
+        /// </summary>
+        void addCompleteEvent(NSFString& text, const NSFString& name, const NSFString& category, UInt32 trackId, NSFTime startTime, NSFTime endTime, const TagList& args);
+
+        /// <summary>
+        /// Adds one end of a flow arrow.
+        /// </summary>
+        void addFlowEvent(NSFString& text, const NSFString& name, bool isStart, UInt32 flowId, UInt32 trackId, NSFTime time);
+
+        /// <summary>
+        /// Adds an instant event.
+        /// </summary>
+        void addInstantEvent(const NSFString& name, const NSFString& category, UInt32 trackId, NSFTime time, const TagList& args);
+
+        /// <summary>
+        /// Adds the start of an event object, up to and including the track id.
+        /// </summary>
+        void addEventStart(NSFString& text, const NSFString& name, const NSFString& category, const NSFString& phase, UInt32 trackId);
+
+        /// <summary>
+        /// Adds the end of an event object, starting with the time stamp.
+        /// </summary>
+        void addEventEnd(NSFString& text, NSFTime time, const TagList& args);
+
+        /// <summary>
+        /// Appends a string in json format, with quotes and escapes.
+        /// </summary>
+        static void appendJsonString(NSFString& text, const NSFString& value);
+
+        /// <summary>
+        /// Converts a trace log time to microseconds, the time unit of the Chrome trace event format.
+        /// </summary>
+        static NSFTime toMicroSeconds(NSFTime time);
+
+        /// <summary>
+        /// Gets a tag's data from a trace's tag list.
+        /// </summary>
+        static const NSFString& getTagData(const TagList& tags, const NSFString& tag);
+
+        /// <summary>
+        /// Gets the id of the track with the specified name, adding the track if necessary.
+        /// </summary>
+        UInt32 getTrackId(const NSFString& trackName);
+
+        /// <summary>
+        /// Converts a single trace.
+        /// </summary>
+        void convertTrace(NSFTime time, const NSFString& type, const TagList& tags);
+
+        /// <summary>
+        /// Ends the flow arrow of a queued event at its destination.
+        /// </summary>
+        void endFlow(NSFString& text, const QueuedEvent& queuedEvent, NSFTime time);
+
+        /// <summary>
+        /// Ends the flow of a queued event where it was handled, and adds the slice showing the time it waited in its destination's queue.
+        /// </summary>
+        void endQueueWait(const QueuedEvent& queuedEvent, const NSFString& destination, const NSFString& source, NSFTime time);
+
+        static const NSFString& EventCategory() { static NSFString string("Event"); return string; };
+        static const NSFString& QueueTrackSuffix() { static NSFString string(" Queue"); return string; };
+        static const NSFString& QueueWaitCategory() { static NSFString string("QueueWait"); return string; };
+        static const NSFString& StateCategory() { static NSFString string("State"); return string; };
+        static const NSFString& TimeTag() { static NSFString string("Time"); return string; };
+        static const NSFString& TimersTrack() { static NSFString string("Timers"); return string; };
+        static const NSFString& TimerCategory() { static NSFString string("Timer"); return string; };
+        static const NSFString& TraceCategory() { static NSFString string("Trace"); return string; };
+        static const NSFString& TracesTrack() { static NSFString string("Traces"); return string; };
+    };
+}
+
+#endif // NSF_CHROME_TRACE_EXPORTER_H
@@ -1,118 +1,195 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "NSFEvent.h"
-
-#include "NSFEventHandler.h"
-#include "NSFStateMachine.h"
-#include "NSFTimerThread.h"
-
-namespace NorthStateFramework
-{
-    // Public
-
-    NSFEvent::NSFEvent(const NSFString& name, INSFEventHandler* parent)
-        : NSFTimerAction(name), deleteAfterHandling(false), id(NSFUniquelyNumberedObject::getNextUniqueId()), source(parent), destination(parent)
-    {
-    }
-
-    NSFEvent::NSFEvent(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination)
-        : NSFTimerAction(name), deleteAfterHandling(false), id(NSFUniquelyNumberedObject::getNextUniqueId()), source(source), destination(destination)
-    {
-    }
-
-    NSFEvent::NSFEvent(const NSFEvent& nsfEvent)
-        : NSFTimerAction(nsfEvent.getName()), deleteAfterHandling(false), id(nsfEvent.getId()), source(nsfEvent.getSource()), destination(nsfEvent.getDestination())
-    {
-    }
-
-    NSFEvent::~NSFEvent()
-    {
-    }
-
-    NSFEvent* NSFEvent::copy(bool deleteAfterHandling)
-    {
-        NSFEvent* eventCopy = new NSFEvent(*this);
-        eventCopy->setDeleteAfterHandling(deleteAfterHandling);
-        return eventCopy;
-    }
-
-    NSFEvent* NSFEvent::copy(const NSFString& name, bool deleteAfterHandling)
-    {
-        NSFEvent* eventCopy = copy(deleteAfterHandling);
-        eventCopy->setName(name);
-        return eventCopy;
-    }
-
-    NSFEvent* NSFEvent::copy(INSFNamedObject* source, INSFEventHandler* destination, bool deleteAfterHandling)
-    {
-        NSFEvent* eventCopy = copy(deleteAfterHandling);
-        eventCopy->setSource(source);
-        eventCopy->setDestination(destination);
-        return eventCopy;
-    }
-
-    NSFEvent* NSFEvent::copy(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination, bool deleteAfterHandling)
-    {
-        NSFEvent* eventCopy = copy(deleteAfterHandling);
-        eventCopy->setName(name);
-        eventCopy->setSource(source);
-        eventCopy->setDestination(destination);
-        return eventCopy;
-    }
-
-    void NSFEvent::queueEvent()
-    {
-        destination->queueEvent(this);
-    }
-
-    void NSFEvent::queueEvent(const NSFStateMachineContext& context)
-    {
-        destination->queueEvent(this, context.getSource());
-    }
-
-    void NSFEvent::schedule(NSFTime delayTime, NSFTime repeatTime)
-    {
-        NSFTimerThread::getPrimaryTimerThread().scheduleAction(this, delayTime, repeatTime);
-    }
-
-    void NSFEvent::schedule(INSFNamedObject* source, INSFEventHandler* destination, NSFTime delayTime, NSFTime repeatTime)
-    {
-        setSource(source);
-        setDestination(destination);
-        NSFTimerThread::getPrimaryTimerThread().scheduleAction(this, delayTime, repeatTime);
-    }
-
-    void NSFEvent::setRouting(INSFNamedObject* source, INSFEventHandler* destination)
-    {
-        setSource(source);
-        setDestination(destination);
-    }
-
-    // Private
-
-    void NSFEvent::execute()
-    {
-        destination->queueEvent(this);
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFEvent.h"
+
+#include "NSFEventHandler.h"
+#include "NSFEventThread.h"
+#include "NSFStateMachine.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFEvent::NSFEvent(const NSFString& name, INSFEventHandler* parent)
+        : name(NSFNameTable::intern(name)), id(NSFUniquelyNumberedObject::getNextUniqueId()), source(parent), destination(parent), timer(NULL), deleteAfterHandling(false)
+    {
+    }
+
+    NSFEvent::NSFEvent(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination)
+        : name(NSFNameTable::intern(name)), id(NSFUniquelyNumberedObject::getNextUniqueId()), source(source), destination(destination), timer(NULL), deleteAfterHandling(false)
+    {
+    }
+
+    NSFEvent::NSFEvent(const NSFEvent& nsfEvent)
+        : INSFNamedObject(), name(NSFNameTable::addReference(nsfEvent.name)), id(nsfEvent.getId()), source(nsfEvent.getSource()), destination(nsfEvent.getDestination()), timer(NULL), deleteAfterHandling(false)
+    {
+    }
+
+    NSFEvent::~NSFEvent()
+    {
+        delete timer;
+        NSFNameTable::release(name);
+    }
+
+    NSFEvent* NSFEvent::copy(bool deleteAfterHandling)
+    {
+        NSFEvent* eventCopy = new NSFEvent(*this);
+        eventCopy->setDeleteAfterHandling(deleteAfterHandling);
+        return eventCopy;
+    }
+
+    NSFEvent* NSFEvent::copy(const NSFString& name, bool deleteAfterHandling)
+    {
+        NSFEvent* eventCopy = copy(deleteAfterHandling);
+        eventCopy->setName(name);
+        return eventCopy;
+    }
+
+    NSFEvent* NSFEvent::copy(INSFNamedObject* source, INSFEventHandler* destination, bool deleteAfterHandling)
+    {
+        NSFEvent* eventCopy = copy(deleteAfterHandling);
+        eventCopy->setSource(source);
+        eventCopy->setDestination(destination);
+        return eventCopy;
+    }
+
+    NSFEvent* NSFEvent::copy(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination, bool deleteAfterHandling)
+    {
+        NSFEvent* eventCopy = copy(deleteAfterHandling);
+        eventCopy->setName(name);
+        eventCopy->setSource(source);
+        eventCopy->setDestination(destination);
+        return eventCopy;
+    }
+
+    NSFEventTimer* NSFEvent::getTimer()
+    {
+        NSFEventTimer* eventTimer = timer;
+
+        // Read the timer only after the pointer that publishes it
+        NSFOSThread::memoryBarrier();
+
+        if (eventTimer != NULL)
+        {
+            return eventTimer;
+        }
+
+        LOCK(getEventTimerMutex())
+        {
+            if (timer == NULL)
+            {
+                eventTimer = new NSFEventTimer(this);
+
+                // Complete the timer before publishing it
+                NSFOSThread::memoryBarrier();
+
+                timer = eventTimer;
+            }
+
+            return timer;
+        }
+        ENDLOCK;
+    }
+
+    void NSFEvent::queueEvent()
+    {
+        destination->queueEvent(this);
+    }
+
+    void NSFEvent::queueEvent(const NSFStateMachineContext& context)
+    {
+        destination->queueEvent(this, context.getSource());
+    }
+
+    void NSFEvent::schedule(NSFTime delayTime, NSFTime repeatTime)
+    {
+        getTimer()->schedule(delayTime, repeatTime);
+    }
+
+    void NSFEvent::schedule(INSFNamedObject* source, INSFEventHandler* destination, NSFTime delayTime, NSFTime repeatTime)
+    {
+        setSource(source);
+        setDestination(destination);
+        getTimer()->schedule(delayTime, repeatTime);
+    }
+
+    void NSFEvent::scheduleAbsoluteExecution(NSFTime executionTime)
+    {
+        getTimer()->scheduleAbsoluteExecution(executionTime);
+    }
+
+    void NSFEvent::scheduleAbsoluteExecution(NSFTime executionTime, NSFTime repeatTime)
+    {
+        getTimer()->scheduleAbsoluteExecution(executionTime, repeatTime);
+    }
+
+    void NSFEvent::setName(const NSFString& value)
+    {
+        // Intern the new name before releasing the old one, as the value may refer to the old name
+        const NSFString* oldName = name;
+        name = NSFNameTable::intern(value);
+        NSFNameTable::release(oldName);
+    }
+
+    void NSFEvent::setRouting(INSFNamedObject* source, INSFEventHandler* destination)
+    {
+        setSource(source);
+        setDestination(destination);
+    }
+
+    void NSFEvent::unschedule()
+    {
+        if (timer != NULL)
+        {
+            timer->unschedule();
+        }
+    }
+
+    // Protected
+
+    NSFEventThread* NSFEvent::getLocalTimerThread() const
+    {
+        if (destination == NULL)
+        {
+            return NULL;
+        }
+
+        NSFEventThread* eventThread = destination->getEventThread();
+
+        if ((eventThread == NULL) || !eventThread->getLocalTimersEnabled())
+        {
+            return NULL;
+        }
+
+        return eventThread;
+    }
+
+    // Private
+
+    NSFOSMutex* NSFEvent::getEventTimerMutex()
+    {
+        static NSFOSMutex* eventTimerMutex = NSFOSMutex::create();
+        return eventTimerMutex;
+    }
+}
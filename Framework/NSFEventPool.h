@@ -0,0 +1,154 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_EVENT_POOL_H
+#define NSF_EVENT_POOL_H
+
+#include "NSFCoreTypes.h"
+#include "NSFOSMutex.h"
+
+#include <new>
+#include <vector>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a pool of memory for events of a particular type.
+    /// </summary>
+    /// <remarks>
+    /// Event classes use the pool from their operator new and operator delete,
+    /// so that events created and deleted at a high rate, such as event copies queued with deleteAfterHandling set,
+    /// reuse the memory of deleted events rather than allocating new memory.
+    /// Only allocations the size of the event type are pooled, so classes derived from it allocate their memory as usual.
+    /// Pooled memory is never released, so that events can be deleted while static objects are destroyed.
+    /// </remarks>
+    template<class EventType>
+    class NSFEventPool
+    {
+    public:
+
+        /// <summary>
+        /// Allocates memory for an event, reusing the memory of a deleted event if one is available.
+        /// </summary>
+        /// <param name="size">The size of the memory.</param>
+        /// <returns>The memory.</returns>
+        static void* allocate(size_t size)
+        {
+            if (size == sizeof(EventType))
+            {
+                LOCK(getPoolMutex())
+                {
+                    std::vector<void*>& pool = getPool();
+
+                    if (!pool.empty())
+                    {
+                        void* memory = pool.back();
+                        pool.pop_back();
+                        return memory;
+                    }
+                }
+                ENDLOCK;
+            }
+
+            return ::operator new(size);
+        }
+
+        /// <summary>
+        /// Returns the memory of a deleted event to the pool, or releases it if the pool is full.
+        /// </summary>
+        /// <param name="memory">The memory.</param>
+        /// <param name="size">The size of the memory.</param>
+        static void release(void* memory, size_t size)
+        {
+            if (memory == NULL)
+            {
+                return;
+            }
+
+            if (size == sizeof(EventType))
+            {
+                LOCK(getPoolMutex())
+                {
+                    std::vector<void*>& pool = getPool();
+
+                    if (pool.size() < getMaxPooledEventsReference())
+                    {
+                        pool.push_back(memory);
+                        return;
+                    }
+                }
+                ENDLOCK;
+            }
+
+            ::operator delete(memory);
+        }
+
+        /// <summary>
+        /// Gets the maximum number of deleted events whose memory is kept for reuse.
+        /// </summary>
+        static UInt32 getMaxPooledEvents() { return getMaxPooledEventsReference(); }
+
+        /// <summary>
+        /// Sets the maximum number of deleted events whose memory is kept for reuse.
+        /// </summary>
+        /// <param name="value">The maximum number of pooled events.</param>
+        /// <remarks>
+        /// The default is 1024.  Setting the value to zero disables pooling for new deletions.
+        /// </remarks>
+        static void setMaxPooledEvents(UInt32 value) { getMaxPooledEventsReference() = value; }
+
+        /// <summary>
+        /// Gets the number of deleted events whose memory is currently pooled.
+        /// </summary>
+        static UInt32 getPooledEventCount()
+        {
+            LOCK(getPoolMutex())
+            {
+                return (UInt32)getPool().size();
+            }
+            ENDLOCK;
+        }
+
+    private:
+
+        static std::vector<void*>& getPool()
+        {
+            static std::vector<void*>* pool = new std::vector<void*>();
+            return *pool;
+        }
+
+        static NSFOSMutex* getPoolMutex()
+        {
+            static NSFOSMutex* poolMutex = NSFOSMutex::create();
+            return poolMutex;
+        }
+
+        static volatile UInt32& getMaxPooledEventsReference()
+        {
+            static volatile UInt32 maxPooledEvents = 1024;
+            return maxPooledEvents;
+        }
+    };
+}
+
+#endif // NSF_EVENT_POOL_H
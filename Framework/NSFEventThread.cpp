@@ -1,276 +1,526 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "NSFEventThread.h"
-
-#include "NSFEvent.h"
-#include "NSFEventHandler.h"
-#include "NSFExceptionHandler.h"
-#include "NSFTimerThread.h"
-#include "NSFTraceLog.h"
-
-namespace NorthStateFramework
-{
-    // Public
-
-    NSFEventThread::NSFEventThread(const NSFString& name)
-        : NSFThread(name), signal(NSFOSSignal::create(name))
-    {
-        startThread();
-    }
-
-    NSFEventThread::NSFEventThread(const NSFString& name, int priority)
-        : NSFThread(name, priority), signal(NSFOSSignal::create(name))
-    {
-        startThread();
-    }
-
-    NSFEventThread::~NSFEventThread()
-    {
-        terminate(true);
-        clearEvents();
-        delete signal;
-    }
-
-    std::list<INSFEventHandler*> NSFEventThread::getEventHandlers()
-    {
-        LOCK(getThreadMutex())
-        {
-            return eventHandlers;
-        }
-        ENDLOCK;
-    }
-
-    bool NSFEventThread::hasEvent(NSFEvent* nsfEvent)
-    {
-        LOCK(getThreadMutex())
-        {
-            std::list<NSFEvent*>::iterator eventIterator;
-            for (eventIterator = nsfEvents.begin(); eventIterator != nsfEvents.end(); ++eventIterator)
-            {
-                if ((*eventIterator)->getId() == nsfEvent->getId())
-                {
-                    return true;
-                }
-            }
-            return false;
-        }
-        ENDLOCK;
-    }
-
-    bool NSFEventThread::hasEventFor(INSFEventHandler* eventHandler)
-    {
-        LOCK(getThreadMutex())
-        {
-            std::list<NSFEvent*>::iterator eventIterator;
-            for (eventIterator = nsfEvents.begin(); eventIterator != nsfEvents.end(); ++eventIterator)
-            {
-                if ((*eventIterator)->getDestination() == eventHandler)
-                {
-                    return true;
-                }
-            }
-            return false;
-        }
-        ENDLOCK;
-    }
-
-    void NSFEventThread::queueEvent(NSFEvent* nsfEvent, bool isPriorityEvent, bool logEventQueued)
-    {
-        // Do not allow events to be queued if terminated
-        if (getTerminationStatus() == ThreadTerminated)
-        {
-            if (nsfEvent->getDeleteAfterHandling())
-            {
-                delete nsfEvent;
-            }
-
-            return;
-        }
-
-        LOCK(getThreadMutex())
-        {
-            if (logEventQueued)
-            {
-                if (nsfEvent->getSource() != NULL)
-                {
-                    NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::EventQueuedTag(),
-                        NSFTraceTags::NameTag(), nsfEvent->getName(),
-                        NSFTraceTags::SourceTag(), nsfEvent->getSource()->getName(),
-                        NSFTraceTags::DestinationTag(), nsfEvent->getDestination()->getName());
-                }
-                else
-                {
-                    NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::EventQueuedTag(),
-                        NSFTraceTags::NameTag(), nsfEvent->getName(),
-                        NSFTraceTags::SourceTag(), NSFTraceTags::UnknownTag(),
-                        NSFTraceTags::DestinationTag(), nsfEvent->getDestination()->getName());
-                }
-            }
-
-            if (isPriorityEvent)
-            {
-                nsfEvents.push_front(nsfEvent);
-            }
-            else
-            {
-                nsfEvents.push_back(nsfEvent);
-            }
-        }
-        ENDLOCK;
-
-        signal->send();
-    }
-
-    void NSFEventThread::terminate(bool waitForTerminated)
-    {
-        // Get all event handler terminations started
-        std::list<INSFEventHandler*>::iterator eventHandlerIterator;
-        std::list<INSFEventHandler*> eventHandlersCopy = getEventHandlers();
-        for (eventHandlerIterator = eventHandlersCopy.begin(); eventHandlerIterator != eventHandlersCopy.end(); ++eventHandlerIterator)
-        {
-            (*eventHandlerIterator)->terminate(false);
-        }
-
-        // Base class behavior, but return immediately so signal can be sent to wake up event thread
-        NSFThread::terminate(false);
-
-        signal->send();
-
-        // Wait as specified for thread to terminate after signal has been sent
-        NSFThread::terminate(waitForTerminated);
-    }
-
-    // Protected
-
-    // Private
-
-    bool NSFEventThread::allEventHandlersTerminated()
-    {
-        std::list<INSFEventHandler*>::iterator eventHandlerIterator;
-        std::list<INSFEventHandler*> eventHandlersCopy = getEventHandlers();
-        for (eventHandlerIterator = eventHandlersCopy.begin(); eventHandlerIterator != eventHandlersCopy.end(); ++eventHandlerIterator)
-        {
-            if ((*eventHandlerIterator)->getTerminationStatus() != EventHandlerTerminated)
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-
-    void NSFEventThread::addEventHandler(INSFEventHandler* eventHandler)
-    {
-        LOCK(getThreadMutex())
-        {
-            if (getTerminationStatus() == ThreadReady)
-            {
-                eventHandlers.push_back(eventHandler);
-            }
-        }
-        ENDLOCK;
-    }
-
-    void NSFEventThread::clearEvents()
-    {
-        LOCK(getThreadMutex())
-        {
-            while (!nsfEvents.empty())
-            {
-                NSFEvent* nsfEvent = nsfEvents.front();
-                nsfEvents.pop_front();
-
-                if (nsfEvent->getDeleteAfterHandling())
-                {
-                    delete nsfEvent;
-                }
-            }
-        }
-        ENDLOCK;
-    }
-
-    void NSFEventThread::removeEventHandler(INSFEventHandler* eventHandler)
-    {
-        LOCK(getThreadMutex())
-        {
-            eventHandlers.remove(eventHandler);
-        }
-        ENDLOCK;
-    }
-
-    void NSFEventThread::threadLoop()
-    {
-        while (true)
-        {
-            // Wait for signal to indicate there's work to do
-            signal->wait();
-
-            while (true)
-            {
-                NSFEvent* nsfEvent = NULL;
-
-                LOCK(getThreadMutex())
-                {
-                    if (!nsfEvents.empty())
-                    {
-                        nsfEvent = nsfEvents.front();
-                        nsfEvents.pop_front();
-                    }
-                }
-                ENDLOCK;
-
-                if (nsfEvent == NULL)
-                {
-                    break;
-                }
-
-                // Guard a bad event from taking down event thread
-                try
-                {
-                    nsfEvent->getDestination()->handleEvent(nsfEvent);
-                }
-                catch(const std::exception& exception)
-                {
-                    handleException(std::runtime_error(getName() + " event handling exception: " + exception.what()));
-                }
-                catch(...)
-                {
-                    handleException(std::runtime_error(getName() + " event handling exception: unknown exception"));
-                }
-
-                if (nsfEvent->getDeleteAfterHandling())
-                {
-                    delete nsfEvent;
-                }
-            }
-
-            // Thread loop will exit when terminating and all event handlers are terminated
-            if ((getTerminationStatus() ==  ThreadTerminating) && allEventHandlersTerminated())
-            {
-                clearEvents();
-                return;
-            }
-        }
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFEventThread.h"
+
+#include "NSFEvent.h"
+#include "NSFEventHandler.h"
+#include "NSFExceptionHandler.h"
+#include "NSFTimerThread.h"
+#include "NSFTraceLog.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFEventThread::NSFEventThread(const NSFString& name)
+        : NSFThread(name), signal(NSFOSSignal::create(name)), timerQueue(NULL), timerWaitTime(MaxTime), eventHandledLoggingEnabled(false)
+    {
+        startThread();
+    }
+
+    NSFEventThread::NSFEventThread(const NSFString& name, int priority)
+        : NSFThread(name, priority), signal(NSFOSSignal::create(name)), timerQueue(NULL), timerWaitTime(MaxTime), eventHandledLoggingEnabled(false)
+    {
+        startThread();
+    }
+
+    NSFEventThread::~NSFEventThread()
+    {
+        terminate(true);
+        clearEvents();
+        delete signal;
+        delete timerQueue;
+    }
+
+    std::list<INSFEventHandler*> NSFEventThread::getEventHandlers()
+    {
+        LOCK(getThreadMutex())
+        {
+            return eventHandlers;
+        }
+        ENDLOCK;
+    }
+
+    bool NSFEventThread::getLocalTimersEnabled()
+    {
+        LOCK(getThreadMutex())
+        {
+            return (timerQueue != NULL);
+        }
+        ENDLOCK;
+    }
+
+    void NSFEventThread::setLocalTimersEnabled(bool value)
+    {
+        std::list<NSFTimerAction*> scheduledActions;
+
+        LOCK(getThreadMutex())
+        {
+            if (value == (timerQueue != NULL))
+            {
+                return;
+            }
+
+            if (value)
+            {
+                // The indexed heap keeps exact execution order with logarithmic scheduling time
+                timerQueue = NSFTimerQueue::create(IndexedHeapTimerQueue, NSFTimerThread::getPrimaryTimerThread().getCurrentTime());
+                return;
+            }
+
+            timerQueue->removeAllActions(scheduledActions);
+            delete timerQueue;
+            timerQueue = NULL;
+
+            std::list<NSFTimerAction*>::iterator actionIterator;
+            for (actionIterator = scheduledActions.begin(); actionIterator != scheduledActions.end(); ++actionIterator)
+            {
+                (*actionIterator)->timerEventThread = NULL;
+            }
+        }
+        ENDLOCK;
+
+        // Move locally scheduled actions to the primary timer thread, keeping their execution times
+        std::list<NSFTimerAction*>::iterator actionIterator;
+        for (actionIterator = scheduledActions.begin(); actionIterator != scheduledActions.end(); ++actionIterator)
+        {
+            NSFTimerThread::getPrimaryTimerThread().scheduleAction(*actionIterator);
+        }
+    }
+
+    bool NSFEventThread::hasEvent(NSFEvent* nsfEvent)
+    {
+        LOCK(getThreadMutex())
+        {
+            std::list<NSFEvent*>::iterator eventIterator;
+            for (eventIterator = nsfEvents.begin(); eventIterator != nsfEvents.end(); ++eventIterator)
+            {
+                if ((*eventIterator)->getId() == nsfEvent->getId())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        ENDLOCK;
+    }
+
+    bool NSFEventThread::hasEventFor(INSFEventHandler* eventHandler)
+    {
+        LOCK(getThreadMutex())
+        {
+            std::list<NSFEvent*>::iterator eventIterator;
+            for (eventIterator = nsfEvents.begin(); eventIterator != nsfEvents.end(); ++eventIterator)
+            {
+                if ((*eventIterator)->getDestination() == eventHandler)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        ENDLOCK;
+    }
+
+    bool NSFEventThread::isScheduled(NSFTimerAction* action)
+    {
+        LOCK(getThreadMutex())
+        {
+            // The queue is cleared without accessing its actions when the thread terminates
+            if ((timerQueue == NULL) || (getTerminationStatus() == ThreadTerminated))
+            {
+                return false;
+            }
+
+            return timerQueue->isScheduled(action);
+        }
+        ENDLOCK;
+    }
+
+    void NSFEventThread::queueEvent(NSFEvent* nsfEvent, bool isPriorityEvent, bool logEventQueued)
+    {
+        // Do not allow events to be queued if terminated
+        if (getTerminationStatus() == ThreadTerminated)
+        {
+            if (nsfEvent->getDeleteAfterHandling())
+            {
+                delete nsfEvent;
+            }
+
+            return;
+        }
+
+        bool sendSignal;
+
+        LOCK(getThreadMutex())
+        {
+            // The thread drains its queue before waiting, so it only needs a signal when the queue was empty.
+            // This lets a burst of events, such as many timer events expiring together, wake the thread once.
+            sendSignal = nsfEvents.empty();
+
+#if NSF_TRACE_LEVEL >= NSF_TRACE_LEVEL_ALL
+            if (logEventQueued && NSFTraceLog::getPrimaryTraceLog().isTraceEnabled(EventQueuedTraceCategory) && isEventTraced(nsfEvent))
+            {
+                if (nsfEvent->getSource() != NULL)
+                {
+                    NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::EventQueuedTag(),
+                        NSFTraceTags::NameTag(), nsfEvent->getName(),
+                        NSFTraceTags::SourceTag(), nsfEvent->getSource()->getName(),
+                        NSFTraceTags::DestinationTag(), nsfEvent->getDestination()->getName());
+                }
+                else
+                {
+                    NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::EventQueuedTag(),
+                        NSFTraceTags::NameTag(), nsfEvent->getName(),
+                        NSFTraceTags::SourceTag(), NSFTraceTags::UnknownTag(),
+                        NSFTraceTags::DestinationTag(), nsfEvent->getDestination()->getName());
+                }
+            }
+#else
+            (void)logEventQueued;
+#endif
+
+            if (isPriorityEvent)
+            {
+                nsfEvents.push_front(nsfEvent);
+            }
+            else
+            {
+                nsfEvents.push_back(nsfEvent);
+            }
+        }
+        ENDLOCK;
+
+        if (sendSignal)
+        {
+            signal->send();
+        }
+    }
+
+    void NSFEventThread::scheduleAction(NSFTimerAction* action)
+    {
+        // An action held by another thread, for example after its event's destination changed, must leave that thread's queue first
+        action->unscheduleFromTimerThread(this);
+
+        bool scheduledLocally = false;
+        bool sendSignal = false;
+
+        LOCK(getThreadMutex())
+        {
+            // Do not schedule any actions if terminated
+            if (getTerminationStatus() == ThreadTerminated)
+            {
+                return;
+            }
+
+            if (timerQueue != NULL)
+            {
+                timerQueue->insertAction(action);
+                action->timerEventThread = this;
+                scheduledLocally = true;
+
+                // Wake up the thread to recompute its wait only if the action is due before the thread would otherwise wake,
+                // so that rescheduling an action, as for a watchdog timeout, does not cost a context switch
+                sendSignal = (timerQueue->getNextExecutionTime() < timerWaitTime);
+            }
+        }
+        ENDLOCK;
+
+        if (!scheduledLocally)
+        {
+            NSFTimerThread::getPrimaryTimerThread().scheduleAction(action);
+        }
+        else if (sendSignal)
+        {
+            signal->send();
+        }
+    }
+
+    void NSFEventThread::scheduleAction(NSFTimerAction* action, NSFTime delayTime, NSFTime repeatTime)
+    {
+        action->setExecutionTime(NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + delayTime);
+        action->setRepeatTime(repeatTime);
+        action->setDelayTime(delayTime);
+
+        scheduleAction(action);
+    }
+
+    void NSFEventThread::terminate(bool waitForTerminated)
+    {
+        // Get all event handler terminations started
+        std::list<INSFEventHandler*>::iterator eventHandlerIterator;
+        std::list<INSFEventHandler*> eventHandlersCopy = getEventHandlers();
+        for (eventHandlerIterator = eventHandlersCopy.begin(); eventHandlerIterator != eventHandlersCopy.end(); ++eventHandlerIterator)
+        {
+            (*eventHandlerIterator)->terminate(false);
+        }
+
+        // Base class behavior, but return immediately so signal can be sent to wake up event thread
+        NSFThread::terminate(false);
+
+        signal->send();
+
+        // Wait as specified for thread to terminate after signal has been sent
+        NSFThread::terminate(waitForTerminated);
+    }
+
+    void NSFEventThread::unscheduleAction(NSFTimerAction* action)
+    {
+        LOCK(getThreadMutex())
+        {
+            if (action->timerEventThread == this)
+            {
+                action->timerEventThread = NULL;
+            }
+
+            // The queue is cleared without accessing its actions when the thread terminates
+            if ((timerQueue == NULL) || (getTerminationStatus() == ThreadTerminated) || !timerQueue->isScheduled(action))
+            {
+                return;
+            }
+
+            // The thread recomputes its wait after waking, so removing the next action does not require a signal
+            timerQueue->removeAction(action);
+        }
+        ENDLOCK;
+    }
+
+    // Protected
+
+    // Private
+
+    bool NSFEventThread::allEventHandlersTerminated()
+    {
+        std::list<INSFEventHandler*>::iterator eventHandlerIterator;
+        std::list<INSFEventHandler*> eventHandlersCopy = getEventHandlers();
+        for (eventHandlerIterator = eventHandlersCopy.begin(); eventHandlerIterator != eventHandlersCopy.end(); ++eventHandlerIterator)
+        {
+            if ((*eventHandlerIterator)->getTerminationStatus() != EventHandlerTerminated)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void NSFEventThread::addEventHandler(INSFEventHandler* eventHandler)
+    {
+        LOCK(getThreadMutex())
+        {
+            if (getTerminationStatus() == ThreadReady)
+            {
+                eventHandlers.push_back(eventHandler);
+            }
+        }
+        ENDLOCK;
+    }
+
+    void NSFEventThread::clearEvents()
+    {
+        LOCK(getThreadMutex())
+        {
+            while (!nsfEvents.empty())
+            {
+                NSFEvent* nsfEvent = nsfEvents.front();
+                nsfEvents.pop_front();
+
+                if (nsfEvent->getDeleteAfterHandling())
+                {
+                    delete nsfEvent;
+                }
+            }
+        }
+        ENDLOCK;
+    }
+
+    void NSFEventThread::executeTimerAction(NSFTimerAction* action)
+    {
+        // Guard a bad action from taking down event thread
+        try
+        {
+            action->execute();
+        }
+        catch(const std::exception& exception)
+        {
+            handleException(std::runtime_error(action->getName() + " action execution exception: " + exception.what()));
+        }
+        catch(...)
+        {
+            handleException(std::runtime_error(action->getName() + " action execution exception: unknown exception"));
+        }
+    }
+
+    bool NSFEventThread::isEventTraced(NSFEvent* nsfEvent)
+    {
+        NSFTraceFilter& filter = NSFTraceLog::getPrimaryTraceLog().getFilter();
+
+        return (filter.isEventEnabled(nsfEvent->getName()) && filter.isStateMachineEnabled(nsfEvent->getDestination()->getName()));
+    }
+
+    void NSFEventThread::removeEventHandler(INSFEventHandler* eventHandler)
+    {
+        LOCK(getThreadMutex())
+        {
+            eventHandlers.remove(eventHandler);
+        }
+        ENDLOCK;
+    }
+
+    void NSFEventThread::threadLoop()
+    {
+        std::list<NSFTimerAction*> readyActions;
+
+        while (true)
+        {
+            waitForWork();
+
+            // Execute local timer actions that are ready, rescheduling repetitive actions
+            LOCK(getThreadMutex())
+            {
+                if (timerQueue != NULL)
+                {
+                    timerQueue->getReadyActions(NSFTimerThread::getPrimaryTimerThread().getCurrentTime(), readyActions);
+
+                    // Actions that are not periodic are no longer held by this thread
+                    std::list<NSFTimerAction*>::iterator actionIterator;
+                    for (actionIterator = readyActions.begin(); actionIterator != readyActions.end(); ++actionIterator)
+                    {
+                        if (!timerQueue->isScheduled(*actionIterator))
+                        {
+                            (*actionIterator)->timerEventThread = NULL;
+                        }
+                    }
+                }
+            }
+            ENDLOCK;
+
+            while (!readyActions.empty())
+            {
+                executeTimerAction(readyActions.front());
+                readyActions.pop_front();
+            }
+
+            while (true)
+            {
+                NSFEvent* nsfEvent = NULL;
+
+                LOCK(getThreadMutex())
+                {
+                    if (!nsfEvents.empty())
+                    {
+                        nsfEvent = nsfEvents.front();
+                        nsfEvents.pop_front();
+                    }
+                }
+                ENDLOCK;
+
+                if (nsfEvent == NULL)
+                {
+                    break;
+                }
+
+                // Handling a terminate event allows its owner to be deleted by another thread,
+                // so the event must not be accessed after it is handled
+                bool deleteAfterHandling = nsfEvent->getDeleteAfterHandling();
+
+#if NSF_TRACE_LEVEL >= NSF_TRACE_LEVEL_ALL
+                if (eventHandledLoggingEnabled && NSFTraceLog::getPrimaryTraceLog().isTraceEnabled(EventHandledTraceCategory) && isEventTraced(nsfEvent))
+                {
+                    NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::EventHandledTag(),
+                        NSFTraceTags::NameTag(), nsfEvent->getName(),
+                        NSFTraceTags::SourceTag(), (nsfEvent->getSource() != NULL) ? nsfEvent->getSource()->getName() : NSFTraceTags::UnknownTag(),
+                        NSFTraceTags::DestinationTag(), nsfEvent->getDestination()->getName());
+                }
+#endif
+
+                // Guard a bad event from taking down event thread
+                try
+                {
+                    nsfEvent->getDestination()->handleEvent(nsfEvent);
+                }
+                catch(const std::exception& exception)
+                {
+                    handleException(std::runtime_error(getName() + " event handling exception: " + exception.what()));
+                }
+                catch(...)
+                {
+                    handleException(std::runtime_error(getName() + " event handling exception: unknown exception"));
+                }
+
+                if (deleteAfterHandling)
+                {
+                    delete nsfEvent;
+                }
+            }
+
+            // Thread loop will exit when terminating and all event handlers are terminated
+            if ((getTerminationStatus() ==  ThreadTerminating) && allEventHandlersTerminated())
+            {
+                clearEvents();
+
+                LOCK(getThreadMutex())
+                {
+                    if (timerQueue != NULL)
+                    {
+                        timerQueue->clear();
+                    }
+                }
+                ENDLOCK;
+
+                return;
+            }
+        }
+    }
+
+    void NSFEventThread::waitForWork()
+    {
+        NSFTime nextExecutionTime = MaxTime;
+
+        LOCK(getThreadMutex())
+        {
+            if (timerQueue != NULL)
+            {
+                nextExecutionTime = timerQueue->getNextExecutionTime();
+            }
+
+            timerWaitTime = nextExecutionTime;
+        }
+        ENDLOCK;
+
+        // Wait for signal to indicate there's work to do, or until the next local timer action is ready
+        if (nextExecutionTime == MaxTime)
+        {
+            signal->wait();
+            return;
+        }
+
+        NSFTime waitTime = nextExecutionTime - NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        if (waitTime > 0)
+        {
+            signal->timedWait(waitTime);
+        }
+    }
+}
@@ -1,132 +1,226 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_EVENT_THREAD_H
-#define NSF_EVENT_THREAD_H
-
-#include "NSFOSThread.h"
-#include "NSFOSSignal.h"
-#include "NSFThread.h"
-
-namespace NorthStateFramework
-{
-    /// <summary>
-    /// Represents a thread that has an event queue and dispatches events to their destinations.
-    /// </summary>
-    class NSFEventThread : public NSFThread
-    {
-        friend class NSFEventHandler;
-        friend class NSFStateMachine;
-
-    public:
-
-        /// <summary>
-        /// Creates an event thread.
-        /// </summary>
-        /// <param name="name">The name of the thread.</param>
-        NSFEventThread(const NSFString& name);
-
-        /// <summary>
-        /// Creates an event thread.
-        /// </summary>
-        /// <param name="name">The name of the thread.</param>
-        /// <param name="priority">The priority of the thread.</param>
-        NSFEventThread(const NSFString& name, int priority);
-
-        /// <summary>
-        /// Destroys an event thread.
-        /// </summary>
-        /// <remarks>
-        /// This destructor will block for a short period until the thread is terminated.
-        /// </remarks>
-        virtual ~NSFEventThread();
-
-        /// <summary>
-        /// Gets a list of event handlers using the thread.
-        /// </summary>
-        /// <returns>
-        /// The list of event handlers using the thread.
-        /// </returns>
-        std::list<INSFEventHandler*> getEventHandlers();
-
-        /// <summary>
-        /// Indicates if the event queue contains an event that matches the specified event.
-        /// </summary>
-        /// <param name="nsfEvent">The event to match.</param>
-        /// <returns>True if the event queue contains a matching event, false otherwise.</returns>
-        /// <remarks>
-        /// Two events match if they have the same id.  Events may be copied to create new events with the same id.
-        /// </remarks>
-        bool hasEvent(NSFEvent* nsfEvent);
-
-        /// <summary>
-        /// Indicates if the event queue contains an event for the specified destination.
-        /// </summary>
-        /// <param name="eventHandler">The event handler destination.</param>
-        /// <returns>True if the event queue contains an event with the specified destination, false otherwise.</returns>
-        bool hasEventFor(INSFEventHandler* eventHandler);
-
-        /// <summary>
-        /// Queues the specified event.
-        /// </summary>
-        /// <param name="nsfEvent">The event to queue.</param>
-        /// <param name="isPriorityEvent">Flag indicating if the event should be queued to the back of the queue (false) or the front of the queue (true).</param>
-        /// <param name="logEventQueued">Flag indicating if an event queued trace should be added to the trace log.</param>
-        /// <remarks>
-        /// Queueing a priority event to a state machine will invalidate its UML run-to-completion semantics.
-        /// Use this feature for custom event handlers only.
-        /// </remarks>
-        void queueEvent(NSFEvent* nsfEvent, bool isPriorityEvent, bool logEventQueued);
-
-        virtual void terminate(bool waitForTerminated);
-
-    protected:
-
-    private:
-
-        std::list<NSFEvent*> nsfEvents;
-        NSFOSSignal* signal;
-        std::list<INSFEventHandler*> eventHandlers;
-
-        /// <summary>
-        /// Adds an event handler to the list of event handlers.
-        /// </summary>
-        void addEventHandler(INSFEventHandler* eventHandler);
-
-        bool allEventHandlersTerminated();
-
-        /// <summary>
-        /// Clears all events in the event list.
-        /// </summary>
-        void clearEvents();
-
-        /// <summary>
-        /// Removes an event handler from the list of event handlers.
-        /// </summary>
-        void removeEventHandler(INSFEventHandler* eventHandler);
-
-        virtual void threadLoop();
-    };
-}
-
-#endif // NSF_EVENT_THREAD_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_EVENT_THREAD_H
+#define NSF_EVENT_THREAD_H
+
+#include "NSFOSThread.h"
+#include "NSFOSSignal.h"
+#include "NSFThread.h"
+#include "NSFTimerQueue.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a thread that has an event queue and dispatches events to their destinations.
+    /// </summary>
+    /// <remarks>
+    /// An event thread can optionally have local timers, so that events scheduled for its event handlers
+    /// expire on the event thread itself, rather than on the primary timer thread.
+    /// </remarks>
+    class NSFEventThread : public NSFThread
+    {
+        friend class NSFEventHandler;
+        friend class NSFStateMachine;
+
+    public:
+
+        /// <summary>
+        /// Creates an event thread.
+        /// </summary>
+        /// <param name="name">The name of the thread.</param>
+        NSFEventThread(const NSFString& name);
+
+        /// <summary>
+        /// Creates an event thread.
+        /// </summary>
+        /// <param name="name">The name of the thread.</param>
+        /// <param name="priority">The priority of the thread.</param>
+        NSFEventThread(const NSFString& name, int priority);
+
+        /// <summary>
+        /// Destroys an event thread.
+        /// </summary>
+        /// <remarks>
+        /// This destructor will block for a short period until the thread is terminated.
+        /// </remarks>
+        virtual ~NSFEventThread();
+
+        /// <summary>
+        /// Gets a list of event handlers using the thread.
+        /// </summary>
+        /// <returns>
+        /// The list of event handlers using the thread.
+        /// </returns>
+        std::list<INSFEventHandler*> getEventHandlers();
+
+        /// <summary>
+        /// Gets the flag indicating if an event handled trace is added to the trace log as each event is handled.
+        /// </summary>
+        bool getEventHandledLoggingEnabled() const { return eventHandledLoggingEnabled; }
+
+        /// <summary>
+        /// Sets the flag indicating if an event handled trace is added to the trace log as each event is handled.
+        /// </summary>
+        /// <param name="value">True to trace handled events, false otherwise.</param>
+        /// <remarks>
+        /// Event handled traces record when the thread starts handling each event, so that, together with event queued traces,
+        /// they show how long events wait in the queue.  They are disabled by default.
+        /// </remarks>
+        void setEventHandledLoggingEnabled(bool value) { eventHandledLoggingEnabled = value; }
+
+        /// <summary>
+        /// Gets the flag indicating if local timers are enabled.
+        /// </summary>
+        bool getLocalTimersEnabled();
+
+        /// <summary>
+        /// Sets the flag indicating if local timers are enabled.
+        /// </summary>
+        /// <param name="value">True to enable local timers, false to disable them.</param>
+        /// <remarks>
+        /// When local timers are enabled, events scheduled for event handlers using the thread are kept in a timer queue owned by the thread,
+        /// and are queued by the thread itself when they expire, without involving the primary timer thread.
+        /// Scheduling is then protected by the thread's own mutex, so threads scheduling timers for different event threads do not contend.
+        /// Local timers should be enabled before events are scheduled for the thread's event handlers.
+        /// When local timers are disabled, actions scheduled locally are moved to the primary timer thread.
+        /// </remarks>
+        void setLocalTimersEnabled(bool value);
+
+        /// <summary>
+        /// Indicates if the event queue contains an event that matches the specified event.
+        /// </summary>
+        /// <param name="nsfEvent">The event to match.</param>
+        /// <returns>True if the event queue contains a matching event, false otherwise.</returns>
+        /// <remarks>
+        /// Two events match if they have the same id.  Events may be copied to create new events with the same id.
+        /// </remarks>
+        bool hasEvent(NSFEvent* nsfEvent);
+
+        /// <summary>
+        /// Indicates if the event queue contains an event for the specified destination.
+        /// </summary>
+        /// <param name="eventHandler">The event handler destination.</param>
+        /// <returns>True if the event queue contains an event with the specified destination, false otherwise.</returns>
+        bool hasEventFor(INSFEventHandler* eventHandler);
+
+        /// <summary>
+        /// Queues the specified event.
+        /// </summary>
+        /// <param name="nsfEvent">The event to queue.</param>
+        /// <param name="isPriorityEvent">Flag indicating if the event should be queued to the back of the queue (false) or the front of the queue (true).</param>
+        /// <param name="logEventQueued">Flag indicating if an event queued trace should be added to the trace log.</param>
+        /// <remarks>
+        /// Queueing a priority event to a state machine will invalidate its UML run-to-completion semantics.
+        /// Use this feature for custom event handlers only.
+        /// </remarks>
+        void queueEvent(NSFEvent* nsfEvent, bool isPriorityEvent, bool logEventQueued);
+
+        /// <summary>
+        /// Checks if an action is scheduled with the thread's local timers.
+        /// </summary>
+        /// <param name="action">The action in question.</param>
+        /// <returns>True if the action is scheduled locally, otherwise false.</returns>
+        bool isScheduled(NSFTimerAction* action);
+
+        /// <summary>
+        /// Schedules an action with the thread's local timers, to execute at its previously designated execution time.
+        /// </summary>
+        /// <param name="action">The action to schedule.</param>
+        /// <remarks>
+        /// The action is scheduled with the primary timer thread if local timers are not enabled.
+        /// </remarks>
+        void scheduleAction(NSFTimerAction* action);
+
+        /// <summary>
+        /// Schedules an action with the thread's local timers.
+        /// </summary>
+        /// <param name="action">The action to schedule.</param>
+        /// <param name="delayTime">The delay time before the action should execute.</param>
+        /// <param name="repeatTime">The repeat time if the action is periodic, or 0 if the action is non-periodic.</param>
+        /// <remarks>
+        /// Times are measured by the primary timer thread's clock.
+        /// The action is scheduled with the primary timer thread if local timers are not enabled.
+        /// </remarks>
+        void scheduleAction(NSFTimerAction* action, NSFTime delayTime, NSFTime repeatTime);
+
+        virtual void terminate(bool waitForTerminated);
+
+        /// <summary>
+        /// Unschedules an action scheduled with the thread's local timers.
+        /// </summary>
+        /// <param name="action">The action to unschedule.</param>
+        /// <remarks>
+        /// Unscheduling an action that is not scheduled locally has no effect.
+        /// </remarks>
+        void unscheduleAction(NSFTimerAction* action);
+
+    protected:
+
+    private:
+
+        std::list<NSFEvent*> nsfEvents;
+        NSFOSSignal* signal;
+        std::list<INSFEventHandler*> eventHandlers;
+        NSFTimerQueue* timerQueue;
+        NSFTime timerWaitTime;
+        bool eventHandledLoggingEnabled;
+
+        /// <summary>
+        /// Adds an event handler to the list of event handlers.
+        /// </summary>
+        void addEventHandler(INSFEventHandler* eventHandler);
+
+        bool allEventHandlersTerminated();
+
+        /// <summary>
+        /// Clears all events in the event list.
+        /// </summary>
+        void clearEvents();
+
+        /// <summary>
+        /// Executes the specified local timer action.
+        /// </summary>
+        /// <param name="action">The action to execute.</param>
+        void executeTimerAction(NSFTimerAction* action);
+
+        /// <summary>
+        /// Indicates if the primary trace log's filter passes traces for an event, by its name and the name of its destination.
+        /// </summary>
+        static bool isEventTraced(NSFEvent* nsfEvent);
+
+        /// <summary>
+        /// Removes an event handler from the list of event handlers.
+        /// </summary>
+        void removeEventHandler(INSFEventHandler* eventHandler);
+
+        /// <summary>
+        /// Waits for the signal indicating there are events to handle, or until the next local timer action is ready.
+        /// </summary>
+        void waitForWork();
+
+        virtual void threadLoop();
+    };
+}
+
+#endif // NSF_EVENT_THREAD_H
@@ -0,0 +1,89 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_EVENT_TIMER_H
+#define NSF_EVENT_TIMER_H
+
+#include "NSFTimerAction.h"
+
+namespace NorthStateFramework
+{
+    class NSFEvent;
+
+    /// <summary>
+    /// Represents the timer action that schedules an event.
+    /// </summary>
+    /// <remarks>
+    /// An event timer is attached to an event the first time the event is scheduled, or one of its timer settings is set,
+    /// so that events which are never scheduled do not carry the timer fields.
+    /// The timer queues its event to the event's destination when it executes, and is deleted with its event.
+    /// </remarks>
+    class NSFEventTimer : public NSFTimerAction
+    {
+    public:
+
+        /// <summary>
+        /// Creates an event timer.
+        /// </summary>
+        /// <param name="nsfEvent">The event scheduled by the timer.</param>
+        NSFEventTimer(NSFEvent* nsfEvent);
+
+        /// <summary>
+        /// Gets the event scheduled by the timer.
+        /// </summary>
+        NSFEvent* getEvent() const { return nsfEvent; }
+
+        /// <summary>
+        /// Gets the name of the timer, which is the name of its event.
+        /// </summary>
+        virtual const NSFString& getName() const;
+
+        /// <summary>
+        /// Sets the name of the timer's event.
+        /// </summary>
+        virtual void setName(const NSFString& value);
+
+    protected:
+
+        /// <summary>
+        /// Gets the destination's event thread if its local timers are enabled.
+        /// </summary>
+        /// <returns>The destination's event thread, or NULL to schedule the event with the primary timer thread.</returns>
+        virtual NSFEventThread* getLocalTimerThread() const;
+
+    private:
+
+        NSFEvent* nsfEvent;
+
+        /// <summary>
+        /// Callback method supporting NSFTimerAction interface.
+        /// </summary>
+        /// <remarks>
+        /// This method is called by the NSFTimerThread, or by the destination's event thread if its local timers are enabled,
+        /// to queue the event at the scheduled time.
+        /// </remarks>
+        virtual void execute();
+    };
+}
+
+#endif // NSF_EVENT_TIMER_H
@@ -1,41 +1,41 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "NSFForkJoinTransition.h"
-
-#include "NSFForkJoin.h"
-
-namespace NorthStateFramework
-{
-    // Public
-
-    NSFForkJoinTransition::NSFForkJoinTransition(const NSFString& name, NSFForkJoin* source, NSFForkJoin* target, NSFRegion* region, const NSFVoidAction<NSFStateMachineContext>& action)
-        : NSFExternalTransition(name, source, target, NULL, NULL, action), forkJoinRegion(region)
-    {
-    }
-
-    NSFForkJoinTransition::NSFForkJoinTransition(const NSFString& name, NSFForkJoin* source, NSFForkJoin* target, NSFRegion* region, const NSFVoidAction<NSFStateMachineContext>* action)
-        : NSFExternalTransition(name, source, target, NULL, NULL, action), forkJoinRegion(region)
-    {
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFForkJoinTransition.h"
+
+#include "NSFForkJoin.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFForkJoinTransition::NSFForkJoinTransition(const NSFString& name, NSFForkJoin* source, NSFForkJoin* target, NSFRegion* region, const NSFVoidAction<NSFStateMachineContext>& action)
+        : NSFExternalTransition(name, source, target, NULL, NULL, action), forkJoinRegion(region)
+    {
+    }
+
+    NSFForkJoinTransition::NSFForkJoinTransition(const NSFString& name, NSFForkJoin* source, NSFForkJoin* target, NSFRegion* region, const NSFVoidAction<NSFStateMachineContext>* action)
+        : NSFExternalTransition(name, source, target, NULL, NULL, action), forkJoinRegion(region)
+    {
+    }
+}
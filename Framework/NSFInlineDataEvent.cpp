@@ -0,0 +1,51 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFInlineDataEvent.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFInlineDataEvent::NSFInlineDataEvent(const NSFString& name, INSFEventHandler* parent)
+        : NSFEvent(name, parent), dataType(NULL)
+    {
+    }
+
+    NSFInlineDataEvent::NSFInlineDataEvent(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination)
+        : NSFEvent(name, source, destination), dataType(NULL)
+    {
+    }
+
+    NSFInlineDataEvent::NSFInlineDataEvent(const NSFInlineDataEvent& nsfEvent)
+        : NSFEvent(nsfEvent), dataType(nsfEvent.dataType), data(nsfEvent.data)
+    {
+    }
+
+    NSFEvent* NSFInlineDataEvent::copy(bool deleteAfterHandling)
+    {
+        NSFEvent* eventCopy = new NSFInlineDataEvent(*this);
+        eventCopy->setDeleteAfterHandling(deleteAfterHandling);
+        return eventCopy;
+    }
+}
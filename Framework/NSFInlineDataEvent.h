@@ -0,0 +1,213 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_INLINE_DATA_EVENT_H
+#define NSF_INLINE_DATA_EVENT_H
+
+#include "NSFEvent.h"
+#include "NSFEventPool.h"
+
+#include <new>
+#include <stdexcept>
+
+#if defined NSF_MOVE_SEMANTICS
+#include <type_traits>
+#endif
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents an event that carries a small data payload inline, in fixed-size storage within the event.
+    /// </summary>
+    /// <remarks>
+    /// The payload may be of any trivially copyable type, such as an id, a counter, an enumeration, or a small structure,
+    /// whose size is at most DataCapacity bytes and whose alignment is at most 8 bytes.
+    /// The event records the type of its payload, and the data accessors throw an exception if a different type is requested.
+    /// Unlike NSFDataEvent, a single class serves every payload type, so all inline data events share one event pool,
+    /// and copying an event copies its payload as a block of bytes.
+    /// </remarks>
+    class NSFInlineDataEvent : public NSFEvent
+    {
+    public:
+
+        /// <summary>
+        /// The maximum size of a payload in bytes.
+        /// </summary>
+        static const UInt32 DataCapacity = 32;
+
+        /// <summary>
+        /// Creates an inline data event without a payload.
+        /// </summary>
+        /// <param name="name">The name of the event.</param>
+        /// <param name="parent">The parent of the event.</param>
+        /// <remarks>
+        /// The event source and destination will be set to the parent.
+        /// </remarks>
+        NSFInlineDataEvent(const NSFString& name, INSFEventHandler* parent);
+
+        /// <summary>
+        /// Creates an inline data event without a payload.
+        /// </summary>
+        /// <param name="name">The name of the event.</param>
+        /// <param name="source">The source of the event.</param>
+        /// <param name="destination">The destination of the event.</param>
+        NSFInlineDataEvent(const NSFString& name, INSFNamedObject* source, INSFEventHandler* destination);
+
+        /// <summary>
+        /// Creates an inline data event.
+        /// </summary>
+        /// <param name="nsfEvent">The event to copy.</param>
+        NSFInlineDataEvent(const NSFInlineDataEvent& nsfEvent);
+
+        /// <summary>
+        /// Gets the data payload.
+        /// </summary>
+        /// <returns>The data payload.</returns>
+        /// <remarks>
+        /// An exception is thrown if the payload is not of the requested type.
+        /// </remarks>
+        template<class DataType>
+        const DataType& getData() const
+        {
+            if (!hasData<DataType>())
+            {
+                throw std::runtime_error(getName() + " inline data event does not have a payload of the requested type");
+            }
+
+            return *reinterpret_cast<const DataType*>(data.bytes);
+        }
+
+        /// <summary>
+        /// Sets the data payload.
+        /// </summary>
+        /// <param name="value">The value for the data payload.</param>
+        /// <remarks>
+        /// The payload size is checked at compile time, and when compiled as C++11 or later, so is the payload type.
+        /// </remarks>
+        template<class DataType>
+        void setData(const DataType& value)
+        {
+            checkDataType<DataType>();
+            new (data.bytes) DataType(value);
+            dataType = getDataType<DataType>();
+        }
+
+        /// <summary>
+        /// Indicates if the event has a payload of the specified type.
+        /// </summary>
+        template<class DataType>
+        bool hasData() const { return (dataType == getDataType<DataType>()); }
+
+        /// <summary>
+        /// Indicates if the event has a payload of any type.
+        /// </summary>
+        bool hasData() const { return (dataType != NULL); }
+
+        /// <summary>
+        /// Removes the data payload.
+        /// </summary>
+        void clearData() { dataType = NULL; }
+
+        /// <summary>
+        /// Creates a copy.
+        /// </summary>
+        /// <param name="deleteAfterHandling">Flag indicating if the event should be deleted after handled by an event handler.</param>
+        /// <returns>A copy of the event.</returns>
+        virtual NSFEvent* copy(bool deleteAfterHandling);
+
+        /// <summary>
+        /// Creates a copy, replacing its data payload.
+        /// </summary>
+        /// <param name="deleteAfterHandling">Flag indicating if the event should be deleted after handled by an event handler.</param>
+        /// <param name="value">The new data for the copy.</param>
+        /// <returns>A copy of the event.</returns>
+        template<class DataType>
+        NSFInlineDataEvent* copy(bool deleteAfterHandling, const DataType& value)
+        {
+            NSFInlineDataEvent* eventCopy = new NSFInlineDataEvent(*this);
+            eventCopy->setData(value);
+            eventCopy->setDeleteAfterHandling(deleteAfterHandling);
+            return eventCopy;
+        }
+
+        /// <summary>
+        /// Allocates memory for an inline data event from the event pool.
+        /// </summary>
+        static void* operator new(size_t size) { return NSFEventPool<NSFInlineDataEvent>::allocate(size); }
+
+        /// <summary>
+        /// Returns the memory of an inline data event to the event pool.
+        /// </summary>
+        static void operator delete(void* memory, size_t size) { NSFEventPool<NSFInlineDataEvent>::release(memory, size); }
+
+    private:
+
+        /// <summary>
+        /// Identifies the type of a payload by the address of a static unique to the type.
+        /// </summary>
+        typedef const void* DataTypeId;
+
+        /// <summary>
+        /// Storage for the payload, aligned for any 8 byte aligned type.
+        /// </summary>
+        union DataStorage
+        {
+            UInt8 bytes[DataCapacity];
+            UInt64 integerAlignment;
+            double floatingPointAlignment;
+            void* pointerAlignment;
+        };
+
+        DataTypeId dataType;
+        DataStorage data;
+
+        /// <summary>
+        /// Checks that a payload type can be stored inline, failing to compile if it cannot.
+        /// </summary>
+        template<class DataType>
+        static void checkDataType()
+        {
+#if defined NSF_MOVE_SEMANTICS
+            static_assert(sizeof(DataType) <= DataCapacity, "Inline data event payload is larger than DataCapacity");
+            static_assert(alignof(DataType) <= alignof(DataStorage), "Inline data event payload alignment is larger than 8 bytes");
+            static_assert(std::is_trivially_copyable<DataType>::value, "Inline data event payload is not trivially copyable");
+#else
+            // An array of negative size fails to compile
+            (void)sizeof(char[(sizeof(DataType) <= DataCapacity) ? 1 : -1]);
+#endif
+        }
+
+        /// <summary>
+        /// Gets the id of a payload type.
+        /// </summary>
+        template<class DataType>
+        static DataTypeId getDataType()
+        {
+            // Not const, so that identical code folding or constant merging cannot give two types the same address
+            static char dataTypeId = 0;
+            return &dataTypeId;
+        }
+    };
+}
+
+#endif // NSF_INLINE_DATA_EVENT_H
@@ -1,90 +1,90 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_INTERNAL_TRANSITION_H
-#define NSF_INTERNAL_TRANSITION_H
-
-#include "NSFTransition.h"
-
-namespace NorthStateFramework
-{
-    /// <summary>
-    /// Represents an internal state transition.
-    /// </summary>
-    /// <remarks>
-    /// Transitions may specify event triggers, guards, and/or actions.
-    /// Internal transitions do not exit or enter any states.  They are simply reactions to events.
-    /// </remarks>
-    class NSFInternalTransition : public NSFTransition
-    {
-    public:
-
-        /// <summary>
-        /// Creates an internal transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="state">Transition state.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>& action);
-
-        /// <summary>
-        /// Creates an internal transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="state">Transition state.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>& action);
-
-        /// <summary>
-        /// Creates an internal transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="state">Transition state.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>* action);
-
-        /// <summary>
-        /// Creates an internal transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="state">Transition state.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>* action);
-
-    protected:
-
-        virtual void fireTransition(NSFStateMachineContext& context);
-
-        virtual void setSource(NSFState* source);
-    };
-}
-
-#endif // NSF_INTERNAL_TRANSITION_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_INTERNAL_TRANSITION_H
+#define NSF_INTERNAL_TRANSITION_H
+
+#include "NSFTransition.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents an internal state transition.
+    /// </summary>
+    /// <remarks>
+    /// Transitions may specify event triggers, guards, and/or actions.
+    /// Internal transitions do not exit or enter any states.  They are simply reactions to events.
+    /// </remarks>
+    class NSFInternalTransition : public NSFTransition
+    {
+    public:
+
+        /// <summary>
+        /// Creates an internal transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="state">Transition state.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>& action);
+
+        /// <summary>
+        /// Creates an internal transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="state">Transition state.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>& action);
+
+        /// <summary>
+        /// Creates an internal transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="state">Transition state.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>* action);
+
+        /// <summary>
+        /// Creates an internal transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="state">Transition state.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFInternalTransition(const NSFString& name, NSFState* state, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>* action);
+
+    protected:
+
+        virtual void fireTransition(NSFStateMachineContext& context);
+
+        virtual void setSource(NSFState* source);
+    };
+}
+
+#endif // NSF_INTERNAL_TRANSITION_H
@@ -1,103 +1,103 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_LOCAL_TRANSITION_H
-#define NSF_LOCAL_TRANSITION_H
-
-#include "NSFTransition.h"
-
-namespace NorthStateFramework
-{
-    /// <summary>
-    /// Represents a local state transition.
-    /// </summary>
-    /// <remarks>
-    /// Transitions may specify event triggers, guards, and/or actions.
-    /// Local transitions do not exit their source state.
-    /// </remarks>
-    class NSFLocalTransition : public NSFTransition
-    {
-    public:
-
-        /// <summary>
-        /// Creates a local transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="source">Transition source.</param>
-        /// <param name="target">Transition target.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>& action);
-
-        /// <summary>
-        /// Creates a local transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="source">Transition source.</param>
-        /// <param name="target">Transition target.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>& action);
-
-        /// <summary>
-        /// Creates a local transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="source">Transition source.</param>
-        /// <param name="target">Transition target.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>* action);
-
-        /// <summary>
-        /// Creates a local transition.
-        /// </summary>
-        /// <param name="name">User assigned name for transition.</param>
-        /// <param name="source">Transition source.</param>
-        /// <param name="target">Transition target.</param>
-        /// <param name="trigger">Transition trigger.</param>
-        /// <param name="guard">Transition guard.</param>
-        /// <param name="action">Transition action.</param>
-        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>* action);
-
-    protected:
-
-        virtual void fireTransition(NSFStateMachineContext& context);
-
-        virtual void setSource(NSFState* source);
-
-    private:
-
-        NSFCompositeState* compositeSource;
-
-        /// <summary>
-        /// Performs common construction behaviors.
-        /// </summary>
-        void construct();
-    };
-}
-
-#endif // NSF_LOCAL_TRANSITION_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_LOCAL_TRANSITION_H
+#define NSF_LOCAL_TRANSITION_H
+
+#include "NSFTransition.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a local state transition.
+    /// </summary>
+    /// <remarks>
+    /// Transitions may specify event triggers, guards, and/or actions.
+    /// Local transitions do not exit their source state.
+    /// </remarks>
+    class NSFLocalTransition : public NSFTransition
+    {
+    public:
+
+        /// <summary>
+        /// Creates a local transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="source">Transition source.</param>
+        /// <param name="target">Transition target.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>& action);
+
+        /// <summary>
+        /// Creates a local transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="source">Transition source.</param>
+        /// <param name="target">Transition target.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>& action);
+
+        /// <summary>
+        /// Creates a local transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="source">Transition source.</param>
+        /// <param name="target">Transition target.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>& guard, const NSFVoidAction<NSFStateMachineContext>* action);
+
+        /// <summary>
+        /// Creates a local transition.
+        /// </summary>
+        /// <param name="name">User assigned name for transition.</param>
+        /// <param name="source">Transition source.</param>
+        /// <param name="target">Transition target.</param>
+        /// <param name="trigger">Transition trigger.</param>
+        /// <param name="guard">Transition guard.</param>
+        /// <param name="action">Transition action.</param>
+        NSFLocalTransition(const NSFString& name, NSFCompositeState* source, NSFState* target, NSFEvent* trigger, const NSFBoolGuard<NSFStateMachineContext>* guard, const NSFVoidAction<NSFStateMachineContext>* action);
+
+    protected:
+
+        virtual void fireTransition(NSFStateMachineContext& context);
+
+        virtual void setSource(NSFState* source);
+
+    private:
+
+        NSFCompositeState* compositeSource;
+
+        /// <summary>
+        /// Performs common construction behaviors.
+        /// </summary>
+        void construct();
+    };
+}
+
+#endif // NSF_LOCAL_TRANSITION_H
@@ -0,0 +1,214 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFPassivationManager.h"
+
+#include "NSFTimerThread.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( push )
+#pragma warning( disable : 4355 )
+#endif
+
+    NSFPassivationManager::NSFPassivationManager(const NSFString& name, NSFEventThread* thread)
+        : NSFTaggedObject(name), managerMutex(NSFOSMutex::create()), maxLiveStateMachines(0), maxIdleTime(60000 * TimeUnitsPerMilliSecond),
+        evictionAction(name + "Eviction", NSFAction(this, &NSFPassivationManager::runEviction), thread)
+    {
+    }
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( pop )
+#endif
+
+    NSFPassivationManager::~NSFPassivationManager()
+    {
+        evictionAction.unschedule();
+        delete managerMutex;
+    }
+
+    UInt32 NSFPassivationManager::getMaxLiveStateMachines()
+    {
+        LOCK(managerMutex)
+        {
+            return maxLiveStateMachines;
+        }
+        ENDLOCK;
+    }
+
+    void NSFPassivationManager::setMaxLiveStateMachines(UInt32 value)
+    {
+        LOCK(managerMutex)
+        {
+            maxLiveStateMachines = value;
+        }
+        ENDLOCK;
+    }
+
+    NSFTime NSFPassivationManager::getMaxIdleTime()
+    {
+        LOCK(managerMutex)
+        {
+            return maxIdleTime;
+        }
+        ENDLOCK;
+    }
+
+    void NSFPassivationManager::setMaxIdleTime(NSFTime value)
+    {
+        LOCK(managerMutex)
+        {
+            maxIdleTime = value;
+        }
+        ENDLOCK;
+    }
+
+    void NSFPassivationManager::addProxy(NSFStateMachineProxy* proxy)
+    {
+        LOCK(managerMutex)
+        {
+            // Add proxy if not already in list
+            if (std::find(proxies.begin(), proxies.end(), proxy) == proxies.end())
+            {
+                proxies.push_back(proxy);
+            }
+        }
+        ENDLOCK;
+    }
+
+    void NSFPassivationManager::removeProxy(NSFStateMachineProxy* proxy)
+    {
+        LOCK(managerMutex)
+        {
+            proxies.remove(proxy);
+        }
+        ENDLOCK;
+    }
+
+    void NSFPassivationManager::evict()
+    {
+        LOCK(managerMutex)
+        {
+            NSFTime currentTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+            std::list<NSFStateMachineProxy*> liveProxies;
+
+            // Passivate idle state machines
+            std::list<NSFStateMachineProxy*>::iterator proxyIterator;
+            for (proxyIterator = proxies.begin(); proxyIterator != proxies.end(); ++proxyIterator)
+            {
+                if ((*proxyIterator)->isPassivated())
+                {
+                    continue;
+                }
+
+                if ((currentTime - (*proxyIterator)->getLastEventTime()) >= maxIdleTime)
+                {
+                    (*proxyIterator)->passivate();
+                }
+                else
+                {
+                    liveProxies.push_back(*proxyIterator);
+                }
+            }
+
+            // Passivate least recently used state machines beyond the limit
+            if ((maxLiveStateMachines == 0) || (liveProxies.size() <= maxLiveStateMachines))
+            {
+                return;
+            }
+
+            liveProxies.sort(isLessRecentlyUsed);
+
+            std::list<NSFStateMachineProxy*>::size_type excessCount = liveProxies.size() - maxLiveStateMachines;
+            for (proxyIterator = liveProxies.begin(); excessCount > 0; ++proxyIterator, --excessCount)
+            {
+                (*proxyIterator)->passivate();
+            }
+        }
+        ENDLOCK;
+    }
+
+    UInt64 NSFPassivationManager::getBytesSaved()
+    {
+        UInt64 bytesSaved = 0;
+
+        LOCK(managerMutex)
+        {
+            std::list<NSFStateMachineProxy*>::iterator proxyIterator;
+            for (proxyIterator = proxies.begin(); proxyIterator != proxies.end(); ++proxyIterator)
+            {
+                bytesSaved += (*proxyIterator)->getBytesSaved();
+            }
+        }
+        ENDLOCK;
+
+        return bytesSaved;
+    }
+
+    UInt32 NSFPassivationManager::getPassivatedCount()
+    {
+        UInt32 passivatedCount = 0;
+
+        LOCK(managerMutex)
+        {
+            std::list<NSFStateMachineProxy*>::iterator proxyIterator;
+            for (proxyIterator = proxies.begin(); proxyIterator != proxies.end(); ++proxyIterator)
+            {
+                if ((*proxyIterator)->isPassivated())
+                {
+                    ++passivatedCount;
+                }
+            }
+        }
+        ENDLOCK;
+
+        return passivatedCount;
+    }
+
+    void NSFPassivationManager::startEviction(NSFTime period)
+    {
+        evictionAction.schedule(period, period);
+    }
+
+    void NSFPassivationManager::stopEviction()
+    {
+        evictionAction.unschedule();
+    }
+
+    // Private
+
+    bool NSFPassivationManager::isLessRecentlyUsed(NSFStateMachineProxy* proxy1, NSFStateMachineProxy* proxy2)
+    {
+        return (proxy1->getLastEventTime() < proxy2->getLastEventTime());
+    }
+
+    void NSFPassivationManager::runEviction(const NSFContext&)
+    {
+        evict();
+    }
+}
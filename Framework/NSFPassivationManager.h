@@ -0,0 +1,140 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_PASSIVATION_MANAGER_H
+#define NSF_PASSIVATION_MANAGER_H
+
+#include "NSFScheduledAction.h"
+#include "NSFStateMachineProxy.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents an eviction policy that passivates idle state machines behind a set of state machine proxies.
+    /// </summary>
+    /// <remarks>
+    /// Each time eviction runs, every state machine that has not received an event for longer than the maximum idle time is passivated.
+    /// If a maximum number of live state machines is specified, the least recently used state machines beyond that number are passivated as well.
+    /// Eviction can be run periodically on the manager's thread, or on demand with evict().
+    /// </remarks>
+    class NSFPassivationManager : public NSFTaggedObject
+    {
+    public:
+
+        /// <summary>
+        /// Creates a passivation manager.
+        /// </summary>
+        /// <param name="name">The name of the passivation manager.</param>
+        /// <param name="thread">The thread on which periodic eviction runs.</param>
+        NSFPassivationManager(const NSFString& name, NSFEventThread* thread);
+
+        /// <summary>
+        /// Destroys a passivation manager.
+        /// </summary>
+        /// <remarks>
+        /// The managed proxies are not deleted.
+        /// </remarks>
+        ~NSFPassivationManager();
+
+        /// <summary>
+        /// Gets the maximum number of live state machines, or zero if there is no limit.
+        /// </summary>
+        UInt32 getMaxLiveStateMachines();
+
+        /// <summary>
+        /// Sets the maximum number of live state machines, or zero if there is no limit.
+        /// </summary>
+        void setMaxLiveStateMachines(UInt32 value);
+
+        /// <summary>
+        /// Gets the time a state machine may be idle before it is passivated.
+        /// </summary>
+        /// <remarks>
+        /// The default is one minute.
+        /// </remarks>
+        NSFTime getMaxIdleTime();
+
+        /// <summary>
+        /// Sets the time a state machine may be idle before it is passivated.
+        /// </summary>
+        void setMaxIdleTime(NSFTime value);
+
+        /// <summary>
+        /// Adds a proxy to the set of managed proxies.
+        /// </summary>
+        /// <param name="proxy">The proxy to add.</param>
+        void addProxy(NSFStateMachineProxy* proxy);
+
+        /// <summary>
+        /// Removes a proxy from the set of managed proxies.
+        /// </summary>
+        /// <param name="proxy">The proxy to remove.</param>
+        void removeProxy(NSFStateMachineProxy* proxy);
+
+        /// <summary>
+        /// Requests passivation of the state machines selected by the eviction policy.
+        /// </summary>
+        void evict();
+
+        /// <summary>
+        /// Gets the total memory saved by passivation, in bytes.
+        /// </summary>
+        UInt64 getBytesSaved();
+
+        /// <summary>
+        /// Gets the number of managed state machines that are currently passivated.
+        /// </summary>
+        UInt32 getPassivatedCount();
+
+        /// <summary>
+        /// Starts periodic eviction.
+        /// </summary>
+        /// <param name="period">The time between evictions.</param>
+        void startEviction(NSFTime period);
+
+        /// <summary>
+        /// Stops periodic eviction.
+        /// </summary>
+        void stopEviction();
+
+    private:
+
+        NSFOSMutex* managerMutex;
+        std::list<NSFStateMachineProxy*> proxies;
+        UInt32 maxLiveStateMachines;
+        NSFTime maxIdleTime;
+        NSFScheduledAction evictionAction;
+
+        /// <summary>
+        /// Orders proxies from least to most recently used.
+        /// </summary>
+        static bool isLessRecentlyUsed(NSFStateMachineProxy* proxy1, NSFStateMachineProxy* proxy2);
+
+        /// <summary>
+        /// Runs eviction from the periodic eviction action.
+        /// </summary>
+        void runEviction(const NSFContext& context);
+    };
+}
+
+#endif // NSF_PASSIVATION_MANAGER_H
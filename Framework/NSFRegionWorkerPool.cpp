@@ -0,0 +1,265 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFRegionWorkerPool.h"
+
+#include "NSFRegion.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFRegionWorkerPool::NSFRegionWorkerPool(const NSFString& name, int numberOfThreads)
+        : NSFTaggedObject(name), workerPoolMutex(NSFOSMutex::create()), stateChangeActionMutex(NSFOSMutex::create())
+    {
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads.push_back(new WorkerThread(name + toString(i), this));
+        }
+    }
+
+    NSFRegionWorkerPool::~NSFRegionWorkerPool()
+    {
+        std::vector<WorkerThread*>::iterator workerThreadIterator;
+        for (workerThreadIterator = workerThreads.begin(); workerThreadIterator != workerThreads.end(); ++workerThreadIterator)
+        {
+            delete *workerThreadIterator;
+        }
+
+        std::vector<NSFOSSignal*>::iterator signalIterator;
+        for (signalIterator = completionSignals.begin(); signalIterator != completionSignals.end(); ++signalIterator)
+        {
+            delete *signalIterator;
+        }
+
+        delete workerPoolMutex;
+        delete stateChangeActionMutex;
+    }
+
+    // Private
+
+    NSFRegionWorkerPool::WorkerThread::WorkerThread(const NSFString& name, NSFRegionWorkerPool* workerPool)
+        : NSFThread(name), workerPool(workerPool), signal(NSFOSSignal::create(name))
+    {
+        startThread();
+    }
+
+    NSFRegionWorkerPool::WorkerThread::~WorkerThread()
+    {
+        terminate(true);
+        delete signal;
+    }
+
+    void NSFRegionWorkerPool::WorkerThread::terminate(bool waitForTerminated)
+    {
+        // Base class behavior, but return immediately so signal can be sent to wake up thread
+        NSFThread::terminate(false);
+
+        signal->send();
+
+        // Wait as specified for thread to terminate after signal has been sent
+        NSFThread::terminate(waitForTerminated);
+    }
+
+    void NSFRegionWorkerPool::WorkerThread::wake()
+    {
+        signal->send();
+    }
+
+    void NSFRegionWorkerPool::WorkerThread::threadLoop()
+    {
+        while (true)
+        {
+            // Wait for signal to indicate there's work to do
+            signal->wait();
+
+            if (getTerminationStatus() == ThreadTerminating)
+            {
+                return;
+            }
+
+            while (workerPool->runNextJob(NULL))
+            {
+            }
+        }
+    }
+
+    NSFEventStatus NSFRegionWorkerPool::processEvent(const std::vector<NSFRegion*>& regions, NSFEvent* nsfEvent)
+    {
+        RegionBatch batch;
+        batch.nsfEvent = nsfEvent;
+        batch.jobs.resize(regions.size());
+        batch.nextJob = 0;
+        batch.remainingJobs = regions.size();
+
+        for (std::vector<RegionJob>::size_type i = 0; i < batch.jobs.size(); ++i)
+        {
+            batch.jobs[i].region = regions[i];
+            batch.jobs[i].eventStatus = NSFEventUnhandled;
+            batch.jobs[i].exceptionCaught = false;
+        }
+
+        LOCK(workerPoolMutex)
+        {
+            // Reuse a completion signal left by an earlier batch, keeping one for each thread dispatching concurrently
+            if (completionSignals.empty())
+            {
+                batch.completionSignal = NSFOSSignal::create(getName());
+            }
+            else
+            {
+                batch.completionSignal = completionSignals.back();
+                completionSignals.pop_back();
+
+                // Clear the signal before any worker can complete a job, as it is left set if an earlier batch completed without waiting for it
+                batch.completionSignal->clear();
+            }
+
+            batches.push_back(&batch);
+        }
+        ENDLOCK;
+
+        // Wake only as many workers as there are jobs left for them, since this thread takes the first job
+        std::vector<WorkerThread*>::size_type wakeCount = std::min(workerThreads.size(), batch.jobs.size() - 1);
+        for (std::vector<WorkerThread*>::size_type i = 0; i < wakeCount; ++i)
+        {
+            workerThreads[i]->wake();
+        }
+
+        // Take part in the work until no jobs are left to claim
+        while (runNextJob(&batch))
+        {
+        }
+
+        // Wait for jobs claimed by workers to complete
+        bool jobsComplete = false;
+        LOCK(workerPoolMutex)
+        {
+            jobsComplete = (batch.remainingJobs == 0);
+        }
+        ENDLOCK;
+
+        if (!jobsComplete)
+        {
+            batch.completionSignal->wait();
+        }
+
+        // The last job sent the signal before the batch was seen to be complete, so no further sends can occur
+        LOCK(workerPoolMutex)
+        {
+            completionSignals.push_back(batch.completionSignal);
+        }
+        ENDLOCK;
+
+        // Combine results in region order, as with sequential processing
+        NSFEventStatus eventStatus = NSFEventUnhandled;
+
+        std::vector<RegionJob>::iterator jobIterator;
+        for (jobIterator = batch.jobs.begin(); jobIterator != batch.jobs.end(); ++jobIterator)
+        {
+            if (jobIterator->exceptionCaught)
+            {
+#if defined NSF_EXCEPTION_PROPAGATION
+                std::rethrow_exception(jobIterator->exception);
+#else
+                throw std::runtime_error(jobIterator->exceptionMessage);
+#endif
+            }
+
+            if (jobIterator->eventStatus == NSFEventHandled)
+            {
+                eventStatus = NSFEventHandled;
+            }
+        }
+
+        return eventStatus;
+    }
+
+    bool NSFRegionWorkerPool::runNextJob(RegionBatch* batch)
+    {
+        RegionJob* job = NULL;
+
+        LOCK(workerPoolMutex)
+        {
+            if (batch == NULL)
+            {
+                if (batches.empty())
+                {
+                    return false;
+                }
+
+                batch = batches.front();
+            }
+
+            if (batch->nextJob >= batch->jobs.size())
+            {
+                return false;
+            }
+
+            job = &batch->jobs[batch->nextJob];
+
+            // Remove batch once all its jobs are claimed, so that workers look no further at it
+            if (++batch->nextJob == batch->jobs.size())
+            {
+                batches.remove(batch);
+            }
+        }
+        ENDLOCK;
+
+        try
+        {
+            job->eventStatus = job->region->processEvent(batch->nsfEvent);
+        }
+#if defined NSF_EXCEPTION_PROPAGATION
+        catch(...)
+        {
+            // The exception is rethrown with its original type on the thread waiting for the batch
+            job->exceptionCaught = true;
+            job->exception = std::current_exception();
+        }
+#else
+        catch(const std::exception& exception)
+        {
+            job->exceptionCaught = true;
+            job->exceptionMessage = exception.what();
+        }
+        catch(...)
+        {
+            job->exceptionCaught = true;
+            job->exceptionMessage = job->region->getName() + " region event processing exception: unknown exception";
+        }
+#endif
+
+        LOCK(workerPoolMutex)
+        {
+            // The signal is sent while locked, because the batch may be deleted as soon as its last job is complete
+            if (--batch->remainingJobs == 0)
+            {
+                batch->completionSignal->send();
+            }
+        }
+        ENDLOCK;
+
+        return true;
+    }
+}
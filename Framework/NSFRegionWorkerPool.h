@@ -0,0 +1,158 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_REGION_WORKER_POOL_H
+#define NSF_REGION_WORKER_POOL_H
+
+#include "NSFEventHandler.h"
+#include "NSFOSSignal.h"
+#include "NSFStateMachineTypes.h"
+#include "NSFThread.h"
+
+#include <vector>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a pool of worker threads used to process an event in independent regions concurrently.
+    /// </summary>
+    /// <remarks>
+    /// The state machine's thread takes part in the work, and does not continue until every region has processed the event,
+    /// so the resulting event status and configuration are the same as when the regions process the event one after another.
+    /// Events queued by actions in independent regions may be queued in a different order than with sequential processing.
+    /// State change actions are executed one at a time, but may also execute in a different order.
+    /// See <see cref="NSFRegion::setIndependent"/> and <see cref="NSFStateMachine::setRegionWorkerPool"/>.
+    /// </remarks>
+    class NSFRegionWorkerPool : public NSFTaggedObject
+    {
+    public:
+
+        friend class NSFCompositeState;
+        friend class NSFStateMachine;
+
+        /// <summary>
+        /// Creates a region worker pool.
+        /// </summary>
+        /// <param name="name">The name of the worker pool.</param>
+        /// <param name="numberOfThreads">The number of worker threads.</param>
+        /// <remarks>
+        /// Since the state machine's thread takes part in the work, one less than the number of independent regions is typically sufficient.
+        /// </remarks>
+        NSFRegionWorkerPool(const NSFString& name, int numberOfThreads);
+
+        /// <summary>
+        /// Destroys a region worker pool.
+        /// </summary>
+        /// <remarks>
+        /// This destructor will block for a short period until the worker threads are terminated.
+        /// </remarks>
+        ~NSFRegionWorkerPool();
+
+        /// <summary>
+        /// Gets the number of worker threads.
+        /// </summary>
+        int getNumberOfThreads() const { return (int)workerThreads.size(); }
+
+    private:
+
+        /// <summary>
+        /// Represents a worker thread in the pool.
+        /// </summary>
+        class WorkerThread : public NSFThread
+        {
+        public:
+
+            WorkerThread(const NSFString& name, NSFRegionWorkerPool* workerPool);
+
+            ~WorkerThread();
+
+            virtual void terminate(bool waitForTerminated);
+
+            /// <summary>
+            /// Wakes the thread to look for work.
+            /// </summary>
+            void wake();
+
+        private:
+
+            NSFRegionWorkerPool* workerPool;
+            NSFOSSignal* signal;
+
+            virtual void threadLoop();
+        };
+
+        /// <summary>
+        /// Represents the processing of an event by one region.
+        /// </summary>
+        struct RegionJob
+        {
+            NSFRegion* region;
+            NSFEventStatus eventStatus;
+            bool exceptionCaught;
+#if defined NSF_EXCEPTION_PROPAGATION
+            std::exception_ptr exception;
+#else
+            NSFString exceptionMessage;
+#endif
+        };
+
+        /// <summary>
+        /// Represents the processing of an event by a group of regions.
+        /// </summary>
+        struct RegionBatch
+        {
+            NSFEvent* nsfEvent;
+            std::vector<RegionJob> jobs;
+            std::vector<RegionJob>::size_type nextJob;
+            std::vector<RegionJob>::size_type remainingJobs;
+            NSFOSSignal* completionSignal;
+        };
+
+        NSFOSMutex* workerPoolMutex;
+        std::list<RegionBatch*> batches;
+        std::vector<NSFOSSignal*> completionSignals;
+        std::vector<WorkerThread*> workerThreads;
+        NSFOSMutex* stateChangeActionMutex;
+
+        /// <summary>
+        /// Processes an event in each of the specified regions concurrently, and waits for all to complete.
+        /// </summary>
+        /// <param name="regions">The regions to process the event.</param>
+        /// <param name="nsfEvent">The event to process.</param>
+        /// <returns>NSFEventHandled if any region handled the event, otherwise NSFEventUnhandled.</returns>
+        /// <remarks>
+        /// If processing throws an exception in any region, the exception from the first such region is rethrown after all regions complete.
+        /// Where exceptions cannot be carried between threads, a std::runtime_error with the exception's message is thrown instead.
+        /// </remarks>
+        NSFEventStatus processEvent(const std::vector<NSFRegion*>& regions, NSFEvent* nsfEvent);
+
+        /// <summary>
+        /// Runs the next unclaimed job.
+        /// </summary>
+        /// <param name="batch">The batch from which to take the job, or NULL to take a job from any batch.</param>
+        /// <returns>True if a job was run, false if there were no unclaimed jobs.</returns>
+        bool runNextJob(RegionBatch* batch);
+    };
+}
+
+#endif // NSF_REGION_WORKER_POOL_H
@@ -0,0 +1,187 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFStateMachineConfiguration.h"
+
+#include "NSFCompositeState.h"
+#include "NSFForkJoin.h"
+#include "NSFRegion.h"
+
+#include <stdexcept>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFStateMachineConfiguration::NSFStateMachineConfiguration()
+        : readPosition(0)
+    {
+    }
+
+    void NSFStateMachineConfiguration::setData(const std::vector<UInt8>& value)
+    {
+        data = value;
+        readPosition = 0;
+    }
+
+    void NSFStateMachineConfiguration::clear()
+    {
+        std::vector<UInt8>().swap(data);
+        readPosition = 0;
+    }
+
+    // Private
+
+    void NSFStateMachineConfiguration::indexStates(NSFCompositeState* state)
+    {
+        states.clear();
+        stateIndices.clear();
+
+        addState(NSFState::getNullState());
+        addState(state);
+    }
+
+    void NSFStateMachineConfiguration::addState(NSFState* state)
+    {
+        stateIndices[state] = (UInt32)states.size();
+        states.push_back(state);
+
+        NSFCompositeState* compositeState = dynamic_cast<NSFCompositeState*>(state);
+        if (compositeState == NULL)
+        {
+            return;
+        }
+
+        // Order must match the order in which composite states read and write their configuration
+        std::list<NSFForkJoin*>::iterator forkJoinIterator;
+        for (forkJoinIterator = compositeState->forkJoins.begin(); forkJoinIterator != compositeState->forkJoins.end(); ++forkJoinIterator)
+        {
+            addState(*forkJoinIterator);
+        }
+
+        std::list<NSFRegion*>::iterator regionIterator;
+        for (regionIterator = compositeState->regions.begin(); regionIterator != compositeState->regions.end(); ++regionIterator)
+        {
+            std::list<NSFState*>::iterator substateIterator;
+            for (substateIterator = (*regionIterator)->substates.begin(); substateIterator != (*regionIterator)->substates.end(); ++substateIterator)
+            {
+                addState(*substateIterator);
+            }
+        }
+    }
+
+    void NSFStateMachineConfiguration::clearStates()
+    {
+        std::vector<NSFState*>().swap(states);
+        stateIndices.clear();
+    }
+
+    UInt32 NSFStateMachineConfiguration::getStructureSignature() const
+    {
+        // FNV-1a hash of the state names, with a separator after each name
+        UInt32 signature = 2166136261U;
+
+        // Index zero is the null state and index one is the state machine itself, whose name differs between instances
+        for (std::vector<NSFState*>::size_type i = 2; i < states.size(); ++i)
+        {
+            const NSFString& name = states[i]->getName();
+
+            for (NSFString::size_type j = 0; j < name.size(); ++j)
+            {
+                signature = (signature ^ (UInt8)name[j]) * 16777619U;
+            }
+
+            signature = (signature ^ 0xFF) * 16777619U;
+        }
+
+        return signature;
+    }
+
+    bool NSFStateMachineConfiguration::readBool()
+    {
+        return (readUInt() != 0);
+    }
+
+    NSFState* NSFStateMachineConfiguration::readState()
+    {
+        UInt64 index = readUInt();
+
+        if (index >= states.size())
+        {
+            throw std::runtime_error("State machine configuration references an unknown state");
+        }
+
+        return states[(std::vector<NSFState*>::size_type)index];
+    }
+
+    UInt64 NSFStateMachineConfiguration::readUInt()
+    {
+        UInt64 value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (readPosition >= data.size())
+            {
+                throw std::runtime_error("State machine configuration data is truncated");
+            }
+
+            UInt8 byte = data[readPosition++];
+            value |= ((UInt64)(byte & 0x7F)) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error("State machine configuration data is corrupt");
+    }
+
+    void NSFStateMachineConfiguration::writeBool(bool value)
+    {
+        data.push_back(value ? 1 : 0);
+    }
+
+    void NSFStateMachineConfiguration::writeState(NSFState* state)
+    {
+        std::map<NSFState*, UInt32>::iterator stateIterator = stateIndices.find(state);
+
+        if (stateIterator == stateIndices.end())
+        {
+            throw std::runtime_error(state->getName() + " state is not part of the state machine configuration");
+        }
+
+        writeUInt(stateIterator->second);
+    }
+
+    void NSFStateMachineConfiguration::writeUInt(UInt64 value)
+    {
+        while (value >= 0x80)
+        {
+            data.push_back((UInt8)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+
+        data.push_back((UInt8)value);
+    }
+}
@@ -0,0 +1,160 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_STATE_MACHINE_CONFIGURATION_H
+#define NSF_STATE_MACHINE_CONFIGURATION_H
+
+#include "NSFCoreTypes.h"
+#include "NSFStateMachineTypes.h"
+
+#include <map>
+#include <vector>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents the active configuration of a state machine in a compact binary form.
+    /// </summary>
+    /// <remarks>
+    /// The configuration holds the active flag of every state and region, each region's active and history substates,
+    /// and the completed transitions of every fork-join.  States are referenced by their position in the state machine
+    /// structure, so a configuration can only be restored into a state machine with the same structure as the one it was saved from.
+    /// The data starts with the number of states and a signature of the structure, which are checked on restore.
+    /// Values are encoded as variable length integers, typically requiring a few bytes per region.
+    /// </remarks>
+    class NSFStateMachineConfiguration
+    {
+    public:
+
+        friend class NSFCompositeState;
+        friend class NSFForkJoin;
+        friend class NSFRegion;
+        friend class NSFState;
+        friend class NSFStateMachine;
+
+        /// <summary>
+        /// Creates an empty state machine configuration.
+        /// </summary>
+        NSFStateMachineConfiguration();
+
+        /// <summary>
+        /// Gets the binary data of the configuration.
+        /// </summary>
+        const std::vector<UInt8>& getData() const { return data; }
+
+        /// <summary>
+        /// Sets the binary data of the configuration.
+        /// </summary>
+        /// <param name="value">The binary data, as previously returned by getData().</param>
+        void setData(const std::vector<UInt8>& value);
+
+        /// <summary>
+        /// Gets the size of the binary data, in bytes.
+        /// </summary>
+        UInt32 getSize() const { return (UInt32)data.size(); }
+
+        /// <summary>
+        /// Clears the configuration data and releases its memory.
+        /// </summary>
+        void clear();
+
+    private:
+
+        std::vector<UInt8> data;
+        std::vector<UInt8>::size_type readPosition;
+        std::vector<NSFState*> states;
+        std::map<NSFState*, UInt32> stateIndices;
+
+        /// <summary>
+        /// Builds the state index for the state machine structure below the specified state.
+        /// </summary>
+        /// <param name="state">The root state of the structure.</param>
+        /// <remarks>
+        /// The index must be built before any states are read or written.
+        /// Index zero is reserved for the null state.
+        /// </remarks>
+        void indexStates(NSFCompositeState* state);
+
+        /// <summary>
+        /// Adds a state to the state index.
+        /// </summary>
+        /// <param name="state">The state to add.</param>
+        void addState(NSFState* state);
+
+        /// <summary>
+        /// Releases the state index.
+        /// </summary>
+        /// <remarks>
+        /// The index refers to the states of a particular state machine instance,
+        /// so it is released as soon as a save or restore completes to keep the configuration compact.
+        /// </remarks>
+        void clearStates();
+
+        /// <summary>
+        /// Gets the number of states in the state index, including the null state.
+        /// </summary>
+        UInt32 getStateCount() const { return (UInt32)states.size(); }
+
+        /// <summary>
+        /// Gets a signature of the state machine structure in the state index.
+        /// </summary>
+        /// <returns>A hash of the state names below the root state, in index order.</returns>
+        /// <remarks>
+        /// The signature detects attempts to restore a configuration into a state machine whose structure has changed,
+        /// for example after an application upgrade, even when the number of states is unchanged.
+        /// </remarks>
+        UInt32 getStructureSignature() const;
+
+        /// <summary>
+        /// Reads a flag from the configuration data.
+        /// </summary>
+        bool readBool();
+
+        /// <summary>
+        /// Reads a state reference from the configuration data.
+        /// </summary>
+        NSFState* readState();
+
+        /// <summary>
+        /// Reads a variable length unsigned integer from the configuration data.
+        /// </summary>
+        UInt64 readUInt();
+
+        /// <summary>
+        /// Writes a flag to the configuration data.
+        /// </summary>
+        void writeBool(bool value);
+
+        /// <summary>
+        /// Writes a state reference to the configuration data.
+        /// </summary>
+        void writeState(NSFState* state);
+
+        /// <summary>
+        /// Writes a variable length unsigned integer to the configuration data.
+        /// </summary>
+        void writeUInt(UInt64 value);
+    };
+}
+
+#endif // NSF_STATE_MACHINE_CONFIGURATION_H
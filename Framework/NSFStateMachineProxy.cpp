@@ -0,0 +1,334 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFStateMachineProxy.h"
+
+#include "NSFEventThread.h"
+#include "NSFStateMachine.h"
+#include "NSFTimerThread.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( push )
+#pragma warning( disable : 4355 )
+#endif
+
+    NSFStateMachineProxy::NSFStateMachineProxy(const NSFString& name, NSFEventThread* thread, INSFStateMachineFactory* factory)
+        : NSFTaggedObject(name), eventHandler(name, thread), passivateEvent("Passivate", &eventHandler), releaseEvent("Release", &eventHandler), proxyMutex(NSFOSMutex::create()),
+        factory(factory), stateMachine(NULL), passivated(false), runStatus(EventHandlerStopped),
+        lastEventTime(NSFTimerThread::getPrimaryTimerThread().getCurrentTime()), passivationCount(0), rehydrationCount(0)
+    {
+        eventHandler.setLoggingEnabled(false);
+        eventHandler.addEventReaction(&passivateEvent, NSFAction(this, &NSFStateMachineProxy::handlePassivateEvent));
+        eventHandler.addEventReaction(&releaseEvent, NSFAction(this, &NSFStateMachineProxy::handleReleaseEvent));
+        eventHandler.startEventHandler();
+    }
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( pop )
+#endif
+
+    NSFStateMachineProxy::~NSFStateMachineProxy()
+    {
+        // Stop passivation activity before deleting state machines
+        eventHandler.terminate(true);
+
+        delete stateMachine;
+
+        std::list<NSFStateMachine*>::iterator stateMachineIterator;
+        for (stateMachineIterator = releasingStateMachines.begin(); stateMachineIterator != releasingStateMachines.end(); ++stateMachineIterator)
+        {
+            delete *stateMachineIterator;
+        }
+
+        delete proxyMutex;
+    }
+
+    UInt32 NSFStateMachineProxy::getBytesSaved()
+    {
+        LOCK(proxyMutex)
+        {
+            if (!passivated || (factory->getStateMachineSize() <= configuration.getSize()))
+            {
+                return 0;
+            }
+
+            return factory->getStateMachineSize() - configuration.getSize();
+        }
+        ENDLOCK;
+    }
+
+    UInt32 NSFStateMachineProxy::getConfigurationSize()
+    {
+        LOCK(proxyMutex)
+        {
+            return passivated ? configuration.getSize() : 0;
+        }
+        ENDLOCK;
+    }
+
+    NSFTime NSFStateMachineProxy::getLastEventTime()
+    {
+        LOCK(proxyMutex)
+        {
+            return lastEventTime;
+        }
+        ENDLOCK;
+    }
+
+    UInt32 NSFStateMachineProxy::getPassivationCount()
+    {
+        LOCK(proxyMutex)
+        {
+            return passivationCount;
+        }
+        ENDLOCK;
+    }
+
+    UInt32 NSFStateMachineProxy::getRehydrationCount()
+    {
+        LOCK(proxyMutex)
+        {
+            return rehydrationCount;
+        }
+        ENDLOCK;
+    }
+
+    NSFEventHandlerRunStatus NSFStateMachineProxy::getRunStatus() const
+    {
+        LOCK(proxyMutex)
+        {
+            if (stateMachine != NULL)
+            {
+                return stateMachine->getRunStatus();
+            }
+
+            return runStatus;
+        }
+        ENDLOCK;
+    }
+
+    NSFStateMachine* NSFStateMachineProxy::getStateMachine()
+    {
+        LOCK(proxyMutex)
+        {
+            rehydrate();
+            return stateMachine;
+        }
+        ENDLOCK;
+    }
+
+    NSFEventHandlerTerminationStatus NSFStateMachineProxy::getTerminationStatus() const
+    {
+        return eventHandler.getTerminationStatus();
+    }
+
+    NSFEventStatus NSFStateMachineProxy::handleEvent(NSFEvent* nsfEvent)
+    {
+        return getStateMachine()->handleEvent(nsfEvent);
+    }
+
+    bool NSFStateMachineProxy::isPassivated()
+    {
+        LOCK(proxyMutex)
+        {
+            return passivated;
+        }
+        ENDLOCK;
+    }
+
+    void NSFStateMachineProxy::passivate()
+    {
+        if (!eventHandler.hasEvent(&passivateEvent))
+        {
+            eventHandler.queueEvent(&passivateEvent);
+        }
+    }
+
+    void NSFStateMachineProxy::queueEvent(NSFEvent* nsfEvent)
+    {
+        LOCK(proxyMutex)
+        {
+            lastEventTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+            rehydrate();
+
+            if (nsfEvent->getDeleteAfterHandling())
+            {
+                // The event is deleted after it is handled, so the state machine takes it over rather than handling a copy
+                stateMachine->queueEvent(nsfEvent);
+            }
+            else
+            {
+                // Queue a copy, so that the event's destination remains the proxy rather than the current state machine
+                stateMachine->queueEvent(nsfEvent->copy(true));
+            }
+        }
+        ENDLOCK;
+    }
+
+    void NSFStateMachineProxy::queueEvent(NSFEvent* nsfEvent, INSFNamedObject* source)
+    {
+        nsfEvent->setSource(source);
+        queueEvent(nsfEvent);
+    }
+
+    void NSFStateMachineProxy::startEventHandler()
+    {
+        getStateMachine()->startStateMachine();
+    }
+
+    void NSFStateMachineProxy::stopEventHandler()
+    {
+        getStateMachine()->stopStateMachine();
+    }
+
+    void NSFStateMachineProxy::terminate(bool waitForTerminated)
+    {
+        LOCK(proxyMutex)
+        {
+            if (stateMachine != NULL)
+            {
+                stateMachine->terminate(false);
+            }
+        }
+        ENDLOCK;
+
+        eventHandler.terminate(waitForTerminated);
+    }
+
+    // Private
+
+    void NSFStateMachineProxy::handlePassivateEvent(const NSFEventContext&)
+    {
+        LOCK(proxyMutex)
+        {
+            if (stateMachine == NULL)
+            {
+                return;
+            }
+
+            // The proxy shares the state machine's thread, so the state machine is not processing an event,
+            // but it may have events waiting, in which case it is not idle.
+            // Events queued through the proxy are copies whose destination is the proxy, so both destinations are checked.
+            NSFEventThread* eventThread = stateMachine->getEventThread();
+            if (eventThread->hasEventFor(stateMachine) || eventThread->hasEventFor(this))
+            {
+                return;
+            }
+
+            stateMachine->saveConfiguration(configuration);
+            runStatus = stateMachine->getRunStatus();
+
+            // The state machine cannot be deleted from its own thread until it has terminated,
+            // so it is released when the release event is handled, after the terminate event.
+            stateMachine->terminate(false);
+            releasingStateMachines.push_back(stateMachine);
+            stateMachine = NULL;
+
+            passivated = true;
+            ++passivationCount;
+        }
+        ENDLOCK;
+
+        eventHandler.queueEvent(&releaseEvent);
+    }
+
+    void NSFStateMachineProxy::handleReleaseEvent(const NSFEventContext&)
+    {
+        bool releasePending = false;
+
+        LOCK(proxyMutex)
+        {
+            std::list<NSFStateMachine*>::iterator stateMachineIterator = releasingStateMachines.begin();
+            while (stateMachineIterator != releasingStateMachines.end())
+            {
+                if ((*stateMachineIterator)->getTerminationStatus() == EventHandlerTerminated)
+                {
+                    delete *stateMachineIterator;
+                    stateMachineIterator = releasingStateMachines.erase(stateMachineIterator);
+                }
+                else
+                {
+                    releasePending = true;
+                    ++stateMachineIterator;
+                }
+            }
+        }
+        ENDLOCK;
+
+        if (releasePending && !eventHandler.hasEvent(&releaseEvent))
+        {
+            eventHandler.queueEvent(&releaseEvent);
+        }
+    }
+
+    void NSFStateMachineProxy::rehydrate()
+    {
+        if (stateMachine != NULL)
+        {
+            return;
+        }
+
+        stateMachine = factory->createStateMachine(getName(), eventHandler.getEventThread());
+
+        if (stateMachine->getEventThread() != eventHandler.getEventThread())
+        {
+            delete stateMachine;
+            stateMachine = NULL;
+            throw std::runtime_error(getName() + " state machine must use the proxy's thread");
+        }
+
+        if (!passivated)
+        {
+            return;
+        }
+
+        // Whether or not the restore succeeds, the saved configuration is no longer needed,
+        // as a failed restore leaves the state machine in its initial state.
+        passivated = false;
+
+        try
+        {
+            stateMachine->restoreConfiguration(configuration);
+        }
+        catch(...)
+        {
+            configuration.clear();
+            throw;
+        }
+
+        configuration.clear();
+        ++rehydrationCount;
+
+        if (runStatus == EventHandlerStarted)
+        {
+            stateMachine->startStateMachine();
+        }
+    }
+}
@@ -0,0 +1,209 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_STATE_MACHINE_PROXY_H
+#define NSF_STATE_MACHINE_PROXY_H
+
+#include "NSFEventHandler.h"
+#include "NSFStateMachineConfiguration.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents the interface for classes that create the state machines behind a state machine proxy.
+    /// </summary>
+    class INSFStateMachineFactory
+    {
+    public:
+
+        /// <summary>
+        /// Destroys a state machine factory.
+        /// </summary>
+        virtual ~INSFStateMachineFactory() {}
+
+        /// <summary>
+        /// Creates a state machine.
+        /// </summary>
+        /// <param name="name">The name of the state machine.</param>
+        /// <param name="thread">The thread on which events for the state machine must be queued.</param>
+        /// <returns>The new state machine, which the proxy deletes when it is passivated.</returns>
+        /// <remarks>
+        /// Every state machine created for a proxy must have the same structure, so that a configuration saved from one can be restored into the next.
+        /// </remarks>
+        virtual NSFStateMachine* createStateMachine(const NSFString& name, NSFEventThread* thread) = 0;
+
+        /// <summary>
+        /// Gets the approximate memory used by a state machine created by the factory, in bytes.
+        /// </summary>
+        /// <remarks>
+        /// This value is used only to report the memory saved by passivation.
+        /// </remarks>
+        virtual UInt32 getStateMachineSize() = 0;
+    };
+
+    /// <summary>
+    /// Represents a light-weight stand-in for a state machine that can be passivated while idle.
+    /// </summary>
+    /// <remarks>
+    /// When passivated, the proxy saves the state machine's active configuration, including history substates and fork-join progress,
+    /// into a compact NSFStateMachineConfiguration and deletes the state machine.
+    /// The next event queued to the proxy creates a new state machine from the factory, restores the configuration without executing entry actions,
+    /// and forwards the event to it.
+    /// Events must be queued to the proxy, not to the state machine directly, and transition triggers must be events shared by all state machines
+    /// the factory creates, since events owned by a passivated state machine are deleted with it.
+    /// For the same reason, a state machine should not be passivated while it has scheduled events pending.
+    /// </remarks>
+    class NSFStateMachineProxy : public NSFTaggedObject, public INSFEventHandler
+    {
+    public:
+
+        /// <summary>
+        /// Creates a state machine proxy.
+        /// </summary>
+        /// <param name="name">The name of the proxy and its state machine.</param>
+        /// <param name="thread">The thread on which events for the state machine are queued.</param>
+        /// <param name="factory">The factory used to create the state machine.</param>
+        NSFStateMachineProxy(const NSFString& name, NSFEventThread* thread, INSFStateMachineFactory* factory);
+
+        /// <summary>
+        /// Destroys a state machine proxy, along with its state machine.
+        /// </summary>
+        virtual ~NSFStateMachineProxy();
+
+        /// <summary>
+        /// Gets the memory saved by passivation, in bytes.
+        /// </summary>
+        /// <returns>The state machine size reported by the factory less the size of the saved configuration, or zero if not passivated.</returns>
+        UInt32 getBytesSaved();
+
+        /// <summary>
+        /// Gets the size of the saved configuration, in bytes.
+        /// </summary>
+        /// <returns>The size of the saved configuration, or zero if not passivated.</returns>
+        UInt32 getConfigurationSize();
+
+        virtual NSFEventThread* getEventThread() const { return eventHandler.getEventThread(); }
+
+        /// <summary>
+        /// Gets the time the last event was queued to the proxy.
+        /// </summary>
+        NSFTime getLastEventTime();
+
+        /// <summary>
+        /// Gets the number of times the state machine has been passivated.
+        /// </summary>
+        UInt32 getPassivationCount();
+
+        /// <summary>
+        /// Gets the number of times the state machine has been rehydrated after passivation.
+        /// </summary>
+        UInt32 getRehydrationCount();
+
+        virtual NSFEventHandlerRunStatus getRunStatus() const;
+
+        /// <summary>
+        /// Gets the state machine, rehydrating it if it is passivated.
+        /// </summary>
+        /// <returns>The state machine.</returns>
+        /// <remarks>
+        /// The returned pointer is only valid until the state machine is next passivated.
+        /// </remarks>
+        NSFStateMachine* getStateMachine();
+
+        virtual NSFEventHandlerTerminationStatus getTerminationStatus() const;
+
+        /// <summary>
+        /// Handles an event.
+        /// </summary>
+        /// <param name="nsfEvent">The event to handle.</param>
+        /// <returns>Status indicating if the event was handled or not.</returns>
+        /// <remarks>
+        /// This method is for use only by the North State Framework's internal logic.
+        /// The event is handled directly by the state machine, which is rehydrated if necessary.
+        /// </remarks>
+        virtual NSFEventStatus handleEvent(NSFEvent* nsfEvent);
+
+        /// <summary>
+        /// Indicates if the state machine is passivated.
+        /// </summary>
+        /// <returns>True if the state machine is passivated, otherwise false.</returns>
+        bool isPassivated();
+
+        /// <summary>
+        /// Requests that the state machine be passivated.
+        /// </summary>
+        /// <remarks>
+        /// Passivation is performed on the proxy's thread.
+        /// The request is ignored if the state machine has events queued when the request is handled.
+        /// </remarks>
+        void passivate();
+
+        virtual void queueEvent(NSFEvent* nsfEvent);
+
+        virtual void queueEvent(NSFEvent* nsfEvent, INSFNamedObject* source);
+
+        virtual void startEventHandler();
+
+        virtual void stopEventHandler();
+
+        virtual void terminate(bool waitForTerminated);
+
+    private:
+
+        NSFEventHandler eventHandler;
+        NSFEvent passivateEvent;
+        NSFEvent releaseEvent;
+        NSFOSMutex* proxyMutex;
+
+        INSFStateMachineFactory* factory;
+        NSFStateMachine* stateMachine;
+        std::list<NSFStateMachine*> releasingStateMachines;
+
+        NSFStateMachineConfiguration configuration;
+        bool passivated;
+        NSFEventHandlerRunStatus runStatus;
+        NSFTime lastEventTime;
+        UInt32 passivationCount;
+        UInt32 rehydrationCount;
+
+        /// <summary>
+        /// Saves the state machine configuration and releases the state machine, if it is idle.
+        /// </summary>
+        void handlePassivateEvent(const NSFEventContext& context);
+
+        /// <summary>
+        /// Deletes state machines that have terminated after passivation.
+        /// </summary>
+        void handleReleaseEvent(const NSFEventContext& context);
+
+        /// <summary>
+        /// Creates the state machine, restoring the saved configuration if passivated.
+        /// </summary>
+        /// <remarks>
+        /// The proxy mutex must be locked when calling this method.
+        /// </remarks>
+        void rehydrate();
+    };
+}
+
+#endif // NSF_STATE_MACHINE_PROXY_H
@@ -1,43 +1,50 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_STATE_MACHINE_TYPES_H
-#define NSF_STATE_MACHINE_TYPES_H
-
-namespace NorthStateFramework
-{
-    // Forward declarations for core state machine types
-    class INSFEventHandler;
-    class NSFCompositeState;
-    class NSFEvent;
-    class NSFEventThread;
-    class NSFRegion;
-    class NSFState;
-    class NSFStateMachine;
-    class NSFTimerThread;
-    class NSFTransition;
-    class NSFStateMachineContext;
-}
-
-#endif // NSF_STATE_MACHINE_TYPES_H
-
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_STATE_MACHINE_TYPES_H
+#define NSF_STATE_MACHINE_TYPES_H
+
+namespace NorthStateFramework
+{
+    // Forward declarations for core state machine types
+    class INSFEventHandler;
+    class NSFCompositeState;
+    class NSFEvent;
+    class NSFEventThread;
+    class NSFExternalTransition;
+    class NSFForkJoin;
+    class NSFInternalTransition;
+    class NSFLocalTransition;
+    class NSFRegion;
+    class NSFRegionWorkerPool;
+    class NSFState;
+    class NSFStateMachine;
+    class NSFStateMachineConfiguration;
+    class NSFStateTimeoutEvent;
+    class NSFTimerThread;
+    class NSFTransition;
+    class NSFStateMachineContext;
+}
+
+#endif // NSF_STATE_MACHINE_TYPES_H
+
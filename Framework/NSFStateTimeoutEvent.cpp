@@ -0,0 +1,73 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFStateTimeoutEvent.h"
+
+#include "NSFState.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFStateTimeoutEvent::NSFStateTimeoutEvent(NSFState* state, const NSFEvent& triggerEvent, NSFTime delayTime)
+        : NSFEvent(triggerEvent), state(state), generation(0), timeoutName(NULL), timeoutId(0), timeoutDelayTime(0)
+    {
+        setTimeout(&triggerEvent, delayTime);
+        setRepeatTime(0);
+    }
+
+    bool NSFStateTimeoutEvent::isStale()
+    {
+        // An event still scheduled was queued by an earlier activation of the state, since the current one has not expired yet
+        return ((generation != state->timeoutGeneration) || isScheduled());
+    }
+
+    // Private
+
+    bool NSFStateTimeoutEvent::applyTimeout()
+    {
+        if (timeoutName == NULL)
+        {
+            return false;
+        }
+
+        name = timeoutName;
+        id = timeoutId;
+        setDelayTime(timeoutDelayTime);
+
+        return true;
+    }
+
+    void NSFStateTimeoutEvent::setTimeout(const NSFEvent* triggerEvent, NSFTime delayTime)
+    {
+        if (triggerEvent == NULL)
+        {
+            timeoutName = NULL;
+            return;
+        }
+
+        timeoutName = triggerEvent->name;
+        timeoutId = triggerEvent->id;
+        timeoutDelayTime = delayTime;
+    }
+}
@@ -0,0 +1,95 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_STATE_TIMEOUT_EVENT_H
+#define NSF_STATE_TIMEOUT_EVENT_H
+
+#include "NSFEvent.h"
+
+namespace NorthStateFramework
+{
+    class NSFState;
+
+    /// <summary>
+    /// Represents the event a state schedules when it is entered, to trigger a transition if the state is still active after its timeout.
+    /// </summary>
+    /// <remarks>
+    /// The timeout event is a copy of the trigger event specified with NSFState::setTimeout(...), so it triggers the same transitions.
+    /// The state unschedules the event when it is exited.
+    /// An event that expired before the state was exited may already be queued, so the event is discarded when dispatched
+    /// if the state has been exited, or re-entered and rescheduled the event, since it was scheduled.
+    /// For the same reason, the event is never replaced while the state exists; a changed timeout is applied to it the next time it is scheduled.
+    /// Updating the event in place avoids an allocation, but scheduling and unscheduling it cost what its timer queue charges,
+    /// which is linear in the number of scheduled actions with the default sorted list queue (see NSFState::setTimeout(...)).
+    /// </remarks>
+    class NSFStateTimeoutEvent : public NSFEvent
+    {
+    public:
+
+        friend class NSFState;
+
+        /// <summary>
+        /// Creates a state timeout event.
+        /// </summary>
+        /// <param name="state">The state that schedules the event.</param>
+        /// <param name="triggerEvent">The event whose id and name the timeout event takes.</param>
+        /// <param name="delayTime">The time after the state is entered that the event expires.</param>
+        NSFStateTimeoutEvent(NSFState* state, const NSFEvent& triggerEvent, NSFTime delayTime);
+
+        /// <summary>
+        /// Gets the state that schedules the event.
+        /// </summary>
+        NSFState* getState() const { return state; }
+
+        /// <summary>
+        /// Indicates if the event no longer applies to the state's current activation.
+        /// </summary>
+        /// <returns>True if the state has been exited or has rescheduled the event since the event expired, otherwise false.</returns>
+        virtual bool isStale();
+
+    private:
+
+        NSFState* state;
+        UInt32 generation;
+
+        // The timeout applied the next time the event is scheduled, with a NULL name if the timeout is removed
+        const NSFString* timeoutName;
+        NSFId timeoutId;
+        NSFTime timeoutDelayTime;
+
+        /// <summary>
+        /// Applies the timeout last set, before the event is scheduled.
+        /// </summary>
+        /// <returns>True if the state has a timeout to schedule, false if the timeout was removed.</returns>
+        bool applyTimeout();
+
+        /// <summary>
+        /// Sets the timeout to apply the next time the event is scheduled.
+        /// </summary>
+        /// <param name="triggerEvent">The event whose id and name the timeout event takes, or NULL to remove the timeout.</param>
+        /// <param name="delayTime">The time after the state is entered that the event expires.</param>
+        void setTimeout(const NSFEvent* triggerEvent, NSFTime delayTime);
+    };
+}
+
+#endif // NSF_STATE_TIMEOUT_EVENT_H
@@ -1,84 +1,241 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "NSFTaggedTypes.h"
-
-namespace NorthStateFramework
-{
-    // INSFNamedObject
-
-    // Public
-
-    INSFNamedObject::~INSFNamedObject()
-    {
-    }
-
-    // NSFUniquelyNumberedObject
-
-    // Public
-
-    NSFUniquelyNumberedObject::~NSFUniquelyNumberedObject()
-    {
-    }
-
-    NSFUniquelyNumberedObject::NSFUniquelyNumberedObject()
-        : uniqueId(getNextUniqueId())
-    {
-    }
-
-    bool NSFUniquelyNumberedObject::isSameObject(NSFUniquelyNumberedObject* other)
-    {
-        return (getUniqueId() == other->getUniqueId());
-    }
-
-    NSFId NSFUniquelyNumberedObject::getNextUniqueId()
-    {
-        static NSFId nextUniqueId = 0;
-        LOCK(getUniquelyNumberedObjectMutex())
-        {
-            return ++nextUniqueId;
-        }
-        ENDLOCK;
-    }
-
-    // Private
-
-    NSFOSMutex* NSFUniquelyNumberedObject::getUniquelyNumberedObjectMutex()
-    {
-        static NSFOSMutex* idMutex = NSFOSMutex::create();
-        return idMutex;
-    }
-
-    // NSFTaggedObject
-
-    // Public
-
-    NSFTaggedObject::NSFTaggedObject(const NSFString& name)
-        : name(name.c_str())
-    {
-    }
-
-    NSFTaggedObject::~NSFTaggedObject()
-    {
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTaggedTypes.h"
+
+#include "NSFOSThread.h"
+
+namespace NorthStateFramework
+{
+    // INSFNamedObject
+
+    // Public
+
+    INSFNamedObject::~INSFNamedObject()
+    {
+    }
+
+    // NSFUniquelyNumberedObject
+
+    // Public
+
+    NSFUniquelyNumberedObject::~NSFUniquelyNumberedObject()
+    {
+    }
+
+    NSFUniquelyNumberedObject::NSFUniquelyNumberedObject()
+        : uniqueId(getNextUniqueId())
+    {
+    }
+
+    bool NSFUniquelyNumberedObject::isSameObject(NSFUniquelyNumberedObject* other)
+    {
+        return (getUniqueId() == other->getUniqueId());
+    }
+
+    NSFId NSFUniquelyNumberedObject::getNextUniqueId()
+    {
+        // An atomic increment keeps ids unique without serializing threads that create objects and events concurrently
+        static volatile UInt64 lastUniqueId = 0;
+        return (NSFId)NSFOSThread::atomicIncrement(lastUniqueId);
+    }
+
+    // NSFNameTable
+
+    // Public
+
+    UInt32 NSFNameTable::getCount()
+    {
+        return getCountReference();
+    }
+
+    const NSFString* NSFNameTable::intern(const NSFString& name)
+    {
+        // The empty name is not placed in the buckets, as it is recognized without searching
+        if (name.empty())
+        {
+            return getEmptyName();
+        }
+
+        UInt32 hash = getHash(name);
+
+        LOCK(getNameTableMutex())
+        {
+            Entry*& bucket = getBuckets()[hash & (BucketCount - 1)];
+
+            Entry* entry = findEntry(bucket, name, hash);
+            if (entry != NULL)
+            {
+                // Other references may be added concurrently without the mutex
+                NSFOSThread::atomicIncrement(entry->referenceCount);
+                return entry;
+            }
+
+            entry = new Entry();
+            entry->assign(name.c_str());
+            entry->hash = hash;
+            entry->referenceCount = 1;
+            entry->next = bucket;
+
+            bucket = entry;
+            ++getCountReference();
+
+            return entry;
+        }
+        ENDLOCK;
+    }
+
+    const NSFString* NSFNameTable::addReference(const NSFString* name)
+    {
+        // The empty name is never removed, so it is not counted
+        if (!name->empty())
+        {
+            NSFOSThread::atomicIncrement(static_cast<Entry*>(const_cast<NSFString*>(name))->referenceCount);
+        }
+
+        return name;
+    }
+
+    void NSFNameTable::release(const NSFString* name)
+    {
+        // The empty name is never removed, so it is not counted
+        if (name->empty())
+        {
+            return;
+        }
+
+        Entry* entry = static_cast<Entry*>(const_cast<NSFString*>(name));
+
+        LOCK(getNameTableMutex())
+        {
+            // The last reference is released under the mutex, so that intern cannot find the entry while it is removed
+            if (NSFOSThread::atomicDecrement(entry->referenceCount) != 0)
+            {
+                return;
+            }
+
+            Entry** link = &getBuckets()[entry->hash & (BucketCount - 1)];
+            while (*link != entry)
+            {
+                link = &(*link)->next;
+            }
+
+            *link = entry->next;
+            --getCountReference();
+        }
+        ENDLOCK;
+
+        delete entry;
+    }
+
+    // Private
+
+    NSFNameTable::Entry* NSFNameTable::findEntry(Entry* entry, const NSFString& name, UInt32 hash)
+    {
+        for (; entry != NULL; entry = entry->next)
+        {
+            if ((entry->hash == hash) && (*entry == name))
+            {
+                return entry;
+            }
+        }
+
+        return NULL;
+    }
+
+    NSFNameTable::Entry** NSFNameTable::getBuckets()
+    {
+        // The buckets are never deleted, so that static objects can release their names while static objects are destroyed
+        static Entry** buckets = new Entry*[BucketCount]();
+        return buckets;
+    }
+
+    volatile UInt32& NSFNameTable::getCountReference()
+    {
+        static volatile UInt32 count = 0;
+        return count;
+    }
+
+    const NSFString* NSFNameTable::getEmptyName()
+    {
+        static const NSFString* emptyName = new NSFString();
+        return emptyName;
+    }
+
+    UInt32 NSFNameTable::getHash(const NSFString& name)
+    {
+        UInt32 hash = 2166136261U;
+
+        for (NSFString::size_type i = 0; i < name.size(); ++i)
+        {
+            hash = (hash ^ (UInt8)name[i]) * 16777619U;
+        }
+
+        return hash;
+    }
+
+    NSFOSMutex* NSFNameTable::getNameTableMutex()
+    {
+        static NSFOSMutex* nameTableMutex = NSFOSMutex::create();
+        return nameTableMutex;
+    }
+
+    // NSFTaggedObject
+
+    // Public
+
+    NSFTaggedObject::NSFTaggedObject(const NSFString& name)
+        : name(NSFNameTable::intern(name))
+    {
+    }
+
+    NSFTaggedObject::NSFTaggedObject(const NSFTaggedObject& taggedObject)
+        : INSFNamedObject(), NSFUniquelyNumberedObject(taggedObject), name(NSFNameTable::addReference(taggedObject.name))
+    {
+    }
+
+    NSFTaggedObject::~NSFTaggedObject()
+    {
+        NSFNameTable::release(name);
+    }
+
+    void NSFTaggedObject::setName(const NSFString& value)
+    {
+        // Intern the new name before releasing the old one, as the value may refer to the old name
+        const NSFString* oldName = name;
+        name = NSFNameTable::intern(value);
+        NSFNameTable::release(oldName);
+    }
+
+    NSFTaggedObject& NSFTaggedObject::operator=(const NSFTaggedObject& taggedObject)
+    {
+        NSFUniquelyNumberedObject::operator=(taggedObject);
+
+        // Add the reference before releasing the old name, in case the names are the same
+        const NSFString* oldName = name;
+        name = NSFNameTable::addReference(taggedObject.name);
+        NSFNameTable::release(oldName);
+
+        return *this;
+    }
+}
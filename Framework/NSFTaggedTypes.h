@@ -1,130 +1,239 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_TAGGED_TYPES_H
-#define NSF_TAGGED_TYPES_H
-
-#include "NSFCoreTypes.h"
-#include "NSFOSMutex.h"
-
-namespace NorthStateFramework
-{
-    /// <summary>
-    /// Represents an interface for objects containing a name.
-    /// </summary>
-    class INSFNamedObject
-    {
-    public:
-
-        /// <summary>
-        /// Destroys the object.
-        /// </summary>
-        virtual ~INSFNamedObject();
-
-        /// <summary>
-        /// Gets the name of the object.
-        /// </summary>
-        virtual const NSFString& getName() const = 0;
-
-        /// <summary>
-        /// Sets the name of the object.
-        /// </summary>
-        virtual void setName(const NSFString& value) = 0;
-    };
-
-    /// <summary>
-    /// Represents an object containing a uniquely numbered id.
-    /// </summary>
-    /// <remarks>
-    /// There are 2^64 unique ids available.
-    /// </remarks>
-    class NSFUniquelyNumberedObject
-    {
-    public:
-
-        /// <summary>
-        /// Creates a uniquely numbered object.
-        /// </summary>
-        NSFUniquelyNumberedObject();
-
-        /// <summary>
-        /// Destroys a uniquely numbered object.
-        /// </summary>
-        virtual ~NSFUniquelyNumberedObject();
-
-        /// <summary>
-        /// Gets the unique id of the object.
-        /// </summary>
-        NSFId getUniqueId() const { return uniqueId; }
-
-        /// <summary>
-        /// Checks if this object is the same as another object.
-        /// </summary>
-        /// <param name="other">The other object to compare against.</param>
-        /// <returns>True if the objects have the same unique id, false otherwise.</returns>
-        bool isSameObject(NSFUniquelyNumberedObject* other);
-
-        /// <summary>
-        /// Gets the next unique id.
-        /// </summary>
-        /// <remarks>
-        /// There are 2^64 unique ids available.
-        /// </remarks>
-        static NSFId getNextUniqueId();
-
-    private:
-
-        NSFId uniqueId;
-
-        static NSFOSMutex* getUniquelyNumberedObjectMutex();
-    };
-
-    /// <summary>
-    /// Represents an object containing unique id and name
-    /// </summary>
-    class NSFTaggedObject : public NSFUniquelyNumberedObject, public virtual INSFNamedObject
-    {
-    public:
-
-        /// <summary>
-        /// Creates an object with a unique id and a name.
-        /// </summary>
-        /// <param name="name">The user defined name for the object.</param>
-        NSFTaggedObject(const NSFString& name);
-
-        /// <summary>
-        /// Destroys a tagged object.
-        /// </summary>
-        virtual ~NSFTaggedObject();
-
-        virtual const NSFString& getName() const { return name; }
-
-        virtual void setName(const NSFString& value) { name = value.c_str(); }
-
-    private:
-
-        NSFString name;
-    };
-}
-
-#endif // NSF_TAGGED_TYPES_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TAGGED_TYPES_H
+#define NSF_TAGGED_TYPES_H
+
+#include "NSFCoreTypes.h"
+#include "NSFOSMutex.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents an interface for objects containing a name.
+    /// </summary>
+    class INSFNamedObject
+    {
+    public:
+
+        /// <summary>
+        /// Destroys the object.
+        /// </summary>
+        virtual ~INSFNamedObject();
+
+        /// <summary>
+        /// Gets the name of the object.
+        /// </summary>
+        virtual const NSFString& getName() const = 0;
+
+        /// <summary>
+        /// Sets the name of the object.
+        /// </summary>
+        virtual void setName(const NSFString& value) = 0;
+    };
+
+    /// <summary>
+    /// Represents an object containing a uniquely numbered id.
+    /// </summary>
+    /// <remarks>
+    /// There are 2^64 unique ids available.
+    /// </remarks>
+    class NSFUniquelyNumberedObject
+    {
+    public:
+
+        /// <summary>
+        /// Creates a uniquely numbered object.
+        /// </summary>
+        NSFUniquelyNumberedObject();
+
+        /// <summary>
+        /// Destroys a uniquely numbered object.
+        /// </summary>
+        virtual ~NSFUniquelyNumberedObject();
+
+        /// <summary>
+        /// Gets the unique id of the object.
+        /// </summary>
+        NSFId getUniqueId() const { return uniqueId; }
+
+        /// <summary>
+        /// Checks if this object is the same as another object.
+        /// </summary>
+        /// <param name="other">The other object to compare against.</param>
+        /// <returns>True if the objects have the same unique id, false otherwise.</returns>
+        bool isSameObject(NSFUniquelyNumberedObject* other);
+
+        /// <summary>
+        /// Gets the next unique id.
+        /// </summary>
+        /// <remarks>
+        /// There are 2^64 unique ids available.
+        /// Ids are generated without locking a mutex, and increase on each thread, and across threads in the order they are generated.
+        /// </remarks>
+        static NSFId getNextUniqueId();
+
+    private:
+
+        NSFId uniqueId;
+    };
+
+    /// <summary>
+    /// Represents the global table of interned names.
+    /// </summary>
+    /// <remarks>
+    /// Each distinct name is stored once, and objects with the same name share the stored string,
+    /// so naming an object or copying an event does not allocate a new string.
+    /// Names are reference counted, and a name is removed from the table when the last object holding it releases it,
+    /// so that per-instance names, such as those of dynamically created proxies, do not grow the table for the life of the application.
+    /// Sharing a name that is already held, as when copying an event, does not lock a mutex.
+    /// </remarks>
+    class NSFNameTable
+    {
+    public:
+
+        /// <summary>
+        /// Gets the number of names in the table.
+        /// </summary>
+        static UInt32 getCount();
+
+        /// <summary>
+        /// Gets the interned copy of a name, adding the name to the table if necessary.
+        /// </summary>
+        /// <param name="name">The name.</param>
+        /// <returns>The interned name, which is the same for all equal names.</returns>
+        /// <remarks>
+        /// The caller holds a reference to the interned name, which it must release when it no longer uses the name.
+        /// </remarks>
+        static const NSFString* intern(const NSFString& name);
+
+        /// <summary>
+        /// Adds a reference to an interned name that the caller already holds.
+        /// </summary>
+        /// <param name="name">The interned name.</param>
+        /// <returns>The interned name.</returns>
+        /// <remarks>
+        /// The name is shared without being looked up, and without locking a mutex.
+        /// </remarks>
+        static const NSFString* addReference(const NSFString* name);
+
+        /// <summary>
+        /// Releases a reference to an interned name, removing the name from the table when no references remain.
+        /// </summary>
+        /// <param name="name">The interned name.</param>
+        static void release(const NSFString* name);
+
+    private:
+
+        /// <summary>
+        /// Represents an interned name in one of the table's hash buckets.
+        /// </summary>
+        /// <remarks>
+        /// The entry is the name itself, so that an interned name is converted back to its entry without a lookup.
+        /// </remarks>
+        struct Entry : public NSFString
+        {
+            UInt32 hash;
+            volatile UInt32 referenceCount;
+            Entry* next;
+        };
+
+        static const UInt32 BucketCount = 4096;
+
+        /// <summary>
+        /// Searches a bucket for a name.
+        /// </summary>
+        /// <param name="entry">The first entry in the bucket.</param>
+        /// <param name="name">The name.</param>
+        /// <param name="hash">The hash of the name.</param>
+        /// <returns>The entry if found, otherwise NULL.</returns>
+        static Entry* findEntry(Entry* entry, const NSFString& name, UInt32 hash);
+
+        /// <summary>
+        /// Gets the hash buckets, each holding the first entry of a list of names.
+        /// </summary>
+        static Entry** getBuckets();
+
+        /// <summary>
+        /// Gets the number of names in the table, for update.
+        /// </summary>
+        static volatile UInt32& getCountReference();
+
+        /// <summary>
+        /// Gets the interned empty name.
+        /// </summary>
+        static const NSFString* getEmptyName();
+
+        /// <summary>
+        /// Gets the FNV-1a hash of a name.
+        /// </summary>
+        static UInt32 getHash(const NSFString& name);
+
+        static NSFOSMutex* getNameTableMutex();
+    };
+
+    /// <summary>
+    /// Represents an object containing unique id and name
+    /// </summary>
+    /// <remarks>
+    /// The name is interned in the NSFNameTable, so objects with the same name share a single string.
+    /// </remarks>
+    class NSFTaggedObject : public NSFUniquelyNumberedObject, public virtual INSFNamedObject
+    {
+    public:
+
+        /// <summary>
+        /// Creates an object with a unique id and a name.
+        /// </summary>
+        /// <param name="name">The user defined name for the object.</param>
+        NSFTaggedObject(const NSFString& name);
+
+        /// <summary>
+        /// Creates a copy of a tagged object, sharing its interned name.
+        /// </summary>
+        /// <param name="taggedObject">The object to copy.</param>
+        NSFTaggedObject(const NSFTaggedObject& taggedObject);
+
+        /// <summary>
+        /// Destroys a tagged object.
+        /// </summary>
+        virtual ~NSFTaggedObject();
+
+        virtual const NSFString& getName() const { return *name; }
+
+        virtual void setName(const NSFString& value);
+
+        /// <summary>
+        /// Assigns the unique id and name of another tagged object.
+        /// </summary>
+        /// <param name="taggedObject">The object to assign from.</param>
+        /// <returns>This object.</returns>
+        NSFTaggedObject& operator=(const NSFTaggedObject& taggedObject);
+
+    private:
+
+        const NSFString* name;
+    };
+}
+
+#endif // NSF_TAGGED_TYPES_H
@@ -1,157 +1,261 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_TIMER_ACTION_H
-#define NSF_TIMER_ACTION_H
-
-#include "NSFTaggedTypes.h"
-
-namespace NorthStateFramework
-{
-    /// <summary>
-    /// Represents the base class functionality for implementing a timer action.
-    /// </summary>
-    /// <remarks>
-    /// Timer actions must be short in duration and must not block, as they are called directly from the timer thread.
-    /// Concrete timer actions in the framework are NSFEvent, NSFScheduledAction, and NSFOSSignal.
-    /// </remarks>
-    class NSFTimerAction : public INSFNamedObject
-    {
-    public:
-
-        friend class NSFTimerThread;
-
-        /// <summary>
-        /// Destroys a timer action.
-        /// </summary>
-        virtual ~NSFTimerAction();
-
-        /// <summary>
-        /// Gets the delay time of the action.
-        /// </summary>
-        NSFTime getDelayTime() const { return delayTime; }
-
-        /// <summary>
-        /// Sets the delay time of the action.
-        /// </summary>
-        void setDelayTime(NSFTime value) { delayTime = value; }
-
-        /// <summary>
-        /// Gets the execution time of the action.
-        /// </summary>
-        NSFTime getExecutionTime() const { return executionTime; }
-
-        /// <summary>
-        /// Sets the execution time of the action.
-        /// </summary>
-        void setExecutionTime(NSFTime value) { executionTime = value; }
-
-        /// <summary>
-        /// Gets the name of the action.
-        /// </summary>
-        virtual const NSFString& getName() const { return name; }
-
-        /// <summary>
-        /// Sets the name of the action.
-        /// </summary>
-        virtual void setName(const NSFString& value) { name = value.c_str(); }
-
-        /// <summary>
-        /// Gets the repeat time for periodic actions, 0 if non-periodic.
-        /// </summary>
-        NSFTime getRepeatTime() const { return repeatTime; }
-
-        /// <summary>
-        /// Sets the repeat time for periodic actions, 0 if non-periodic.
-        /// </summary>
-        void setRepeatTime(NSFTime value) { repeatTime = value; }
-
-        /// <summary>
-        /// Checks if the action is already scheduled.
-        /// </summary>
-        /// <returns>True if scheduled, otherwise false</returns>
-        bool isScheduled();
-
-        /// <summary>
-        /// Schedules the action to execute at the previously designated delay and repeat times.
-        /// </summary>
-        void schedule();
-
-        /// <summary>
-        /// Schedules the action to execute after the specified delay time with zero repeat time.
-        /// </summary>
-        /// <param name="delayTime">The delay time until the action executes.</param>
-        void schedule(NSFTime delayTime);
-
-        /// <summary>
-        /// Schedules the action to execute at the specified times.
-        /// </summary>
-        /// <param name="delayTime">The delay time until the action executes.</param>
-        /// <param name="repeatTime">The repeat time for periodic actions, 0 if non-periodic.</param>
-        void schedule(NSFTime delayTime, NSFTime repeatTime);
-
-        /// <summary>
-        /// Schedules the action to execute at its designated execution time.
-        /// </summary>
-        void scheduleAbsoluteExecution();
-
-        /// <summary>
-        /// Schedules the action to execute at the specified execution time.
-        /// </summary>
-        /// <param name="executionTime">The time the action executes.</param>
-        void scheduleAbsoluteExecution(NSFTime executionTime);
-
-        /// <summary>
-        /// Schedules the action to execute at the specified execution time.
-        /// </summary>
-        /// <param name="executionTime">The time the action executes.</param>
-        /// <param name="repeatTime">The repeat time for periodic actions, 0 if non-periodic.</param>
-        void scheduleAbsoluteExecution(NSFTime executionTime, NSFTime repeatTime);
-
-        /// <summary>
-        /// Unschedules the action.
-        /// </summary>
-        void unschedule();
-
-    protected:
-
-        /// <summary>
-        /// Creates a timer action.
-        /// </summary>
-        NSFTimerAction(const NSFString& name);
-
-    private:
-
-        NSFString name;
-        NSFTime delayTime;
-        NSFTime executionTime;
-        NSFTime repeatTime;
-
-        /// <summary>
-        /// Callback method called by timer at expiration time.
-        /// </summary>
-        virtual void execute() = 0;
-    };
-}
-
-#endif // NSF_TIMER_ACTION_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TIMER_ACTION_H
+#define NSF_TIMER_ACTION_H
+
+#include "NSFTaggedTypes.h"
+
+namespace NorthStateFramework
+{
+    class NSFEventThread;
+    class NSFThread;
+    class NSFTimerQueue;
+    class NSFTimerThread;
+
+    /// <summary>
+    /// Represents the ways a periodic action is rescheduled when it executes a period or more late,
+    /// for example after the process or timer thread has stalled.
+    /// </summary>
+    /// <remarks>
+    /// CatchUpOverrunPolicy reschedules the action one period after its execution time, so it executes once for every missed period, back to back.
+    /// SkipOverrunPolicy reschedules the action at the next period after the current time, keeping its original phase and dropping missed periods.
+    /// RealignOverrunPolicy reschedules the action one period after the current time, dropping missed periods and shifting its phase.
+    /// </remarks>
+    enum NSFTimerOverrunPolicy { CatchUpOverrunPolicy = 1, SkipOverrunPolicy, RealignOverrunPolicy };
+
+    /// <summary>
+    /// Represents the base class functionality for implementing a timer action.
+    /// </summary>
+    /// <remarks>
+    /// Timer actions must be short in duration and must not block, as they are called directly from the timer thread.
+    /// Concrete timer actions in the framework are NSFEventTimer, NSFScheduledAction, and NSFOSSignal.
+    /// Actions are scheduled with the primary timer thread, unless getLocalTimerThread() returns an event thread with local timers enabled.
+    /// </remarks>
+    class NSFTimerAction : public INSFNamedObject
+    {
+    public:
+
+        friend class NSFEventThread;
+        friend class NSFTimerHeap;
+        friend class NSFTimerList;
+        friend class NSFTimerQueue;
+        friend class NSFTimerThread;
+        friend class NSFTimerWheel;
+
+        /// <summary>
+        /// Destroys a timer action.
+        /// </summary>
+        virtual ~NSFTimerAction();
+
+        /// <summary>
+        /// Gets the delay time of the action.
+        /// </summary>
+        NSFTime getDelayTime() const { return delayTime; }
+
+        /// <summary>
+        /// Sets the delay time of the action.
+        /// </summary>
+        void setDelayTime(NSFTime value) { delayTime = value; }
+
+        /// <summary>
+        /// Gets the execution time of the action.
+        /// </summary>
+        NSFTime getExecutionTime() const { return executionTime; }
+
+        /// <summary>
+        /// Sets the execution time of the action.
+        /// </summary>
+        void setExecutionTime(NSFTime value) { executionTime = value; }
+
+        /// <summary>
+        /// Gets the number of periods the periodic action has fallen behind.
+        /// </summary>
+        /// <remarks>
+        /// A period is counted when it has already elapsed as the action is rescheduled, whether it is executed late or skipped.
+        /// The count accumulates for the life of the action, regardless of its overrun policy.
+        /// It is updated by the timer thread and may be read from any thread as an indication of how far the action has fallen behind.
+        /// </remarks>
+        UInt32 getOverrunCount() const { return overrunCount; }
+
+        /// <summary>
+        /// Gets the way the periodic action is rescheduled when it executes a period or more late.
+        /// </summary>
+        NSFTimerOverrunPolicy getOverrunPolicy() const { return overrunPolicy; }
+
+        /// <summary>
+        /// Sets the way the periodic action is rescheduled when it executes a period or more late.
+        /// </summary>
+        /// <remarks>
+        /// The default is CatchUpOverrunPolicy.
+        /// </remarks>
+        void setOverrunPolicy(NSFTimerOverrunPolicy value) { overrunPolicy = value; }
+
+        /// <summary>
+        /// Gets the time the action may be delayed past its execution time, 0 if it must execute at its execution time.
+        /// </summary>
+        NSFTime getSlackTime() const { return slackTime; }
+
+        /// <summary>
+        /// Sets the time the action may be delayed past its execution time, 0 if it must execute at its execution time.
+        /// </summary>
+        /// <remarks>
+        /// Slack allows the timer thread to coalesce actions whose allowed windows overlap into a single wakeup.
+        /// The timer thread executes the action at the time within its window whose value is the most evenly divisible power of two,
+        /// so that actions with similar windows share the same time.
+        /// Periodic actions are rescheduled from their execution time, so slack does not accumulate from one period to the next.
+        /// The slack time takes effect the next time the action is scheduled.
+        /// </remarks>
+        void setSlackTime(NSFTime value) { slackTime = value; }
+
+        /// <summary>
+        /// Gets the name of the action.
+        /// </summary>
+        virtual const NSFString& getName() const { return *name; }
+
+        /// <summary>
+        /// Sets the name of the action.
+        /// </summary>
+        virtual void setName(const NSFString& value);
+
+        /// <summary>
+        /// Gets the repeat time for periodic actions, 0 if non-periodic.
+        /// </summary>
+        NSFTime getRepeatTime() const { return repeatTime; }
+
+        /// <summary>
+        /// Sets the repeat time for periodic actions, 0 if non-periodic.
+        /// </summary>
+        void setRepeatTime(NSFTime value) { repeatTime = value; }
+
+        /// <summary>
+        /// Checks if the action is already scheduled.
+        /// </summary>
+        /// <returns>True if scheduled, otherwise false</returns>
+        bool isScheduled();
+
+        /// <summary>
+        /// Schedules the action to execute at the previously designated delay and repeat times.
+        /// </summary>
+        void schedule();
+
+        /// <summary>
+        /// Schedules the action to execute after the specified delay time with zero repeat time.
+        /// </summary>
+        /// <param name="delayTime">The delay time until the action executes.</param>
+        void schedule(NSFTime delayTime);
+
+        /// <summary>
+        /// Schedules the action to execute at the specified times.
+        /// </summary>
+        /// <param name="delayTime">The delay time until the action executes.</param>
+        /// <param name="repeatTime">The repeat time for periodic actions, 0 if non-periodic.</param>
+        void schedule(NSFTime delayTime, NSFTime repeatTime);
+
+        /// <summary>
+        /// Schedules the action to execute at its designated execution time.
+        /// </summary>
+        void scheduleAbsoluteExecution();
+
+        /// <summary>
+        /// Schedules the action to execute at the specified execution time.
+        /// </summary>
+        /// <param name="executionTime">The time the action executes.</param>
+        void scheduleAbsoluteExecution(NSFTime executionTime);
+
+        /// <summary>
+        /// Schedules the action to execute at the specified execution time.
+        /// </summary>
+        /// <param name="executionTime">The time the action executes.</param>
+        /// <param name="repeatTime">The repeat time for periodic actions, 0 if non-periodic.</param>
+        void scheduleAbsoluteExecution(NSFTime executionTime, NSFTime repeatTime);
+
+        /// <summary>
+        /// Unschedules the action.
+        /// </summary>
+        void unschedule();
+
+    protected:
+
+        /// <summary>
+        /// Creates a timer action.
+        /// </summary>
+        NSFTimerAction(const NSFString& name);
+
+        /// <summary>
+        /// Creates a timer action with the same name as another timer action.
+        /// </summary>
+        /// <param name="timerAction">The timer action whose name is shared.</param>
+        /// <remarks>
+        /// The interned name is shared without being looked up, and the other action's schedule is not copied.
+        /// </remarks>
+        NSFTimerAction(const NSFTimerAction& timerAction);
+
+        /// <summary>
+        /// Gets the event thread whose local timers schedule the action.
+        /// </summary>
+        /// <returns>The event thread, or NULL to schedule the action with the primary timer thread.</returns>
+        /// <remarks>
+        /// The action executes on the returned thread, rather than on the primary timer thread.
+        /// If the returned thread changes while the action is scheduled, the action is removed from the thread holding it when it is next scheduled.
+        /// </remarks>
+        virtual NSFEventThread* getLocalTimerThread() const { return NULL; }
+
+    private:
+
+        const NSFString* name;
+        NSFTime delayTime;
+        NSFTime executionTime;
+        NSFTime repeatTime;
+        NSFTime slackTime;
+        NSFTimerOverrunPolicy overrunPolicy;
+        UInt32 overrunCount;
+
+        NSFTime timerQueueTime;
+        NSFTimerQueue* timerQueue;
+        UInt32 timerQueueIndex;
+        UInt64 timerQueueSequence;
+        NSFTimerAction* previousTimerAction;
+        NSFTimerAction* nextTimerAction;
+
+        // The thread whose timer queue holds the action, set and cleared under that thread's mutex
+        NSFEventThread* timerEventThread;
+        NSFTimerThread* timerThread;
+
+        /// <summary>
+        /// Callback method called by timer at expiration time.
+        /// </summary>
+        virtual void execute() = 0;
+
+        /// <summary>
+        /// Removes the action from the timer queue of the thread holding it.
+        /// </summary>
+        /// <param name="schedulingThread">The thread about to schedule the action, which is left to move the action within its own queue, or NULL.</param>
+        /// <remarks>
+        /// The action is removed under the holding thread's mutex, so that it is never in two timer queues at once.
+        /// </remarks>
+        void unscheduleFromTimerThread(const NSFThread* schedulingThread);
+    };
+}
+
+#endif // NSF_TIMER_ACTION_H
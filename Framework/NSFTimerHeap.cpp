@@ -0,0 +1,246 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTimerHeap.h"
+
+#include <algorithm>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTimerHeap::NSFTimerHeap()
+        : nextSequence(0)
+    {
+    }
+
+    NSFTime NSFTimerHeap::getNextExecutionTime() const
+    {
+        if (heap.empty())
+        {
+            return MaxTime;
+        }
+
+        return heap.front()->timerQueueTime;
+    }
+
+    void NSFTimerHeap::clear()
+    {
+        heap.clear();
+    }
+
+    void NSFTimerHeap::insertAction(NSFTimerAction* action)
+    {
+        // A rescheduled action is placed after actions already scheduled for the same time
+        action->timerQueueSequence = nextSequence++;
+        setTimerQueueTime(action);
+
+        // Move an action already in the heap in place
+        if (isScheduled(action))
+        {
+            updateAction(action->timerQueueIndex);
+            return;
+        }
+
+        action->timerQueue = this;
+        heap.push_back(NULL);
+        placeAction((UInt32)heap.size() - 1, action);
+        siftUp(action->timerQueueIndex);
+    }
+
+    void NSFTimerHeap::removeAction(NSFTimerAction* action)
+    {
+        if (!isScheduled(action))
+        {
+            return;
+        }
+
+        UInt32 index = action->timerQueueIndex;
+        NSFTimerAction* lastAction = heap.back();
+
+        heap.pop_back();
+        action->timerQueue = NULL;
+
+        // Fill the vacated position with the last action, unless the removed action was the last
+        if (lastAction != action)
+        {
+            placeAction(index, lastAction);
+            updateAction(index);
+        }
+    }
+
+    void NSFTimerHeap::removeAllActions(std::list<NSFTimerAction*>& removedActions)
+    {
+        std::sort(heap.begin(), heap.end(), isEarlier);
+
+        std::vector<NSFTimerAction*>::iterator actionIterator;
+        for (actionIterator = heap.begin(); actionIterator != heap.end(); ++actionIterator)
+        {
+            (*actionIterator)->timerQueue = NULL;
+            removedActions.push_back(*actionIterator);
+        }
+
+        heap.clear();
+    }
+
+    void NSFTimerHeap::getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions)
+    {
+        if (heap.empty() || (heap.front()->timerQueueTime > currentTime))
+        {
+            return;
+        }
+
+        // Find all ready actions before changing the heap, so that a periodic action is only returned once
+        // Subtrees whose root is not ready contain no ready actions
+        readyHeapActions.clear();
+        searchIndices.clear();
+        searchIndices.push_back(0);
+
+        while (!searchIndices.empty())
+        {
+            UInt32 index = searchIndices.back();
+            searchIndices.pop_back();
+
+            if (heap[index]->timerQueueTime > currentTime)
+            {
+                continue;
+            }
+
+            readyHeapActions.push_back(heap[index]);
+
+            for (UInt32 child = (index * Arity) + 1; (child <= (index * Arity) + Arity) && (child < heap.size()); ++child)
+            {
+                searchIndices.push_back(child);
+            }
+        }
+
+        std::sort(readyHeapActions.begin(), readyHeapActions.end(), isEarlier);
+
+        std::vector<NSFTimerAction*>::iterator actionIterator;
+        for (actionIterator = readyHeapActions.begin(); actionIterator != readyHeapActions.end(); ++actionIterator)
+        {
+            NSFTimerAction* action = *actionIterator;
+
+            if (action->getRepeatTime() != 0)
+            {
+                // Re-key the periodic action in place
+                setNextExecutionTime(currentTime, action);
+                action->timerQueueSequence = nextSequence++;
+                setTimerQueueTime(action);
+                siftDown(action->timerQueueIndex);
+            }
+            else
+            {
+                removeAction(action);
+            }
+
+            readyActions.push_back(action);
+        }
+    }
+
+    // Private
+
+    void NSFTimerHeap::placeAction(UInt32 index, NSFTimerAction* action)
+    {
+        heap[index] = action;
+        action->timerQueueIndex = index;
+    }
+
+    void NSFTimerHeap::siftUp(UInt32 index)
+    {
+        NSFTimerAction* action = heap[index];
+
+        while (index > 0)
+        {
+            UInt32 parent = (index - 1) / Arity;
+
+            if (!isEarlier(action, heap[parent]))
+            {
+                break;
+            }
+
+            placeAction(index, heap[parent]);
+            index = parent;
+        }
+
+        placeAction(index, action);
+    }
+
+    void NSFTimerHeap::siftDown(UInt32 index)
+    {
+        NSFTimerAction* action = heap[index];
+        UInt32 size = (UInt32)heap.size();
+
+        while (true)
+        {
+            UInt32 firstChild = (index * Arity) + 1;
+
+            if (firstChild >= size)
+            {
+                break;
+            }
+
+            // Find the earliest child
+            UInt32 earliestChild = firstChild;
+            for (UInt32 child = firstChild + 1; (child < firstChild + Arity) && (child < size); ++child)
+            {
+                if (isEarlier(heap[child], heap[earliestChild]))
+                {
+                    earliestChild = child;
+                }
+            }
+
+            if (!isEarlier(heap[earliestChild], action))
+            {
+                break;
+            }
+
+            placeAction(index, heap[earliestChild]);
+            index = earliestChild;
+        }
+
+        placeAction(index, action);
+    }
+
+    void NSFTimerHeap::updateAction(UInt32 index)
+    {
+        if ((index > 0) && isEarlier(heap[index], heap[(index - 1) / Arity]))
+        {
+            siftUp(index);
+        }
+        else
+        {
+            siftDown(index);
+        }
+    }
+
+    bool NSFTimerHeap::isEarlier(NSFTimerAction* action1, NSFTimerAction* action2)
+    {
+        if (action1->timerQueueTime != action2->timerQueueTime)
+        {
+            return (action1->timerQueueTime < action2->timerQueueTime);
+        }
+
+        return (action1->timerQueueSequence < action2->timerQueueSequence);
+    }
+}
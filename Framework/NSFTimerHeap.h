@@ -0,0 +1,104 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TIMER_HEAP_H
+#define NSF_TIMER_HEAP_H
+
+#include "NSFTimerQueue.h"
+
+#include <vector>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a timer queue that keeps its actions in an indexed 4-ary heap.
+    /// </summary>
+    /// <remarks>
+    /// Each action records its position in the heap, so inserting, removing and rescheduling an action takes logarithmic time without searching,
+    /// and rescheduling an action that is already in the heap moves it in place.
+    /// Actions are ordered exactly by execution time, with ties broken by the order in which they were scheduled,
+    /// so actions with equal execution times are removed in FIFO order.
+    /// Periodic actions are rescheduled in place when they become ready, rather than being removed and reinserted.
+    /// </remarks>
+    class NSFTimerHeap : public NSFTimerQueue
+    {
+    public:
+
+        /// <summary>
+        /// Creates an indexed heap timer queue.
+        /// </summary>
+        NSFTimerHeap();
+
+        virtual NSFTimerQueueType getQueueType() const { return IndexedHeapTimerQueue; }
+
+        virtual NSFTime getNextExecutionTime() const;
+
+        virtual bool isEmpty() const { return heap.empty(); }
+
+        virtual void clear();
+
+        virtual void insertAction(NSFTimerAction* action);
+
+        virtual void removeAction(NSFTimerAction* action);
+
+        virtual void removeAllActions(std::list<NSFTimerAction*>& removedActions);
+
+        virtual void getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions);
+
+    private:
+
+        static const UInt32 Arity = 4;
+
+        std::vector<NSFTimerAction*> heap;
+        std::vector<NSFTimerAction*> readyHeapActions;
+        std::vector<UInt32> searchIndices;
+        UInt64 nextSequence;
+
+        /// <summary>
+        /// Places an action at the specified heap position, recording the position in the action.
+        /// </summary>
+        void placeAction(UInt32 index, NSFTimerAction* action);
+
+        /// <summary>
+        /// Moves the action at the specified heap position toward the root until the heap is ordered.
+        /// </summary>
+        void siftUp(UInt32 index);
+
+        /// <summary>
+        /// Moves the action at the specified heap position toward the leaves until the heap is ordered.
+        /// </summary>
+        void siftDown(UInt32 index);
+
+        /// <summary>
+        /// Moves the action at the specified heap position up or down after its key has changed.
+        /// </summary>
+        void updateAction(UInt32 index);
+
+        /// <summary>
+        /// Compares the execution times and scheduling order of two actions.
+        /// </summary>
+        static bool isEarlier(NSFTimerAction* action1, NSFTimerAction* action2);
+    };
+}
+
+#endif // NSF_TIMER_HEAP_H
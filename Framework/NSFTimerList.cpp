@@ -0,0 +1,106 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTimerList.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTimerList::NSFTimerList()
+    {
+    }
+
+    NSFTime NSFTimerList::getNextExecutionTime() const
+    {
+        if (actions.empty())
+        {
+            return MaxTime;
+        }
+
+        return actions.front()->timerQueueTime;
+    }
+
+    void NSFTimerList::clear()
+    {
+        actions.clear();
+    }
+
+    void NSFTimerList::insertAction(NSFTimerAction* action)
+    {
+        // Make sure action is not already in list
+        removeAction(action);
+
+        action->timerQueue = this;
+        setTimerQueueTime(action);
+
+        // Insert into list based on timer queue time order
+        // Actions with equal times are executed in FIFO order
+        std::list<NSFTimerAction*>::iterator actionIterator;
+        for (actionIterator = actions.begin(); actionIterator != actions.end(); ++actionIterator)
+        {
+            if (action->timerQueueTime < (*actionIterator)->timerQueueTime)
+            {
+                actions.insert(actionIterator, action);
+                return;
+            }
+        }
+
+        // Insert action at end of list if not already inserted
+        actions.push_back(action);
+    }
+
+    void NSFTimerList::removeAction(NSFTimerAction* action)
+    {
+        if (!isScheduled(action))
+        {
+            return;
+        }
+
+        actions.remove(action);
+        action->timerQueue = NULL;
+    }
+
+    void NSFTimerList::removeAllActions(std::list<NSFTimerAction*>& removedActions)
+    {
+        std::list<NSFTimerAction*>::iterator actionIterator;
+        for (actionIterator = actions.begin(); actionIterator != actions.end(); ++actionIterator)
+        {
+            (*actionIterator)->timerQueue = NULL;
+        }
+
+        removedActions.splice(removedActions.end(), actions);
+    }
+
+    void NSFTimerList::getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions)
+    {
+        while (!actions.empty() && (actions.front()->timerQueueTime <= currentTime))
+        {
+            actions.front()->timerQueue = NULL;
+            readyActions.push_back(actions.front());
+            actions.pop_front();
+        }
+
+        rescheduleRepeatingActions(currentTime, readyActions);
+    }
+}
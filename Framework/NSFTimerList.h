@@ -0,0 +1,68 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TIMER_LIST_H
+#define NSF_TIMER_LIST_H
+
+#include "NSFTimerQueue.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a timer queue that keeps its actions in a list sorted by execution time.
+    /// </summary>
+    /// <remarks>
+    /// Inserting and removing actions requires a linear search of the list, which is efficient for the small number of actions typical of most applications.
+    /// </remarks>
+    class NSFTimerList : public NSFTimerQueue
+    {
+    public:
+
+        /// <summary>
+        /// Creates a sorted list timer queue.
+        /// </summary>
+        NSFTimerList();
+
+        virtual NSFTimerQueueType getQueueType() const { return SortedListTimerQueue; }
+
+        virtual NSFTime getNextExecutionTime() const;
+
+        virtual bool isEmpty() const { return actions.empty(); }
+
+        virtual void clear();
+
+        virtual void insertAction(NSFTimerAction* action);
+
+        virtual void removeAction(NSFTimerAction* action);
+
+        virtual void removeAllActions(std::list<NSFTimerAction*>& removedActions);
+
+        virtual void getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions);
+
+    private:
+
+        std::list<NSFTimerAction*> actions;
+    };
+}
+
+#endif // NSF_TIMER_LIST_H
@@ -0,0 +1,133 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTimerQueue.h"
+
+#include "NSFTimerHeap.h"
+#include "NSFTimerList.h"
+#include "NSFTimerWheel.h"
+
+#include <stdexcept>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTimerQueue* NSFTimerQueue::create(NSFTimerQueueType queueType, NSFTime currentTime)
+    {
+        if (queueType == SortedListTimerQueue)
+        {
+            return new NSFTimerList();
+        }
+        else if (queueType == TimingWheelTimerQueue)
+        {
+            return new NSFTimerWheel(currentTime);
+        }
+        else if (queueType == IndexedHeapTimerQueue)
+        {
+            return new NSFTimerHeap();
+        }
+
+        throw std::runtime_error("Unknown timer queue type");
+    }
+
+    // Protected
+
+    void NSFTimerQueue::rescheduleRepeatingActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions)
+    {
+        std::list<NSFTimerAction*>::iterator actionIterator;
+        for (actionIterator = readyActions.begin(); actionIterator != readyActions.end(); ++actionIterator)
+        {
+            if ((*actionIterator)->getRepeatTime() != 0)
+            {
+                setNextExecutionTime(currentTime, *actionIterator);
+                insertAction(*actionIterator);
+            }
+        }
+    }
+
+    void NSFTimerQueue::setNextExecutionTime(NSFTime currentTime, NSFTimerAction* action)
+    {
+        NSFTime repeatTime = action->getRepeatTime();
+        NSFTime nextExecutionTime = action->getExecutionTime() + repeatTime;
+
+        if ((nextExecutionTime > currentTime) || (repeatTime <= 0))
+        {
+            action->setExecutionTime(nextExecutionTime);
+            return;
+        }
+
+        // The periods from the next execution time through the current time have already elapsed
+        NSFTime missedPeriods = ((currentTime - nextExecutionTime) / repeatTime) + 1;
+
+        if (action->getOverrunPolicy() == SkipOverrunPolicy)
+        {
+            action->overrunCount += (UInt32)missedPeriods;
+            action->setExecutionTime(nextExecutionTime + (missedPeriods * repeatTime));
+        }
+        else if (action->getOverrunPolicy() == RealignOverrunPolicy)
+        {
+            action->overrunCount += (UInt32)missedPeriods;
+            action->setExecutionTime(currentTime + repeatTime);
+        }
+        else
+        {
+            // Catch up by executing each missed period in turn, one per call to getReadyActions(...),
+            // counting each period as it is found to be late
+            ++action->overrunCount;
+            action->setExecutionTime(nextExecutionTime);
+        }
+    }
+
+    void NSFTimerQueue::setTimerQueueTime(NSFTimerAction* action)
+    {
+        NSFTime earliestTime = action->getExecutionTime();
+
+        if ((action->getSlackTime() <= 0) || (earliestTime < 0))
+        {
+            action->timerQueueTime = earliestTime;
+            return;
+        }
+
+        NSFTime latestTime = earliestTime + action->getSlackTime();
+
+        // The earliest and latest times share all bits above the highest differing bit,
+        // so the most aligned time in the window is either the earliest time, if all lower bits are clear,
+        // or the latest time with the bits below the highest differing bit cleared.
+        UInt64 difference = (UInt64)earliestTime ^ (UInt64)latestTime;
+        UInt64 alignment = 1;
+        while ((difference >> 1) >= alignment)
+        {
+            alignment <<= 1;
+        }
+
+        if (((UInt64)earliestTime & ((alignment << 1) - 1)) == 0)
+        {
+            action->timerQueueTime = earliestTime;
+        }
+        else
+        {
+            action->timerQueueTime = (NSFTime)((UInt64)latestTime & ~(alignment - 1));
+        }
+    }
+}
@@ -0,0 +1,174 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TIMER_QUEUE_H
+#define NSF_TIMER_QUEUE_H
+
+#include "NSFTimerAction.h"
+
+#include <list>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents the data structure a timer thread uses to order its scheduled actions.
+    /// </summary>
+    /// <remarks>
+    /// SortedListTimerQueue keeps the actions in a sorted list, with linear time scheduling and unscheduling.
+    /// TimingWheelTimerQueue keeps the actions in a hierarchical timing wheel, with constant time scheduling and unscheduling,
+    /// and is intended for timer threads with many thousands of outstanding actions.
+    /// IndexedHeapTimerQueue keeps the actions in an indexed heap, with logarithmic time scheduling and unscheduling,
+    /// for timer threads with many outstanding actions that must execute in exact execution time order.
+    /// </remarks>
+    enum NSFTimerQueueType { SortedListTimerQueue = 1, TimingWheelTimerQueue, IndexedHeapTimerQueue };
+
+    /// <summary>
+    /// Represents the base class functionality for the queue of actions scheduled with a timer thread.
+    /// </summary>
+    /// <remarks>
+    /// Timer queues are not thread safe, and are protected by the mutex of their timer thread.
+    /// Actions are ordered by their timer queue time, which is their execution time coalesced within their slack time.
+    /// Actions with equal timer queue times are removed in the order they were inserted.
+    /// An action can be in at most one timer queue at a time.
+    /// </remarks>
+    class NSFTimerQueue
+    {
+    public:
+
+        /// <summary>
+        /// Creates a timer queue of the specified type.
+        /// </summary>
+        /// <param name="queueType">The type of timer queue.</param>
+        /// <param name="currentTime">The current time of the timer thread that uses the queue.</param>
+        /// <returns>The new timer queue.</returns>
+        static NSFTimerQueue* create(NSFTimerQueueType queueType, NSFTime currentTime);
+
+        /// <summary>
+        /// Destroys a timer queue.
+        /// </summary>
+        virtual ~NSFTimerQueue() {}
+
+        /// <summary>
+        /// Gets the type of the timer queue.
+        /// </summary>
+        virtual NSFTimerQueueType getQueueType() const = 0;
+
+        /// <summary>
+        /// Gets the time at which the timer thread must next remove ready actions.
+        /// </summary>
+        /// <returns>The time, or MaxTime if the queue is empty.</returns>
+        /// <remarks>
+        /// The time may be earlier than the execution time of any action, if the queue must reorganize itself before then.
+        /// </remarks>
+        virtual NSFTime getNextExecutionTime() const = 0;
+
+        /// <summary>
+        /// Checks if the queue is empty.
+        /// </summary>
+        virtual bool isEmpty() const = 0;
+
+        /// <summary>
+        /// Checks if an action is in the queue.
+        /// </summary>
+        /// <param name="action">The action in question.</param>
+        /// <returns>True if the action is in the queue, otherwise false.</returns>
+        bool isScheduled(NSFTimerAction* action) const { return (action->timerQueue == this); }
+
+        /// <summary>
+        /// Removes all actions from the queue without accessing them.
+        /// </summary>
+        /// <remarks>
+        /// This method is used when the timer thread terminates, at which point the actions may already be deleted.
+        /// </remarks>
+        virtual void clear() = 0;
+
+        /// <summary>
+        /// Inserts an action into the queue based on its execution time.
+        /// </summary>
+        /// <param name="action">The action to insert.</param>
+        /// <remarks>
+        /// If the action is already in the queue, it is first removed.
+        /// </remarks>
+        virtual void insertAction(NSFTimerAction* action) = 0;
+
+        /// <summary>
+        /// Removes an action from the queue.
+        /// </summary>
+        /// <param name="action">The action to remove.</param>
+        /// <remarks>
+        /// Removing an action that is not in the queue has no effect.
+        /// </remarks>
+        virtual void removeAction(NSFTimerAction* action) = 0;
+
+        /// <summary>
+        /// Removes all actions from the queue.
+        /// </summary>
+        /// <param name="removedActions">The list to which the removed actions are appended, in execution order.</param>
+        virtual void removeAllActions(std::list<NSFTimerAction*>& removedActions) = 0;
+
+        /// <summary>
+        /// Gets the actions whose execution time is at or before the current time.
+        /// </summary>
+        /// <param name="currentTime">The current time.</param>
+        /// <param name="readyActions">The empty list to which the ready actions are added, in execution order.</param>
+        /// <remarks>
+        /// Non-periodic actions are removed from the queue, and periodic actions are rescheduled at their next execution time.
+        /// Each ready action is added only once, even if its next execution time is also at or before the current time.
+        /// </remarks>
+        virtual void getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions) = 0;
+
+    protected:
+
+        /// <summary>
+        /// Creates a timer queue.
+        /// </summary>
+        NSFTimerQueue() {}
+
+        /// <summary>
+        /// Reinserts the periodic actions in a list of removed ready actions at their next execution time.
+        /// </summary>
+        /// <param name="currentTime">The current time.</param>
+        /// <param name="readyActions">The ready actions.</param>
+        void rescheduleRepeatingActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions);
+
+        /// <summary>
+        /// Advances the execution time of a periodic action to its next period, according to its overrun policy.
+        /// </summary>
+        /// <param name="currentTime">The current time.</param>
+        /// <param name="action">The periodic action, which must be inserted or re-keyed after its time is set.</param>
+        static void setNextExecutionTime(NSFTime currentTime, NSFTimerAction* action);
+
+        /// <summary>
+        /// Sets the time by which an action is ordered in the queue, from its execution time and slack time.
+        /// </summary>
+        /// <param name="action">The action, which must be inserted or re-keyed after its time is set.</param>
+        /// <remarks>
+        /// The time is the one within the action's window, from its execution time to its execution time plus slack,
+        /// with the most trailing zero bits, so that actions with overlapping windows tend to share the same time
+        /// and are removed by the same call to getReadyActions(...).
+        /// </remarks>
+        static void setTimerQueueTime(NSFTimerAction* action);
+    };
+}
+
+#endif // NSF_TIMER_QUEUE_H
@@ -1,265 +1,383 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "NSFTimerThread.h"
-
-#include "NSFEvent.h"
-#include "NSFExceptionHandler.h"
-#include "NSFTraceLog.h"
-#include <limits.h>
-
-namespace NorthStateFramework
-{
-    // Public
-
-    NSFTimerThread::NSFTimerThread(const NSFString& name)
-        : NSFThread(name, NSFOSThread::getHighestPriority()), maxAllowableTimeGap(5000), maxObservedTimeGap(0), nextTimeGapInterval(0), timer(NSFOSTimer::create(name))
-    {
-        TimeGapActions.setExceptionAction(NSFAction(this, &NSFTimerThread::handleTimeGapActionException));
-
-        startThread();
-    }
-
-    NSFTimerThread::~NSFTimerThread()
-    {
-        terminate(true);
-        delete timer;
-    }
-
-    bool NSFTimerThread::isScheduled(NSFTimerAction* action)
-    {
-        LOCK(getThreadMutex())
-        {
-            return (std::find(actions.begin(), actions.end(), action) != actions.end());
-        }
-        ENDLOCK;
-    }
-
-    void NSFTimerThread::scheduleAction(NSFTimerAction* action)
-    {
-        LOCK(getThreadMutex())
-        {
-            // Do not schedule any actions if terminating or terminated (i.e. not ready)
-            if (getTerminationStatus() != ThreadReady)
-            {
-                return;
-            }
-
-            insertAction(action);
-
-            // Set next timeout if action was inserted in the front of the list
-            if (action == actions.front())
-            {
-                timer->setNextTimeout(action->getExecutionTime());
-            }
-        }
-        ENDLOCK;
-    }
-
-    void NSFTimerThread::scheduleAction(NSFTimerAction* action, NSFTime delayTime, NSFTime repeatTime)
-    {
-        action->setExecutionTime(getCurrentTime() + delayTime);
-        action->setRepeatTime(repeatTime);
-        action->setDelayTime(delayTime);
-
-        scheduleAction(action);
-    }
-
-    void NSFTimerThread::terminate(bool waitForTerminated)
-    {
-        // Base class behavior, but return immediately so timer can be set to wake up timer thread
-        NSFThread::terminate(false);
-
-        LOCK(getThreadMutex())
-        {
-            timer->setNextTimeout(getCurrentTime());
-        }
-        ENDLOCK;
-
-        // Wait as specified for thread to terminate after waking up
-        NSFThread::terminate(waitForTerminated);
-    }
-
-    void NSFTimerThread::unscheduleAction(NSFTimerAction* action)
-    {
-        LOCK(getThreadMutex())
-        {
-            if (!actions.empty())
-            {
-                if (action == actions.front())
-                {
-                    actions.remove(action);
-
-                    if (!actions.empty())
-                    {
-                        timer->setNextTimeout(actions.front()->getExecutionTime());
-                    }
-                }
-                else
-                {
-                    actions.remove(action);
-                }
-            }
-        }
-        ENDLOCK;
-    }
-
-    // Private
-
-    void NSFTimerThread::executeAction(NSFTimerAction* action)
-    {
-        // Guard a bad action from taking down timer thread
-        try
-        {
-            action->execute();
-        }
-        catch(const std::exception& exception)
-        {
-            handleException(std::runtime_error(action->getName() + " action execution exception: " + exception.what()));
-        }
-        catch(...)
-        {
-            handleException(std::runtime_error(action->getName() + " action execution exception: unknown exception"));
-        }
-    }
-
-    void NSFTimerThread::handleTimeGapActionException(const NSFExceptionContext& context)
-    {
-        handleException(std::runtime_error(getName() + " time gap action exception: " + context.getException().what()));
-    }
-
-    void NSFTimerThread::insertAction(NSFTimerAction* action)
-    {
-        // Make sure action is not already in list
-        actions.remove(action);
-
-        // Insert into list based on execution time order
-        // Actions with equal execution times are executed in FIFO order
-        std::list<NSFTimerAction*>::iterator actionIterator;
-        for (actionIterator = actions.begin(); actionIterator != actions.end(); ++actionIterator)
-        {
-            if (action->getExecutionTime() < (*actionIterator)->getExecutionTime())
-            {
-                actions.insert(actionIterator, action);
-                return;
-            }
-        }
-
-        // Insert action at end of list if not alread inserted
-        actions.push_back(action);
-    }
-
-    void NSFTimerThread::threadLoop()
-    {
-        NSFTime currentTime = getCurrentTime();
-        std::list<NSFTimerAction*> readyActions;
-
-        while (true)
-        {
-            // Set up next timeout
-            LOCK(getThreadMutex())
-            {
-                if (!actions.empty())
-                {
-                    timer->setNextTimeout(actions.front()->getExecutionTime());
-                }
-                else
-                {
-                    timer->setNextTimeout(INT_MAX);
-                }
-            }
-            ENDLOCK;
-
-            timer->waitForNextTimeout();
-
-            // Clean up and return if terminating
-            if (getTerminationStatus() != ThreadReady)
-            {
-                actions.clear();
-                return;
-            }
-
-            currentTime = getCurrentTime();
-
-            LOCK(getThreadMutex())
-            {
-                // Create list of actions ready to execute
-                std::list<NSFTimerAction*>::iterator actionIterator;
-                for (actionIterator = actions.begin(); actionIterator != actions.end(); ++actionIterator)
-                {
-                    if ((*actionIterator)->getExecutionTime() <= currentTime)
-                    {
-                        readyActions.push_back((*actionIterator));
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-
-                // Reschedule repetitive actions
-                for (actionIterator = readyActions.begin(); actionIterator != readyActions.end(); ++actionIterator)
-                {
-                    if ((*actionIterator)->getRepeatTime() != 0)
-                    {
-                        (*actionIterator)->setExecutionTime((*actionIterator)->getExecutionTime() + (*actionIterator)->getRepeatTime());
-                        insertAction(*actionIterator);
-                    }
-                    else
-                    {
-                        actions.remove(*actionIterator);
-                    }
-                }
-            }
-            ENDLOCK;
-
-            // Check for excessive gap between current time and execution time
-            if (!readyActions.empty())
-            {
-                NSFTime timeGap = currentTime - readyActions.front()->getExecutionTime();
-
-                if ((maxAllowableTimeGap > 0) && (timeGap > maxAllowableTimeGap) && (currentTime > nextTimeGapInterval))
-                {
-                    NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::ErrorTag(), NSFTraceTags::SourceTag(), getName(), NSFTraceTags::MessageTag(), "TimeGap", NSFTraceTags::ValueTag(), toString<NSFTime>(timeGap));
-                    TimeGapActions.execute(NSFContext(this));
-
-                    // Set time when next time gap can be recorded
-                    // This prevents all gapped timer events from recording time gap trace
-                    nextTimeGapInterval = currentTime + maxAllowableTimeGap;
-                }
-
-                if (timeGap > maxObservedTimeGap)
-                {
-                    maxObservedTimeGap = timeGap;
-                }
-            }
-
-            // Execute all ready actions
-            while (!readyActions.empty())
-            {
-                executeAction(readyActions.front());
-                readyActions.pop_front();
-            }
-        }
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTimerThread.h"
+
+#include "NSFEvent.h"
+#include "NSFExceptionHandler.h"
+#include "NSFTraceLog.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTimerThread::NSFTimerThread(const NSFString& name)
+        : NSFThread(name, NSFOSThread::getHighestPriority()), maxAllowableTimeGap(5000), maxObservedTimeGap(0), nextTimeGapInterval(0), wakeupCount(0), timer(NSFOSTimer::create(name)),
+        timerQueue(NSFTimerQueue::create(SortedListTimerQueue, timer->getCurrentTime()))
+    {
+        TimeGapActions.setExceptionAction(NSFAction(this, &NSFTimerThread::handleTimeGapActionException));
+
+        startThread();
+    }
+
+    NSFTimerThread::NSFTimerThread(const NSFString& name, NSFTimerQueueType queueType)
+        : NSFThread(name, NSFOSThread::getHighestPriority()), maxAllowableTimeGap(5000), maxObservedTimeGap(0), nextTimeGapInterval(0), wakeupCount(0), timer(NSFOSTimer::create(name)),
+        timerQueue(NSFTimerQueue::create(queueType, timer->getCurrentTime()))
+    {
+        TimeGapActions.setExceptionAction(NSFAction(this, &NSFTimerThread::handleTimeGapActionException));
+
+        startThread();
+    }
+
+    NSFTimerThread::NSFTimerThread(const NSFString& name, NSFTimerQueueType queueType, NSFOSTimerType timerType)
+        : NSFThread(name, NSFOSThread::getHighestPriority()), maxAllowableTimeGap(5000), maxObservedTimeGap(0), nextTimeGapInterval(0), wakeupCount(0), timer(NSFOSTimer::create(name, timerType)),
+        timerQueue(NSFTimerQueue::create(queueType, timer->getCurrentTime()))
+    {
+        TimeGapActions.setExceptionAction(NSFAction(this, &NSFTimerThread::handleTimeGapActionException));
+
+        startThread();
+    }
+
+    NSFTimerThread::NSFTimerThread(const NSFString& name, NSFTimerQueueType queueType, NSFOSTimer* timer)
+        : NSFThread(name, NSFOSThread::getHighestPriority()), maxAllowableTimeGap(5000), maxObservedTimeGap(0), nextTimeGapInterval(0), wakeupCount(0), timer(timer),
+        timerQueue(NSFTimerQueue::create(queueType, timer->getCurrentTime()))
+    {
+        TimeGapActions.setExceptionAction(NSFAction(this, &NSFTimerThread::handleTimeGapActionException));
+
+        startThread();
+    }
+
+    NSFTimerThread::~NSFTimerThread()
+    {
+        terminate(true);
+        delete timerQueue;
+        delete timer;
+
+        std::list<NSFOSTimer*>::iterator timerIterator;
+        for (timerIterator = retiredTimers.begin(); timerIterator != retiredTimers.end(); ++timerIterator)
+        {
+            delete *timerIterator;
+        }
+    }
+
+    NSFTimerQueueType NSFTimerThread::getTimerQueueType()
+    {
+        LOCK(getThreadMutex())
+        {
+            return timerQueue->getQueueType();
+        }
+        ENDLOCK;
+    }
+
+    void NSFTimerThread::setTimerQueueType(NSFTimerQueueType value)
+    {
+        LOCK(getThreadMutex())
+        {
+            if (value == timerQueue->getQueueType())
+            {
+                return;
+            }
+
+            NSFTimerQueue* newTimerQueue = NSFTimerQueue::create(value, getCurrentTime());
+
+            // Move scheduled actions to the new queue in execution order, so that FIFO order is preserved for equal execution times
+            std::list<NSFTimerAction*> scheduledActions;
+            timerQueue->removeAllActions(scheduledActions);
+
+            std::list<NSFTimerAction*>::iterator actionIterator;
+            for (actionIterator = scheduledActions.begin(); actionIterator != scheduledActions.end(); ++actionIterator)
+            {
+                newTimerQueue->insertAction(*actionIterator);
+            }
+
+            delete timerQueue;
+            timerQueue = newTimerQueue;
+
+            timer->setNextTimeout(timerQueue->getNextExecutionTime());
+        }
+        ENDLOCK;
+    }
+
+    void NSFTimerThread::setTimer(NSFOSTimer* value)
+    {
+        LOCK(getThreadMutex())
+        {
+            NSFOSTimer* previousTimer = timer;
+            NSFTime previousTime = previousTimer->getCurrentTime();
+            NSFTime newTime = value->getCurrentTime();
+
+            // Move scheduled actions to a queue based on the new time, keeping their remaining delays and execution order
+            NSFTimerQueue* newTimerQueue = NSFTimerQueue::create(timerQueue->getQueueType(), newTime);
+
+            std::list<NSFTimerAction*> scheduledActions;
+            timerQueue->removeAllActions(scheduledActions);
+
+            std::list<NSFTimerAction*>::iterator actionIterator;
+            for (actionIterator = scheduledActions.begin(); actionIterator != scheduledActions.end(); ++actionIterator)
+            {
+                (*actionIterator)->setExecutionTime((*actionIterator)->getExecutionTime() - previousTime + newTime);
+                newTimerQueue->insertAction(*actionIterator);
+            }
+
+            delete timerQueue;
+            timerQueue = newTimerQueue;
+
+            retiredTimers.push_back(previousTimer);
+            timer = value;
+
+            if (getTerminationStatus() == ThreadReady)
+            {
+                timer->setNextTimeout(timerQueue->getNextExecutionTime());
+            }
+            else
+            {
+                timer->setNextTimeout(timer->getCurrentTime());
+            }
+
+            // Wake the timer thread if it is waiting on the previous timer, so that it waits on the new one
+            previousTimer->setNextTimeout(previousTime);
+        }
+        ENDLOCK;
+    }
+
+    bool NSFTimerThread::isScheduled(NSFTimerAction* action)
+    {
+        LOCK(getThreadMutex())
+        {
+            // The queue is cleared without accessing its actions when the thread terminates
+            if (getTerminationStatus() != ThreadReady)
+            {
+                return false;
+            }
+
+            return timerQueue->isScheduled(action);
+        }
+        ENDLOCK;
+    }
+
+    void NSFTimerThread::scheduleAction(NSFTimerAction* action)
+    {
+        // An action held by another thread must leave that thread's queue first
+        action->unscheduleFromTimerThread(this);
+
+        LOCK(getThreadMutex())
+        {
+            // Do not schedule any actions if terminating or terminated (i.e. not ready)
+            if (getTerminationStatus() != ThreadReady)
+            {
+                return;
+            }
+
+            NSFTime nextExecutionTime = timerQueue->getNextExecutionTime();
+
+            timerQueue->insertAction(action);
+            action->timerThread = this;
+
+            // Set next timeout if action was inserted in the front of the queue
+            if (timerQueue->getNextExecutionTime() < nextExecutionTime)
+            {
+                timer->setNextTimeout(timerQueue->getNextExecutionTime());
+            }
+        }
+        ENDLOCK;
+    }
+
+    void NSFTimerThread::scheduleAction(NSFTimerAction* action, NSFTime delayTime, NSFTime repeatTime)
+    {
+        action->setExecutionTime(getCurrentTime() + delayTime);
+        action->setRepeatTime(repeatTime);
+        action->setDelayTime(delayTime);
+
+        scheduleAction(action);
+    }
+
+    void NSFTimerThread::terminate(bool waitForTerminated)
+    {
+        // Base class behavior, but return immediately so timer can be set to wake up timer thread
+        NSFThread::terminate(false);
+
+        LOCK(getThreadMutex())
+        {
+            timer->setNextTimeout(getCurrentTime());
+        }
+        ENDLOCK;
+
+        // Wait as specified for thread to terminate after waking up
+        NSFThread::terminate(waitForTerminated);
+    }
+
+    void NSFTimerThread::unscheduleAction(NSFTimerAction* action)
+    {
+        LOCK(getThreadMutex())
+        {
+            if (action->timerThread == this)
+            {
+                action->timerThread = NULL;
+            }
+
+            // The queue is cleared without accessing its actions when the thread terminates
+            if ((getTerminationStatus() != ThreadReady) || !timerQueue->isScheduled(action))
+            {
+                return;
+            }
+
+            NSFTime nextExecutionTime = timerQueue->getNextExecutionTime();
+
+            timerQueue->removeAction(action);
+
+            // Set next timeout if action was removed from the front of the queue
+            if (!timerQueue->isEmpty() && (timerQueue->getNextExecutionTime() != nextExecutionTime))
+            {
+                timer->setNextTimeout(timerQueue->getNextExecutionTime());
+            }
+        }
+        ENDLOCK;
+    }
+
+    // Private
+
+    void NSFTimerThread::executeAction(NSFTimerAction* action)
+    {
+        // Guard a bad action from taking down timer thread
+        try
+        {
+            action->execute();
+        }
+        catch(const std::exception& exception)
+        {
+            handleException(std::runtime_error(action->getName() + " action execution exception: " + exception.what()));
+        }
+        catch(...)
+        {
+            handleException(std::runtime_error(action->getName() + " action execution exception: unknown exception"));
+        }
+    }
+
+    void NSFTimerThread::handleTimeGapActionException(const NSFExceptionContext& context)
+    {
+        handleException(std::runtime_error(getName() + " time gap action exception: " + context.getException().what()));
+    }
+
+    void NSFTimerThread::threadLoop()
+    {
+        NSFTime currentTime = getCurrentTime();
+        std::list<NSFTimerAction*> readyActions;
+
+        while (true)
+        {
+            // The timer is read under the lock, as it may be replaced by setTimer(...)
+            NSFOSTimer* waitTimer;
+
+            // Set up next timeout, without overriding the immediate timeout set by terminate(...),
+            // as a timer armed with a deadline does not remember that an earlier deadline was requested
+            LOCK(getThreadMutex())
+            {
+                waitTimer = timer;
+
+                if (getTerminationStatus() == ThreadReady)
+                {
+                    timer->setNextTimeout(timerQueue->getNextExecutionTime());
+                }
+                else
+                {
+                    timer->setNextTimeout(getCurrentTime());
+                }
+            }
+            ENDLOCK;
+
+            waitTimer->waitForNextTimeout();
+
+            // Clean up and return if terminating
+            if (getTerminationStatus() != ThreadReady)
+            {
+                LOCK(getThreadMutex())
+                {
+                    timerQueue->clear();
+                }
+                ENDLOCK;
+
+                return;
+            }
+
+            ++wakeupCount;
+            currentTime = getCurrentTime();
+            NSFTime nextExecutionTime;
+
+            LOCK(getThreadMutex())
+            {
+                // Record the time the first ready action was due, before repetitive actions are rescheduled
+                nextExecutionTime = timerQueue->getNextExecutionTime();
+
+                // Create list of actions ready to execute, rescheduling repetitive actions
+                timerQueue->getReadyActions(currentTime, readyActions);
+
+                // Actions that are not periodic are no longer held by this thread
+                std::list<NSFTimerAction*>::iterator actionIterator;
+                for (actionIterator = readyActions.begin(); actionIterator != readyActions.end(); ++actionIterator)
+                {
+                    if (!timerQueue->isScheduled(*actionIterator))
+                    {
+                        (*actionIterator)->timerThread = NULL;
+                    }
+                }
+            }
+            ENDLOCK;
+
+            // Check for excessive gap between current time and execution time
+            if (!readyActions.empty())
+            {
+                NSFTime timeGap = currentTime - nextExecutionTime;
+
+                // The allowable time gap is in milli-seconds, regardless of the time units
+                NSFTime allowableTimeGap = maxAllowableTimeGap * TimeUnitsPerMilliSecond;
+
+                if ((allowableTimeGap > 0) && (timeGap > allowableTimeGap) && (currentTime > nextTimeGapInterval))
+                {
+#if NSF_TRACE_LEVEL >= NSF_TRACE_LEVEL_ERROR
+                    if (NSFTraceLog::getPrimaryTraceLog().isTraceEnabled(ErrorTraceCategory))
+                    {
+                        NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::ErrorTag(), NSFTraceTags::SourceTag(), getName(), NSFTraceTags::MessageTag(), "TimeGap", NSFTraceTags::ValueTag(), toString<NSFTime>(timeGap));
+                    }
+#endif
+                    TimeGapActions.execute(NSFContext(this));
+
+                    // Set time when next time gap can be recorded
+                    // This prevents all gapped timer events from recording time gap trace
+                    nextTimeGapInterval = currentTime + allowableTimeGap;
+                }
+
+                if (timeGap > maxObservedTimeGap)
+                {
+                    maxObservedTimeGap = timeGap;
+                }
+            }
+
+            // Execute all ready actions, each event thread being woken only by the first event queued to it
+            while (!readyActions.empty())
+            {
+                executeAction(readyActions.front());
+                readyActions.pop_front();
+            }
+        }
+    }
+}
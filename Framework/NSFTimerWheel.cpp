@@ -0,0 +1,357 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTimerWheel.h"
+
+namespace NorthStateFramework
+{
+    const NSFTime NSFTimerWheel::WheelSpan = (NSFTime)1 << (SlotBits * NumberOfLevels);
+
+    // Public
+
+    NSFTimerWheel::NSFTimerWheel(NSFTime currentTime)
+        : wheelTime(currentTime), actionCount(0)
+    {
+        clear();
+    }
+
+    NSFTime NSFTimerWheel::getNextExecutionTime() const
+    {
+        if (actionCount == 0)
+        {
+            return MaxTime;
+        }
+
+        // Overdue actions are ready immediately
+        if (actionLists[OverdueList].head != NULL)
+        {
+            return actionLists[OverdueList].head->timerQueueTime;
+        }
+
+        NSFTime nextTime = MaxTime;
+        getNextWheelTime(nextTime);
+
+        return nextTime;
+    }
+
+    void NSFTimerWheel::clear()
+    {
+        for (UInt32 i = 0; i < NumberOfLists; ++i)
+        {
+            actionLists[i].head = NULL;
+            actionLists[i].tail = NULL;
+        }
+
+        for (UInt32 level = 0; level < NumberOfLevels; ++level)
+        {
+            for (UInt32 word = 0; word < WordsPerLevel; ++word)
+            {
+                occupiedSlots[level][word] = 0;
+            }
+        }
+
+        actionCount = 0;
+    }
+
+    void NSFTimerWheel::insertAction(NSFTimerAction* action)
+    {
+        // Make sure action is not already in the wheel
+        if (isScheduled(action))
+        {
+            unlinkAction(action);
+        }
+        else
+        {
+            ++actionCount;
+        }
+
+        setTimerQueueTime(action);
+        appendAction(getListIndex(action->timerQueueTime), action);
+    }
+
+    void NSFTimerWheel::removeAction(NSFTimerAction* action)
+    {
+        if (!isScheduled(action))
+        {
+            return;
+        }
+
+        unlinkAction(action);
+        --actionCount;
+    }
+
+    void NSFTimerWheel::removeAllActions(std::list<NSFTimerAction*>& removedActions)
+    {
+        std::list<NSFTimerAction*> wheelActions;
+
+        for (UInt32 i = 0; i < NumberOfLists; ++i)
+        {
+            removeActions(i, wheelActions);
+        }
+
+        // Actions with equal execution times are always in the same list, so a stable sort preserves their FIFO order
+        wheelActions.sort(isEarlier);
+        removedActions.splice(removedActions.end(), wheelActions);
+    }
+
+    void NSFTimerWheel::getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions)
+    {
+        removeActions(OverdueList, readyActions);
+
+        while (wheelTime <= currentTime)
+        {
+            // All actions in the lowest level slot at the wheel time execute at the wheel time
+            removeActions((UInt32)(wheelTime & SlotMask), readyActions);
+
+            // Skip directly to the next time of interest, as slots in between are empty
+            NSFTime nextTime = currentTime + 1;
+            NSFTime nextWheelTime;
+            if (getNextWheelTime(nextWheelTime) && (nextWheelTime < nextTime))
+            {
+                nextTime = nextWheelTime;
+            }
+
+            wheelTime = nextTime;
+            cascade();
+        }
+
+        rescheduleRepeatingActions(currentTime, readyActions);
+    }
+
+    // Private
+
+    void NSFTimerWheel::appendAction(UInt32 listIndex, NSFTimerAction* action)
+    {
+        ActionList& actionList = actionLists[listIndex];
+
+        action->timerQueue = this;
+        action->timerQueueIndex = listIndex;
+        action->previousTimerAction = actionList.tail;
+        action->nextTimerAction = NULL;
+
+        if (actionList.tail == NULL)
+        {
+            actionList.head = action;
+
+            if (listIndex < OverflowList)
+            {
+                occupiedSlots[listIndex / SlotsPerLevel][(listIndex & SlotMask) / 64] |= ((UInt64)1 << (listIndex & 63));
+            }
+        }
+        else
+        {
+            actionList.tail->nextTimerAction = action;
+        }
+
+        actionList.tail = action;
+    }
+
+    void NSFTimerWheel::cascade()
+    {
+        UInt64 time = (UInt64)wheelTime;
+
+        // A level's current slot is moved down only when all levels below it have wrapped around
+        for (UInt32 level = 1; level < NumberOfLevels; ++level)
+        {
+            if ((time & (((UInt64)1 << (SlotBits * level)) - 1)) != 0)
+            {
+                return;
+            }
+
+            reinsertActions((level * SlotsPerLevel) + (UInt32)((time >> (SlotBits * level)) & SlotMask));
+        }
+
+        if ((time & ((UInt64)WheelSpan - 1)) == 0)
+        {
+            reinsertActions(OverflowList);
+        }
+    }
+
+    UInt32 NSFTimerWheel::findOccupiedSlot(UInt32 level, UInt32 firstSlot) const
+    {
+        for (UInt32 word = firstSlot / 64; word < WordsPerLevel; ++word)
+        {
+            UInt64 bits = occupiedSlots[level][word];
+
+            // Ignore slots before the first slot in the first word
+            if (word == firstSlot / 64)
+            {
+                bits &= ~(((UInt64)1 << (firstSlot & 63)) - 1);
+            }
+
+            if (bits != 0)
+            {
+                return (word * 64) + getLowestSetBit(bits);
+            }
+        }
+
+        return SlotsPerLevel;
+    }
+
+    UInt32 NSFTimerWheel::getListIndex(NSFTime executionTime) const
+    {
+        if (executionTime < wheelTime)
+        {
+            return OverdueList;
+        }
+
+        // The level is determined by the highest bit in which the execution time differs from the wheel time
+        UInt64 difference = (UInt64)executionTime ^ (UInt64)wheelTime;
+
+        for (UInt32 level = 0; level < NumberOfLevels; ++level)
+        {
+            if (difference < ((UInt64)1 << (SlotBits * (level + 1))))
+            {
+                return (level * SlotsPerLevel) + (UInt32)(((UInt64)executionTime >> (SlotBits * level)) & SlotMask);
+            }
+        }
+
+        return OverflowList;
+    }
+
+    bool NSFTimerWheel::getNextWheelTime(NSFTime& nextTime) const
+    {
+        UInt64 time = (UInt64)wheelTime;
+
+        // Occupied slots in lower levels always precede occupied slots in higher levels
+        for (UInt32 level = 0; level < NumberOfLevels; ++level)
+        {
+            UInt32 levelShift = SlotBits * level;
+            UInt32 currentSlot = (UInt32)((time >> levelShift) & SlotMask);
+
+            // Slots above the lowest level never hold actions at their current slot, as these are moved down when the slot is reached
+            UInt32 slot = findOccupiedSlot(level, (level == 0) ? currentSlot : currentSlot + 1);
+
+            if (slot < SlotsPerLevel)
+            {
+                UInt64 windowStart = time & ~((((UInt64)1 << (levelShift + SlotBits))) - 1);
+                nextTime = (NSFTime)(windowStart + ((UInt64)slot << levelShift));
+                return true;
+            }
+        }
+
+        if (actionLists[OverflowList].head != NULL)
+        {
+            nextTime = (NSFTime)((time & ~((UInt64)WheelSpan - 1)) + (UInt64)WheelSpan);
+            return true;
+        }
+
+        return false;
+    }
+
+    void NSFTimerWheel::removeActions(UInt32 listIndex, std::list<NSFTimerAction*>& removedActions)
+    {
+        NSFTimerAction* action = actionLists[listIndex].head;
+
+        while (action != NULL)
+        {
+            NSFTimerAction* nextAction = action->nextTimerAction;
+
+            unlinkAction(action);
+            --actionCount;
+            removedActions.push_back(action);
+
+            action = nextAction;
+        }
+    }
+
+    void NSFTimerWheel::reinsertActions(UInt32 listIndex)
+    {
+        NSFTimerAction* action = actionLists[listIndex].head;
+
+        // Detach the list before reinserting, as actions that still belong in it, such as those still beyond the wheel's span, are appended to it again
+        actionLists[listIndex].head = NULL;
+        actionLists[listIndex].tail = NULL;
+
+        if (listIndex < OverflowList)
+        {
+            occupiedSlots[listIndex / SlotsPerLevel][(listIndex & SlotMask) / 64] &= ~((UInt64)1 << (listIndex & 63));
+        }
+
+        while (action != NULL)
+        {
+            NSFTimerAction* nextAction = action->nextTimerAction;
+
+            appendAction(getListIndex(action->timerQueueTime), action);
+
+            action = nextAction;
+        }
+    }
+
+    void NSFTimerWheel::unlinkAction(NSFTimerAction* action)
+    {
+        UInt32 listIndex = action->timerQueueIndex;
+        ActionList& actionList = actionLists[listIndex];
+
+        if (action->previousTimerAction == NULL)
+        {
+            actionList.head = action->nextTimerAction;
+        }
+        else
+        {
+            action->previousTimerAction->nextTimerAction = action->nextTimerAction;
+        }
+
+        if (action->nextTimerAction == NULL)
+        {
+            actionList.tail = action->previousTimerAction;
+        }
+        else
+        {
+            action->nextTimerAction->previousTimerAction = action->previousTimerAction;
+        }
+
+        if ((actionList.head == NULL) && (listIndex < OverflowList))
+        {
+            occupiedSlots[listIndex / SlotsPerLevel][(listIndex & SlotMask) / 64] &= ~((UInt64)1 << (listIndex & 63));
+        }
+
+        action->timerQueue = NULL;
+        action->previousTimerAction = NULL;
+        action->nextTimerAction = NULL;
+    }
+
+    bool NSFTimerWheel::isEarlier(NSFTimerAction* action1, NSFTimerAction* action2)
+    {
+        return (action1->timerQueueTime < action2->timerQueueTime);
+    }
+
+    UInt32 NSFTimerWheel::getLowestSetBit(UInt64 value)
+    {
+        UInt32 bit = 0;
+
+        // Binary search for the lowest set bit
+        for (UInt32 width = 32; width > 0; width >>= 1)
+        {
+            UInt64 mask = ((UInt64)1 << width) - 1;
+
+            if ((value & mask) == 0)
+            {
+                value >>= width;
+                bit += width;
+            }
+        }
+
+        return bit;
+    }
+}
@@ -0,0 +1,169 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TIMER_WHEEL_H
+#define NSF_TIMER_WHEEL_H
+
+#include "NSFTimerQueue.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a timer queue that keeps its actions in a hierarchical timing wheel.
+    /// </summary>
+    /// <remarks>
+    /// The wheel has levels of 256 slots, with a resolution of one time unit at the lowest level.
+    /// Finer time units use more levels, so that ordinary timeouts stay within the wheel:
+    /// four levels span 2^32 milli-seconds (about 49.7 days), five levels span 2^40 micro-seconds (about 12.7 days),
+    /// and six levels span 2^48 nano-seconds (about 3.3 days).  Actions further in the future are held in an overflow list,
+    /// which is reexamined each time the wheel completes a revolution of its highest level.
+    /// Each action records the slot it occupies, so inserting and removing an action takes constant time, regardless of the number of actions.
+    /// An action is placed in the lowest level whose slot covers its execution time, and is moved to a lower level
+    /// when the wheel time reaches the start of its slot.  Moving preserves the insertion order of the actions,
+    /// so actions with equal execution times are removed in FIFO order.
+    /// Actions scheduled for a time the wheel has already passed are held in an overdue list, and are removed first, in the order they were inserted.
+    /// </remarks>
+    class NSFTimerWheel : public NSFTimerQueue
+    {
+    public:
+
+        /// <summary>
+        /// Creates a timing wheel timer queue.
+        /// </summary>
+        /// <param name="currentTime">The current time, at which the wheel starts.</param>
+        NSFTimerWheel(NSFTime currentTime);
+
+        /// <summary>
+        /// The time spanned by the levels of the wheel, beyond which actions are held in the overflow list.
+        /// </summary>
+        static const NSFTime WheelSpan;
+
+        virtual NSFTimerQueueType getQueueType() const { return TimingWheelTimerQueue; }
+
+        virtual NSFTime getNextExecutionTime() const;
+
+        virtual bool isEmpty() const { return (actionCount == 0); }
+
+        virtual void clear();
+
+        virtual void insertAction(NSFTimerAction* action);
+
+        virtual void removeAction(NSFTimerAction* action);
+
+        virtual void removeAllActions(std::list<NSFTimerAction*>& removedActions);
+
+        virtual void getReadyActions(NSFTime currentTime, std::list<NSFTimerAction*>& readyActions);
+
+    private:
+
+        static const UInt32 SlotBits = 8;
+        static const UInt32 SlotsPerLevel = 1 << SlotBits;
+        static const UInt32 SlotMask = SlotsPerLevel - 1;
+#if defined NSF_TIME_NANOSECONDS
+        static const UInt32 NumberOfLevels = 6;
+#elif defined NSF_TIME_MICROSECONDS
+        static const UInt32 NumberOfLevels = 5;
+#else
+        static const UInt32 NumberOfLevels = 4;
+#endif
+        static const UInt32 OverflowList = NumberOfLevels * SlotsPerLevel;
+        static const UInt32 OverdueList = OverflowList + 1;
+        static const UInt32 NumberOfLists = OverdueList + 1;
+        static const UInt32 WordsPerLevel = SlotsPerLevel / 64;
+
+        /// <summary>
+        /// Represents an intrusive list of actions, linked through the actions themselves.
+        /// </summary>
+        struct ActionList
+        {
+            NSFTimerAction* head;
+            NSFTimerAction* tail;
+        };
+
+        ActionList actionLists[NumberOfLists];
+        UInt64 occupiedSlots[NumberOfLevels][WordsPerLevel];
+        NSFTime wheelTime;
+        UInt32 actionCount;
+
+        /// <summary>
+        /// Appends an action to the specified list.
+        /// </summary>
+        void appendAction(UInt32 listIndex, NSFTimerAction* action);
+
+        /// <summary>
+        /// Moves the actions in the lower level slots at the wheel time down the wheel.
+        /// </summary>
+        /// <remarks>
+        /// This method must be called each time the wheel time advances to the start of a slot in a level above the lowest.
+        /// </remarks>
+        void cascade();
+
+        /// <summary>
+        /// Finds the first occupied slot in a level, starting with the specified slot.
+        /// </summary>
+        /// <returns>The index of the occupied slot, or SlotsPerLevel if there are none.</returns>
+        UInt32 findOccupiedSlot(UInt32 level, UInt32 firstSlot) const;
+
+        /// <summary>
+        /// Gets the index of the list in which an action with the specified execution time belongs.
+        /// </summary>
+        UInt32 getListIndex(NSFTime executionTime) const;
+
+        /// <summary>
+        /// Gets the next time at which the wheel holds actions to remove or move down a level.
+        /// </summary>
+        /// <param name="nextTime">The next time, if any.</param>
+        /// <returns>True if the wheel holds any actions, otherwise false.</returns>
+        /// <remarks>
+        /// Actions in the overdue list are not considered.
+        /// </remarks>
+        bool getNextWheelTime(NSFTime& nextTime) const;
+
+        /// <summary>
+        /// Removes all actions in the specified list, appending them to another list in order.
+        /// </summary>
+        void removeActions(UInt32 listIndex, std::list<NSFTimerAction*>& removedActions);
+
+        /// <summary>
+        /// Reinserts all actions in the specified list into the lists where they belong at the wheel time.
+        /// </summary>
+        void reinsertActions(UInt32 listIndex);
+
+        /// <summary>
+        /// Removes an action from its list, without changing the action count.
+        /// </summary>
+        void unlinkAction(NSFTimerAction* action);
+
+        /// <summary>
+        /// Compares the execution times of two actions, for sorting.
+        /// </summary>
+        static bool isEarlier(NSFTimerAction* action1, NSFTimerAction* action2);
+
+        /// <summary>
+        /// Gets the index of the lowest set bit in a non-zero value.
+        /// </summary>
+        static UInt32 getLowestSetBit(UInt64 value);
+    };
+}
+
+#endif // NSF_TIMER_WHEEL_H
@@ -0,0 +1,534 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTraceBinaryFile.h"
+
+#include "NSFTraceLog.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string.h>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTraceBinaryFile::NSFTraceBinaryFile()
+        : compressionEnabled(true)
+    {
+    }
+
+    void NSFTraceBinaryFile::addTrace(NSFTime time, const NSFString& type, const NSFString& tag1, const NSFString& data1,
+        const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3)
+    {
+        Trace trace;
+
+        trace.time = time;
+        trace.typeId = getStringId(type);
+        trace.tagCount = 1;
+        trace.tagIds[0] = getStringId(tag1);
+        trace.dataIds[0] = getStringId(data1);
+
+        // As in a saved trace log, the first tag is always present, while the others are present only if not empty
+        if (!tag2.empty())
+        {
+            trace.tagIds[trace.tagCount] = getStringId(tag2);
+            trace.dataIds[trace.tagCount] = getStringId(data2);
+            ++trace.tagCount;
+        }
+
+        if (!tag3.empty())
+        {
+            trace.tagIds[trace.tagCount] = getStringId(tag3);
+            trace.dataIds[trace.tagCount] = getStringId(data3);
+            ++trace.tagCount;
+        }
+
+        traces.push_back(trace);
+    }
+
+    void NSFTraceBinaryFile::clear()
+    {
+        std::vector<Trace>().swap(traces);
+        std::vector<NSFString>().swap(strings);
+        stringIds.clear();
+    }
+
+    void NSFTraceBinaryFile::load(const NSFString& fileName)
+    {
+        std::ifstream file(fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open binary trace file " + fileName);
+        }
+
+        std::vector<UInt8> fileData;
+        char buffer[BlockSize];
+
+        while (file.read(buffer, sizeof(buffer)) || (file.gcount() > 0))
+        {
+            fileData.insert(fileData.end(), (UInt8*)buffer, (UInt8*)buffer + file.gcount());
+        }
+
+        if ((fileData.size() < FileIdentifier().size()) || (NSFString((char*)&fileData[0], FileIdentifier().size()) != FileIdentifier()))
+        {
+            throw std::runtime_error(fileName + " is not a binary trace file");
+        }
+
+        std::vector<UInt8>::size_type position = FileIdentifier().size();
+
+        if (readUInt(fileData, position) > FormatVersion)
+        {
+            throw std::runtime_error(fileName + " has an unsupported binary trace file version");
+        }
+
+        UInt64 flags = readUInt(fileData, position);
+
+        std::vector<UInt8> data;
+
+        if ((flags & CompressedFlag) != 0)
+        {
+            while (position < fileData.size())
+            {
+                UInt64 length = readUInt(fileData, position);
+                UInt64 compressedLength = readUInt(fileData, position);
+
+                if ((length > BlockSize) || (compressedLength > (fileData.size() - position)))
+                {
+                    throw std::runtime_error("Binary trace file is corrupt");
+                }
+
+                decompressBlock(fileData, position, position + (std::vector<UInt8>::size_type)compressedLength, (UInt32)length, data);
+            }
+        }
+        else
+        {
+            data.assign(fileData.begin() + position, fileData.end());
+        }
+
+        std::vector<UInt8>().swap(fileData);
+
+        clear();
+        position = 0;
+
+        UInt64 stringCount = readUInt(data, position);
+
+        for (UInt64 i = 0; i < stringCount; ++i)
+        {
+            UInt64 length = readUInt(data, position);
+
+            if (length > (data.size() - position))
+            {
+                throw std::runtime_error("Binary trace file is truncated");
+            }
+
+            NSFString string;
+            if (length != 0)
+            {
+                string.assign((char*)&data[position], (NSFString::size_type)length);
+            }
+
+            position += (std::vector<UInt8>::size_type)length;
+
+            stringIds[string] = (UInt32)strings.size();
+            strings.push_back(string);
+        }
+
+        UInt64 traceCount = readUInt(data, position);
+        NSFTime time = 0;
+
+        for (UInt64 i = 0; i < traceCount; ++i)
+        {
+            Trace trace;
+
+            // Time differences are zigzag encoded, so that small negative differences are also small values
+            UInt64 timeDifference = readUInt(data, position);
+            time += (NSFTime)((timeDifference >> 1) ^ (~(timeDifference & 1) + 1));
+
+            trace.time = time;
+            trace.typeId = readStringId(data, position);
+            trace.tagCount = (UInt32)readUInt(data, position);
+
+            if ((trace.tagCount == 0) || (trace.tagCount > 3))
+            {
+                throw std::runtime_error("Binary trace file is corrupt");
+            }
+
+            for (UInt32 j = 0; j < trace.tagCount; ++j)
+            {
+                trace.tagIds[j] = readStringId(data, position);
+                trace.dataIds[j] = readStringId(data, position);
+            }
+
+            traces.push_back(trace);
+        }
+    }
+
+    void NSFTraceBinaryFile::save(const NSFString& fileName)
+    {
+        std::vector<UInt8> data;
+
+        writeUInt(strings.size(), data);
+
+        for (std::vector<NSFString>::size_type i = 0; i < strings.size(); ++i)
+        {
+            writeUInt(strings[i].size(), data);
+            data.insert(data.end(), strings[i].begin(), strings[i].end());
+        }
+
+        writeUInt(traces.size(), data);
+        NSFTime time = 0;
+
+        for (std::vector<Trace>::size_type i = 0; i < traces.size(); ++i)
+        {
+            const Trace& trace = traces[i];
+
+            Int64 timeDifference = trace.time - time;
+            writeUInt((UInt64)((timeDifference << 1) ^ (timeDifference >> 63)), data);
+            time = trace.time;
+
+            writeUInt(trace.typeId, data);
+            writeUInt(trace.tagCount, data);
+
+            for (UInt32 j = 0; j < trace.tagCount; ++j)
+            {
+                writeUInt(trace.tagIds[j], data);
+                writeUInt(trace.dataIds[j], data);
+            }
+        }
+
+        std::vector<UInt8> fileData(FileIdentifier().begin(), FileIdentifier().end());
+        writeUInt(FormatVersion, fileData);
+        writeUInt(compressionEnabled ? CompressedFlag : 0, fileData);
+
+        if (compressionEnabled)
+        {
+            std::vector<UInt8> block;
+
+            for (std::vector<UInt8>::size_type start = 0; start < data.size(); start += BlockSize)
+            {
+                UInt32 length = (UInt32)std::min<std::vector<UInt8>::size_type>(BlockSize, data.size() - start);
+
+                block.clear();
+                compressBlock(data, start, length, block);
+
+                writeUInt(length, fileData);
+                writeUInt(block.size(), fileData);
+                fileData.insert(fileData.end(), block.begin(), block.end());
+            }
+        }
+        else
+        {
+            fileData.insert(fileData.end(), data.begin(), data.end());
+        }
+
+        std::ofstream file(fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open binary trace file " + fileName);
+        }
+
+        if (!fileData.empty())
+        {
+            file.write((const char*)&fileData[0], fileData.size());
+        }
+
+        if (!file.good())
+        {
+            throw std::runtime_error("Unable to write binary trace file " + fileName);
+        }
+    }
+
+    void NSFTraceBinaryFile::saveCSV(const NSFString& fileName)
+    {
+        std::ofstream file(fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open file " + fileName);
+        }
+
+        NSFString text = "Time,Type,Tag1,Data1,Tag2,Data2,Tag3,Data3\n";
+
+        for (std::vector<Trace>::size_type i = 0; i < traces.size(); ++i)
+        {
+            const Trace& trace = traces[i];
+
+            text += toString(trace.time);
+            text += ',';
+            appendCSVValue(strings[trace.typeId], text);
+
+            for (UInt32 j = 0; j < trace.tagCount; ++j)
+            {
+                text += ',';
+                appendCSVValue(strings[trace.tagIds[j]], text);
+                text += ',';
+                appendCSVValue(strings[trace.dataIds[j]], text);
+            }
+
+            text += '\n';
+
+            // Write the text a block at a time, as the whole file may be very large
+            if (text.size() >= BlockSize)
+            {
+                file.write(text.data(), text.size());
+                text.clear();
+            }
+        }
+
+        file.write(text.data(), text.size());
+
+        if (!file.good())
+        {
+            throw std::runtime_error("Unable to write file " + fileName);
+        }
+    }
+
+    void NSFTraceBinaryFile::saveXML(const NSFString& fileName)
+    {
+        std::ofstream file(fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open file " + fileName);
+        }
+
+        NSFString text = "<" + NSFTraceLog::TraceLogTag() + ">\n";
+
+        for (std::vector<Trace>::size_type i = 0; i < traces.size(); ++i)
+        {
+            const Trace& trace = traces[i];
+            const NSFString& type = strings[trace.typeId];
+
+            text += "<" + NSFTraceLog::TraceTag() + ">\n";
+            text += "<" + NSFTraceLog::TimeTag() + ">" + toString(trace.time) + "</" + NSFTraceLog::TimeTag() + ">\n";
+            text += "<" + type + ">\n";
+
+            for (UInt32 j = 0; j < trace.tagCount; ++j)
+            {
+                const NSFString& tag = strings[trace.tagIds[j]];
+                text += "<" + tag + ">";
+                NSFTraceLog::appendEscapedText(strings[trace.dataIds[j]], text);
+                text += "</" + tag + ">\n";
+            }
+
+            text += "</" + type + ">\n";
+            text += "</" + NSFTraceLog::TraceTag() + ">\n";
+
+            // Write the text a block at a time, as the whole file may be very large
+            if (text.size() >= BlockSize)
+            {
+                file.write(text.data(), text.size());
+                text.clear();
+            }
+        }
+
+        text += "</" + NSFTraceLog::TraceLogTag() + ">\n";
+        file.write(text.data(), text.size());
+
+        if (!file.good())
+        {
+            throw std::runtime_error("Unable to write file " + fileName);
+        }
+    }
+
+    // Private
+
+    void NSFTraceBinaryFile::appendCSVValue(const NSFString& value, NSFString& text)
+    {
+        if (value.find_first_of(",\"\r\n") == NSFString::npos)
+        {
+            text += value;
+            return;
+        }
+
+        text += '"';
+
+        for (NSFString::size_type i = 0; i < value.size(); ++i)
+        {
+            if (value[i] == '"')
+            {
+                text += '"';
+            }
+
+            text += value[i];
+        }
+
+        text += '"';
+    }
+
+    void NSFTraceBinaryFile::compressBlock(const std::vector<UInt8>& data, std::vector<UInt8>::size_type start, UInt32 length, std::vector<UInt8>& block)
+    {
+        const UInt32 HashBits = 12;
+        const UInt32 NoPosition = 0xFFFFFFFF;
+
+        // Most recent position in the block of each hashed sequence of the minimum match length
+        std::vector<UInt32> positions(1 << HashBits, NoPosition);
+
+        const UInt8* bytes = &data[start];
+        UInt32 literalStart = 0;
+        UInt32 position = 0;
+
+        while ((position + MinMatchLength) <= length)
+        {
+            UInt32 sequence = (UInt32)bytes[position] | ((UInt32)bytes[position + 1] << 8) | ((UInt32)bytes[position + 2] << 16) | ((UInt32)bytes[position + 3] << 24);
+            UInt32 hash = (sequence * 2654435761U) >> (32 - HashBits);
+
+            UInt32 matchPosition = positions[hash];
+            positions[hash] = position;
+
+            if ((matchPosition == NoPosition) || (memcmp(&bytes[matchPosition], &bytes[position], MinMatchLength) != 0))
+            {
+                ++position;
+                continue;
+            }
+
+            UInt32 matchLength = MinMatchLength;
+            while (((position + matchLength) < length) && (bytes[matchPosition + matchLength] == bytes[position + matchLength]))
+            {
+                ++matchLength;
+            }
+
+            writeUInt(position - literalStart, block);
+            block.insert(block.end(), bytes + literalStart, bytes + position);
+            writeUInt(matchLength - MinMatchLength, block);
+            writeUInt(position - matchPosition, block);
+
+            position += matchLength;
+            literalStart = position;
+        }
+
+        writeUInt(length - literalStart, block);
+        block.insert(block.end(), bytes + literalStart, bytes + length);
+    }
+
+    void NSFTraceBinaryFile::decompressBlock(const std::vector<UInt8>& data, std::vector<UInt8>::size_type& position, std::vector<UInt8>::size_type end,
+        UInt32 length, std::vector<UInt8>& block)
+    {
+        std::vector<UInt8>::size_type blockStart = block.size();
+        std::vector<UInt8>::size_type blockEnd = blockStart + length;
+
+        while (true)
+        {
+            UInt64 literalLength = readUInt(data, position);
+
+            if ((literalLength > (end - position)) || (literalLength > (blockEnd - block.size())))
+            {
+                throw std::runtime_error("Binary trace file is corrupt");
+            }
+
+            block.insert(block.end(), data.begin() + position, data.begin() + position + (std::vector<UInt8>::size_type)literalLength);
+            position += (std::vector<UInt8>::size_type)literalLength;
+
+            if (block.size() == blockEnd)
+            {
+                break;
+            }
+
+            UInt64 matchLength = readUInt(data, position) + MinMatchLength;
+            UInt64 distance = readUInt(data, position);
+
+            if ((distance == 0) || (distance > (block.size() - blockStart)) || (matchLength > (blockEnd - block.size())))
+            {
+                throw std::runtime_error("Binary trace file is corrupt");
+            }
+
+            // Copy a byte at a time, as the match may overlap the bytes it produces
+            std::vector<UInt8>::size_type matchStart = block.size() - (std::vector<UInt8>::size_type)distance;
+            for (UInt64 i = 0; i < matchLength; ++i)
+            {
+                block.push_back(block[matchStart + (std::vector<UInt8>::size_type)i]);
+            }
+        }
+
+        if (position != end)
+        {
+            throw std::runtime_error("Binary trace file is corrupt");
+        }
+    }
+
+    UInt32 NSFTraceBinaryFile::getStringId(const NSFString& string)
+    {
+        std::map<NSFString, UInt32>::iterator stringIterator = stringIds.find(string);
+
+        if (stringIterator != stringIds.end())
+        {
+            return stringIterator->second;
+        }
+
+        UInt32 id = (UInt32)strings.size();
+        stringIds.insert(std::make_pair(string, id));
+        strings.push_back(string);
+
+        return id;
+    }
+
+    UInt32 NSFTraceBinaryFile::readStringId(const std::vector<UInt8>& data, std::vector<UInt8>::size_type& position)
+    {
+        UInt64 id = readUInt(data, position);
+
+        if (id >= strings.size())
+        {
+            throw std::runtime_error("Binary trace file references an unknown string");
+        }
+
+        return (UInt32)id;
+    }
+
+    UInt64 NSFTraceBinaryFile::readUInt(const std::vector<UInt8>& data, std::vector<UInt8>::size_type& position)
+    {
+        UInt64 value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (position >= data.size())
+            {
+                throw std::runtime_error("Binary trace file is truncated");
+            }
+
+            UInt8 byte = data[position++];
+            value |= ((UInt64)(byte & 0x7F)) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error("Binary trace file is corrupt");
+    }
+
+    void NSFTraceBinaryFile::writeUInt(UInt64 value, std::vector<UInt8>& data)
+    {
+        while (value >= 0x80)
+        {
+            data.push_back((UInt8)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+
+        data.push_back((UInt8)value);
+    }
+}
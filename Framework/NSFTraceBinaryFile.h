@@ -0,0 +1,217 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TRACE_BINARY_FILE_H
+#define NSF_TRACE_BINARY_FILE_H
+
+#include "NSFCoreTypes.h"
+
+#include <map>
+#include <vector>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents the formats in which a trace log may be saved.
+    /// </summary>
+    enum NSFTraceFileFormat { XMLTraceFileFormat = 1, BinaryTraceFileFormat };
+
+    /// <summary>
+    /// Represents a trace log in a compact binary file format.
+    /// </summary>
+    /// <remarks>
+    /// The file starts with a header holding the format identifier, version and flags, followed by the trace data.
+    /// The trace data holds a table of the distinct strings used by the traces, followed by the traces,
+    /// each holding the difference between its time and the previous trace's time, and the string table ids of its type, tags and data.
+    /// All integers are encoded as variable length integers, so a typical trace requires less than ten bytes, rather than the hundreds needed in xml.
+    /// When compression is enabled, the trace data is divided into blocks that are each compressed with a simple built-in LZ77 scheme,
+    /// which removes most of the repetition between traces without depending on an external library.
+    /// Binary trace files can be converted to the xml format of a saved trace log, or to comma separated values, with the TraceDecoder tool.
+    /// </remarks>
+    class NSFTraceBinaryFile
+    {
+    public:
+
+        /// <summary>
+        /// Creates an empty binary trace file.
+        /// </summary>
+        /// <remarks>
+        /// By default, compression is enabled.
+        /// </remarks>
+        NSFTraceBinaryFile();
+
+        /// <summary>
+        /// Gets the flag indicating if the trace data is compressed when saved.
+        /// </summary>
+        bool getCompressionEnabled() const { return compressionEnabled; }
+
+        /// <summary>
+        /// Sets the flag indicating if the trace data is compressed when saved.
+        /// </summary>
+        void setCompressionEnabled(bool value) { compressionEnabled = value; }
+
+        /// <summary>
+        /// Gets the number of traces in the file.
+        /// </summary>
+        UInt32 getTraceCount() const { return (UInt32)traces.size(); }
+
+        /// <summary>
+        /// Adds a trace to the file.
+        /// </summary>
+        /// <param name="time">The time of the trace.</param>
+        /// <param name="type">The type of the trace.</param>
+        /// <param name="tag1">The first tag associated with the trace.</param>
+        /// <param name="data1">The data associated with the first tag.</param>
+        /// <param name="tag2">The second tag associated with the trace, or an empty string if none.</param>
+        /// <param name="data2">The data associated with the second tag.</param>
+        /// <param name="tag3">The third tag associated with the trace, or an empty string if none.</param>
+        /// <param name="data3">The data associated with the third tag.</param>
+        void addTrace(NSFTime time, const NSFString& type, const NSFString& tag1, const NSFString& data1,
+            const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3);
+
+        /// <summary>
+        /// Removes all traces from the file.
+        /// </summary>
+        void clear();
+
+        /// <summary>
+        /// Loads the traces from a binary trace file, replacing any traces held.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name of the file.</param>
+        /// <remarks>
+        /// An exception is thrown if the file cannot be read, or is not a valid binary trace file.
+        /// </remarks>
+        void load(const NSFString& fileName);
+
+        /// <summary>
+        /// Saves the traces to a binary trace file.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name of the file.</param>
+        /// <remarks>
+        /// An exception is thrown if the file cannot be written.
+        /// </remarks>
+        void save(const NSFString& fileName);
+
+        /// <summary>
+        /// Saves the traces as comma separated values, with one line per trace.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name of the file.</param>
+        /// <remarks>
+        /// The first line holds the column names, Time, Type, and a Tag and Data column for each tag.
+        /// Values containing commas, quotes or line breaks are quoted.
+        /// An exception is thrown if the file cannot be written.
+        /// </remarks>
+        void saveCSV(const NSFString& fileName);
+
+        /// <summary>
+        /// Saves the traces in the xml format of a saved trace log.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name of the file.</param>
+        /// <remarks>
+        /// An exception is thrown if the file cannot be written.
+        /// </remarks>
+        void saveXML(const NSFString& fileName);
+
+    private:
+
+        /// <summary>
+        /// Represents a trace, with its strings identified by their ids in the string table.
+        /// </summary>
+        struct Trace
+        {
+            NSFTime time;
+            UInt32 typeId;
+            UInt32 tagCount;
+            UInt32 tagIds[3];
+            UInt32 dataIds[3];
+        };
+
+        static const UInt32 BlockSize = 65536;
+        static const UInt32 CompressedFlag = 1;
+        static const UInt32 FormatVersion = 1;
+        static const UInt32 MinMatchLength = 4;
+
+        bool compressionEnabled;
+        std::vector<Trace> traces;
+        std::vector<NSFString> strings;
+        std::map<NSFString, UInt32> stringIds;
+
+        /// <summary>
+        /// Appends a value to comma separated text, quoting it if necessary.
+        /// </summary>
+        static void appendCSVValue(const NSFString& value, NSFString& text);
+
+        /// <summary>
+        /// Compresses a block of data.
+        /// </summary>
+        /// <param name="data">The data.</param>
+        /// <param name="start">The position of the first byte of the block.</param>
+        /// <param name="length">The number of bytes in the block.</param>
+        /// <param name="block">The vector to which the compressed block is appended.</param>
+        /// <remarks>
+        /// The compressed block is a sequence of literal runs, each followed by a match copied from earlier in the block.
+        /// Each run holds its length and bytes, and each match holds its length, less the minimum match length, and its distance back.
+        /// The last run is not followed by a match.
+        /// </remarks>
+        static void compressBlock(const std::vector<UInt8>& data, std::vector<UInt8>::size_type start, UInt32 length, std::vector<UInt8>& block);
+
+        /// <summary>
+        /// Decompresses a block of data.
+        /// </summary>
+        /// <param name="data">The file data.</param>
+        /// <param name="position">The position of the compressed block, which is advanced past it.</param>
+        /// <param name="end">The position following the compressed block.</param>
+        /// <param name="length">The number of bytes in the decompressed block.</param>
+        /// <param name="block">The vector to which the decompressed block is appended.</param>
+        static void decompressBlock(const std::vector<UInt8>& data, std::vector<UInt8>::size_type& position, std::vector<UInt8>::size_type end,
+            UInt32 length, std::vector<UInt8>& block);
+
+        /// <summary>
+        /// Gets the string table id of a string, adding the string to the table if necessary.
+        /// </summary>
+        UInt32 getStringId(const NSFString& string);
+
+        /// <summary>
+        /// Reads a string table id, checking that it is in the table.
+        /// </summary>
+        UInt32 readStringId(const std::vector<UInt8>& data, std::vector<UInt8>::size_type& position);
+
+        /// <summary>
+        /// Reads a variable length unsigned integer.
+        /// </summary>
+        /// <param name="data">The data to read from.</param>
+        /// <param name="position">The position of the integer, which is advanced past it.</param>
+        static UInt64 readUInt(const std::vector<UInt8>& data, std::vector<UInt8>::size_type& position);
+
+        /// <summary>
+        /// Writes a variable length unsigned integer.
+        /// </summary>
+        /// <param name="value">The value to write.</param>
+        /// <param name="data">The data to which the integer is appended.</param>
+        static void writeUInt(UInt64 value, std::vector<UInt8>& data);
+
+        static const NSFString& FileIdentifier() { static NSFString string("NSFTRACE"); return string; };
+    };
+}
+
+#endif // NSF_TRACE_BINARY_FILE_H
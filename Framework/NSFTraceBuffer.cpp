@@ -0,0 +1,230 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTraceBuffer.h"
+
+#include "NSFOSThread.h"
+
+#include <string.h>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTraceBuffer::NSFTraceBuffer(UInt32 capacity)
+        : capacity(1), records(NULL), writeCount(0), readIndex(0), textCapacity(0), text(NULL), textWriteCount(0)
+    {
+        while (this->capacity < capacity)
+        {
+            this->capacity <<= 1;
+        }
+
+        records = new NSFTraceRecord[this->capacity];
+
+        // The text holds at least a few of the longest data strings, so that a long string does not immediately overwrite the others
+        textCapacity = this->capacity * TextBytesPerRecord;
+        while (textCapacity < (4 * NSFTraceRecord::MaxTextDataLength))
+        {
+            textCapacity <<= 1;
+        }
+
+        text = new char[textCapacity];
+
+        // Mark every record as incomplete, as the sequence number of a record not yet written would otherwise match its position
+        for (UInt32 i = 0; i < this->capacity; ++i)
+        {
+            records[i].sequence = ~i;
+        }
+    }
+
+    NSFTraceBuffer::~NSFTraceBuffer()
+    {
+        delete[] records;
+        delete[] text;
+    }
+
+    void NSFTraceBuffer::addRecord(const NSFTraceRecord& record)
+    {
+        UInt32 index = NSFOSThread::atomicIncrement(writeCount) - 1;
+        NSFTraceRecord& bufferRecord = records[index & (capacity - 1)];
+
+        // A record being written holds the inverse of its sequence number, which never matches a complete record's sequence number
+        bufferRecord.sequence = ~index;
+        NSFOSThread::memoryBarrier();
+
+        bufferRecord.time = record.time;
+        bufferRecord.typeId = record.typeId;
+
+        for (int i = 0; i < NSFTraceRecord::MaxTags; ++i)
+        {
+            bufferRecord.tagIds[i] = record.tagIds[i];
+            bufferRecord.dataIds[i] = record.dataIds[i];
+
+            if (record.dataIds[i] == NSFTraceRecord::InlineDataId)
+            {
+                memcpy(bufferRecord.inlineData[i], record.inlineData[i], sizeof(record.inlineData[i]));
+            }
+            else if (record.dataIds[i] == NSFTraceRecord::TextDataId)
+            {
+                bufferRecord.textPositions[i] = record.textPositions[i];
+                bufferRecord.textLengths[i] = record.textLengths[i];
+            }
+        }
+
+        NSFOSThread::memoryBarrier();
+        bufferRecord.sequence = index;
+    }
+
+    void NSFTraceBuffer::addText(NSFTraceRecord& record, int index, const NSFString& data)
+    {
+        UInt32 length = (UInt32)data.length();
+        if (length > NSFTraceRecord::MaxTextDataLength)
+        {
+            length = NSFTraceRecord::MaxTextDataLength;
+        }
+
+        UInt32 position = NSFOSThread::atomicAdd(textWriteCount, length) - length;
+        UInt32 offset = position & (textCapacity - 1);
+        UInt32 firstLength = (length < (textCapacity - offset)) ? length : (textCapacity - offset);
+
+        memcpy(text + offset, data.c_str(), firstLength);
+        memcpy(text, data.c_str() + firstLength, length - firstLength);
+
+        record.dataIds[index] = NSFTraceRecord::TextDataId;
+        record.textPositions[index] = position;
+        record.textLengths[index] = (UInt32)data.length();
+    }
+
+    bool NSFTraceBuffer::getText(const NSFTraceRecord& record, int index, NSFString& data) const
+    {
+        UInt32 position = record.textPositions[index];
+        UInt32 length = record.textLengths[index];
+        if (length > NSFTraceRecord::MaxTextDataLength)
+        {
+            length = NSFTraceRecord::MaxTextDataLength;
+        }
+
+        UInt32 offset = position & (textCapacity - 1);
+        UInt32 firstLength = (length < (textCapacity - offset)) ? length : (textCapacity - offset);
+
+        data.assign(text + offset, firstLength);
+        data.append(text, length - firstLength);
+        NSFOSThread::memoryBarrier();
+
+        // The copy is only valid if the text was not overwritten while it was copied
+        return isTextHeld(position);
+    }
+
+    void NSFTraceBuffer::getRecords(std::vector<NSFTraceRecord>& records) const
+    {
+        UInt32 endIndex = writeCount;
+        NSFOSThread::memoryBarrier();
+
+        UInt32 startIndex = (endIndex > capacity) ? (endIndex - capacity) : 0;
+
+        for (UInt32 index = startIndex; index != endIndex; ++index)
+        {
+            NSFTraceRecord record;
+            UInt32 sequence;
+
+            // Skip the record if it was incomplete, or was overwritten while it was copied
+            if (copyRecord(index, record, sequence))
+            {
+                records.push_back(record);
+            }
+        }
+    }
+
+    UInt32 NSFTraceBuffer::readRecords(std::vector<NSFTraceRecord>& records)
+    {
+        UInt32 endIndex = writeCount;
+        NSFOSThread::memoryBarrier();
+
+        UInt32 overwrittenCount = 0;
+
+        // Records more than a buffer behind the last record added have been overwritten
+        if ((endIndex - readIndex) > capacity)
+        {
+            overwrittenCount = endIndex - readIndex - capacity;
+            readIndex = endIndex - capacity;
+        }
+
+        for (; readIndex != endIndex; ++readIndex)
+        {
+            NSFTraceRecord record;
+            UInt32 sequence;
+
+            if (copyRecord(readIndex, record, sequence))
+            {
+                records.push_back(record);
+                continue;
+            }
+
+            // A record being written, or reserved but not yet written, still holds the stamp of its own write or of the previous record in its position
+            if ((sequence == ~readIndex) || (sequence == (readIndex - capacity)) || (sequence == ~(readIndex - capacity)))
+            {
+                break;
+            }
+
+            ++overwrittenCount;
+        }
+
+        return overwrittenCount;
+    }
+
+    void NSFTraceBuffer::resetRead()
+    {
+        UInt32 endIndex = writeCount;
+
+        readIndex = (endIndex > capacity) ? (endIndex - capacity) : 0;
+    }
+
+    // Private
+
+    bool NSFTraceBuffer::copyRecord(UInt32 index, NSFTraceRecord& record, UInt32& sequence) const
+    {
+        const NSFTraceRecord& bufferRecord = records[index & (capacity - 1)];
+
+        sequence = bufferRecord.sequence;
+        NSFOSThread::memoryBarrier();
+
+        record = bufferRecord;
+        record.buffer = this;
+        NSFOSThread::memoryBarrier();
+
+        if ((sequence != index) || (bufferRecord.sequence != index))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < NSFTraceRecord::MaxTags; ++i)
+        {
+            if ((record.dataIds[i] == NSFTraceRecord::TextDataId) && !isTextHeld(record.textPositions[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
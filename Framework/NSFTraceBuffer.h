@@ -0,0 +1,193 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TRACE_BUFFER_H
+#define NSF_TRACE_BUFFER_H
+
+#include "NSFCoreTypes.h"
+
+#include <vector>
+
+namespace NorthStateFramework
+{
+    class NSFTraceBuffer;
+
+    /// <summary>
+    /// Represents a trace in binary form, with its type and tag names identified by their ids in an NSFTraceStringTable.
+    /// </summary>
+    /// <remarks>
+    /// Data strings are never added to the string table, so that the many distinct values traced over time do not fill it.
+    /// Short data strings, such as numeric values, are held in the record itself,
+    /// and longer ones in the text of the trace buffer holding the record, which is overwritten along with its records.
+    /// </remarks>
+    struct NSFTraceRecord
+    {
+        /// <summary>
+        /// The maximum number of tag and data pairs in a trace.
+        /// </summary>
+        static const int MaxTags = 3;
+
+        /// <summary>
+        /// The maximum length of a data string held in the record.
+        /// </summary>
+        static const int MaxInlineDataLength = 15;
+
+        /// <summary>
+        /// The maximum length of a data string held in the trace buffer's text, beyond which the data is truncated.
+        /// </summary>
+        static const UInt32 MaxTextDataLength = 1024;
+
+        /// <summary>
+        /// The data id indicating that the data string is held in the record.
+        /// </summary>
+        static const UInt32 InlineDataId = 0xFFFFFFFF;
+
+        /// <summary>
+        /// The data id indicating that the data string is held in the trace buffer's text.
+        /// </summary>
+        static const UInt32 TextDataId = 0xFFFFFFFE;
+
+        UInt32 sequence;
+        NSFTime time;
+        UInt32 typeId;
+        UInt32 tagIds[MaxTags];
+        UInt32 dataIds[MaxTags];
+        char inlineData[MaxTags][MaxInlineDataLength + 1];
+        UInt32 textPositions[MaxTags];
+        UInt32 textLengths[MaxTags];
+
+        /// <summary>
+        /// The buffer holding the text of the record, set on the records read from a buffer.
+        /// </summary>
+        const NSFTraceBuffer* buffer;
+    };
+
+    /// <summary>
+    /// Represents a fixed size ring buffer of trace records.
+    /// </summary>
+    /// <remarks>
+    /// Any number of threads may add records without locking a mutex, each reserving a record by atomically incrementing the write count.
+    /// Once the buffer is full, the oldest records are overwritten.
+    /// Each record is stamped with its sequence number after it is written, so that a reader can skip records that are incomplete
+    /// or were overwritten while they were read.
+    /// In addition to reading all records held, a single reader may read the records added since its previous read, for streaming.
+    /// Data strings too long to hold in a record are written to a ring of text that is reserved and overwritten in the same way,
+    /// and a record is treated as overwritten once its text is.
+    /// </remarks>
+    class NSFTraceBuffer
+    {
+    public:
+
+        /// <summary>
+        /// Creates a trace buffer.
+        /// </summary>
+        /// <param name="capacity">The minimum number of records held by the buffer, which is rounded up to a power of two.</param>
+        NSFTraceBuffer(UInt32 capacity);
+
+        /// <summary>
+        /// Destroys a trace buffer.
+        /// </summary>
+        ~NSFTraceBuffer();
+
+        /// <summary>
+        /// Gets the number of records held by the buffer.
+        /// </summary>
+        UInt32 getCapacity() const { return capacity; }
+
+        /// <summary>
+        /// Adds a record to the buffer, overwriting the oldest record if the buffer is full.
+        /// </summary>
+        /// <param name="record">The record to add.  The sequence number is ignored.</param>
+        void addRecord(const NSFTraceRecord& record);
+
+        /// <summary>
+        /// Adds a data string to the buffer's text, overwriting the oldest text if the text is full.
+        /// </summary>
+        /// <param name="record">The record to hold the data.</param>
+        /// <param name="index">The index of the data in the record.</param>
+        /// <param name="data">The data string, which is truncated to NSFTraceRecord::MaxTextDataLength characters.</param>
+        /// <remarks>
+        /// The record must be added to this buffer after its text.
+        /// </remarks>
+        void addText(NSFTraceRecord& record, int index, const NSFString& data);
+
+        /// <summary>
+        /// Gets the complete records in the buffer.
+        /// </summary>
+        /// <param name="records">The list to which the records are appended, oldest first.</param>
+        void getRecords(std::vector<NSFTraceRecord>& records) const;
+
+        /// <summary>
+        /// Reads the complete records added since the previous read.
+        /// </summary>
+        /// <param name="records">The list to which the records are appended, oldest first.</param>
+        /// <returns>The number of records that were overwritten before they could be read.</returns>
+        /// <remarks>
+        /// Reading stops at a record that is still being written, which is returned by a later read.
+        /// Only one thread may read records with this method.
+        /// </remarks>
+        UInt32 readRecords(std::vector<NSFTraceRecord>& records);
+
+        /// <summary>
+        /// Gets a data string held in the buffer's text.
+        /// </summary>
+        /// <param name="record">The record holding the data, read from this buffer.</param>
+        /// <param name="index">The index of the data in the record.</param>
+        /// <param name="data">The data string.</param>
+        /// <returns>True if the data was read, false if the text has been overwritten since the record was read.</returns>
+        bool getText(const NSFTraceRecord& record, int index, NSFString& data) const;
+
+        /// <summary>
+        /// Sets the read position to the oldest record held, so that the next read returns all records currently in the buffer.
+        /// </summary>
+        void resetRead();
+
+    private:
+
+        static const UInt32 TextBytesPerRecord = 16;
+
+        UInt32 capacity;
+        NSFTraceRecord* records;
+        volatile UInt32 writeCount;
+        UInt32 readIndex;
+        UInt32 textCapacity;
+        char* text;
+        volatile UInt32 textWriteCount;
+
+        /// <summary>
+        /// Copies a record, unless it is incomplete, or it or its text is overwritten while it is copied.
+        /// </summary>
+        /// <param name="index">The write index of the record.</param>
+        /// <param name="record">The copy of the record.</param>
+        /// <param name="sequence">The sequence number the record held before it was copied.</param>
+        /// <returns>True if the record was copied, otherwise false.</returns>
+        bool copyRecord(UInt32 index, NSFTraceRecord& record, UInt32& sequence) const;
+
+        /// <summary>
+        /// Indicates if text written at a position has not yet been overwritten.
+        /// </summary>
+        bool isTextHeld(UInt32 position) const { return ((textWriteCount - position) <= textCapacity); }
+    };
+}
+
+#endif // NSF_TRACE_BUFFER_H
@@ -0,0 +1,140 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTraceFileSink.h"
+
+#include <stdexcept>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTraceFileSink::NSFTraceFileSink(const NSFString& baseFileName)
+        : baseFileName(baseFileName.c_str()), bufferSize(64 * 1024), flushInterval(TimeUnitsPerSecond), maxFileAge(3600 * TimeUnitsPerSecond), maxFileSize(16 * 1024 * 1024),
+        fileNumber(0), fileSize(0), fileStartTime(0), fileTraceCount(0), droppedTraceCount(0), fileCount(0), traceCount(0)
+    {
+    }
+
+    NSFTraceFileSink::~NSFTraceFileSink()
+    {
+        closeFile();
+    }
+
+    // Private
+
+    void NSFTraceFileSink::closeFile()
+    {
+        if (!file.is_open())
+        {
+            return;
+        }
+
+        buffer += TraceLogEndText();
+        writeBuffer();
+        file.close();
+    }
+
+    void NSFTraceFileSink::flush()
+    {
+        if (!file.is_open())
+        {
+            return;
+        }
+
+        writeBuffer();
+        file.flush();
+    }
+
+    bool NSFTraceFileSink::isExistingFile(const NSFString& fileName)
+    {
+        std::ifstream existingFile(fileName.c_str());
+        return existingFile.is_open();
+    }
+
+    void NSFTraceFileSink::openFile(NSFTime startTime)
+    {
+        closeFile();
+
+        do
+        {
+            fileName = baseFileName + "_" + toString(++fileNumber) + FileExtension();
+        }
+        while (isExistingFile(fileName));
+
+        file.clear();
+        file.open(fileName.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+        if (file.fail())
+        {
+            throw std::runtime_error("Unable to open file: " + fileName);
+        }
+
+        buffer.reserve(bufferSize);
+        buffer = TraceLogStartText();
+        fileSize = (UInt32)buffer.size();
+        fileStartTime = startTime;
+        fileTraceCount = 0;
+        ++fileCount;
+    }
+
+    void NSFTraceFileSink::writeBuffer()
+    {
+        file.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+
+    void NSFTraceFileSink::writeTrace(const NSFString& traceText, NSFTime traceTime)
+    {
+        if (fileTraceCount != 0)
+        {
+            // Room is left for the end of the document, so that a complete file does not exceed the maximum size
+            bool fileFull = (maxFileSize != 0) && ((fileSize + traceText.size() + TraceLogEndText().size()) > maxFileSize);
+            bool fileExpired = (maxFileAge != 0) && ((traceTime - fileStartTime) >= maxFileAge);
+
+            if (fileFull || fileExpired)
+            {
+                openFile(traceTime);
+            }
+        }
+        else if (!file.is_open())
+        {
+            openFile(traceTime);
+        }
+
+        // The age of a file is measured from its first trace
+        if (fileTraceCount == 0)
+        {
+            fileStartTime = traceTime;
+        }
+
+        if ((buffer.size() + traceText.size()) > bufferSize)
+        {
+            writeBuffer();
+        }
+
+        buffer += traceText;
+        fileSize += (UInt32)traceText.size();
+        ++fileTraceCount;
+        ++traceCount;
+    }
+}
@@ -0,0 +1,211 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TRACE_FILE_SINK_H
+#define NSF_TRACE_FILE_SINK_H
+
+#include "NSFCoreTypes.h"
+
+#include <fstream>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a destination to which a trace log continuously streams its traces, as a series of xml files.
+    /// </summary>
+    /// <remarks>
+    /// Traces are collected in a memory buffer and written to the current file when the buffer is full,
+    /// and the file is flushed at the flush interval, so that at most the traces of one flush interval are lost if the application stops abruptly.
+    /// A new file is started when the current file reaches its maximum size or age.
+    /// Files are named with the base file name followed by a sequence number, for example TraceLog_1.xml,
+    /// and numbers of files that already exist are skipped, so that files from earlier runs are kept.
+    /// Each file is a complete trace log document, in the same format as a saved trace log.
+    /// All writing is done on the trace log's thread.
+    /// </remarks>
+    class NSFTraceFileSink
+    {
+    public:
+
+        friend class NSFTraceLog;
+
+        /// <summary>
+        /// Creates a trace file sink.
+        /// </summary>
+        /// <param name="baseFileName">The relative or fully qualified name for the files, without the sequence number and extension.</param>
+        NSFTraceFileSink(const NSFString& baseFileName);
+
+        /// <summary>
+        /// Destroys a trace file sink, writing any buffered traces and closing the current file.
+        /// </summary>
+        ~NSFTraceFileSink();
+
+        /// <summary>
+        /// Gets the size of the memory buffer, in bytes.
+        /// </summary>
+        UInt32 getBufferSize() const { return bufferSize; }
+
+        /// <summary>
+        /// Sets the size of the memory buffer, in bytes.
+        /// </summary>
+        /// <remarks>
+        /// The buffer size must be set before streaming starts.
+        /// </remarks>
+        void setBufferSize(UInt32 value) { bufferSize = value; }
+
+        /// <summary>
+        /// Gets the number of traces that were overwritten in the trace log before they could be written to a file.
+        /// </summary>
+        /// <remarks>
+        /// Traces are lost if more are added during a flush interval than the trace log holds.
+        /// Increasing the trace log's maximum number of traces, or decreasing the flush interval, avoids losing traces.
+        /// </remarks>
+        UInt32 getDroppedTraceCount() const { return droppedTraceCount; }
+
+        /// <summary>
+        /// Gets the number of files that have been started.
+        /// </summary>
+        UInt32 getFileCount() const { return fileCount; }
+
+        /// <summary>
+        /// Gets the name of the current file.
+        /// </summary>
+        const NSFString& getFileName() const { return fileName; }
+
+        /// <summary>
+        /// Gets the interval at which traces are written and flushed to the current file.
+        /// </summary>
+        NSFTime getFlushInterval() const { return flushInterval; }
+
+        /// <summary>
+        /// Sets the interval at which traces are written and flushed to the current file.
+        /// </summary>
+        /// <remarks>
+        /// The flush interval must be set before streaming starts.
+        /// </remarks>
+        void setFlushInterval(NSFTime value) { flushInterval = value; }
+
+        /// <summary>
+        /// Gets the maximum age of a file, after which a new file is started.
+        /// </summary>
+        /// <remarks>
+        /// The age is measured by the time of the traces written to the file.  Zero indicates no maximum age.
+        /// </remarks>
+        NSFTime getMaxFileAge() const { return maxFileAge; }
+
+        /// <summary>
+        /// Sets the maximum age of a file, after which a new file is started.
+        /// </summary>
+        /// <remarks>
+        /// The age is measured by the time of the traces written to the file.  Zero indicates no maximum age.
+        /// </remarks>
+        void setMaxFileAge(NSFTime value) { maxFileAge = value; }
+
+        /// <summary>
+        /// Gets the maximum size of a file, in bytes, after which a new file is started.
+        /// </summary>
+        /// <remarks>
+        /// A file only exceeds the maximum size if it holds a single trace that is larger.  Zero indicates no maximum size.
+        /// </remarks>
+        UInt32 getMaxFileSize() const { return maxFileSize; }
+
+        /// <summary>
+        /// Sets the maximum size of a file, in bytes, after which a new file is started.
+        /// </summary>
+        /// <remarks>
+        /// A file only exceeds the maximum size if it holds a single trace that is larger.  Zero indicates no maximum size.
+        /// </remarks>
+        void setMaxFileSize(UInt32 value) { maxFileSize = value; }
+
+        /// <summary>
+        /// Gets the number of traces written.
+        /// </summary>
+        UInt32 getTraceCount() const { return traceCount; }
+
+    private:
+
+        NSFString baseFileName;
+        UInt32 bufferSize;
+        NSFTime flushInterval;
+        NSFTime maxFileAge;
+        UInt32 maxFileSize;
+
+        std::ofstream file;
+        NSFString fileName;
+        UInt32 fileNumber;
+        UInt32 fileSize;
+        NSFTime fileStartTime;
+        UInt32 fileTraceCount;
+        NSFString buffer;
+
+        volatile UInt32 droppedTraceCount;
+        volatile UInt32 fileCount;
+        volatile UInt32 traceCount;
+
+        /// <summary>
+        /// Adds to the number of traces lost before they could be written.
+        /// </summary>
+        void addDroppedTraces(UInt32 count) { droppedTraceCount += count; }
+
+        /// <summary>
+        /// Writes any buffered traces to the current file and closes it.
+        /// </summary>
+        void closeFile();
+
+        /// <summary>
+        /// Writes any buffered traces to the current file and flushes it.
+        /// </summary>
+        void flush();
+
+        /// <summary>
+        /// Indicates if the specified file exists.
+        /// </summary>
+        static bool isExistingFile(const NSFString& fileName);
+
+        /// <summary>
+        /// Opens the next file in the sequence.
+        /// </summary>
+        /// <param name="startTime">The time from which the age of the file is measured.</param>
+        /// <remarks>
+        /// An exception is thrown if the file cannot be opened.
+        /// </remarks>
+        void openFile(NSFTime startTime);
+
+        /// <summary>
+        /// Writes the memory buffer to the current file.
+        /// </summary>
+        void writeBuffer();
+
+        /// <summary>
+        /// Writes a trace, starting a new file first if the current file has reached its maximum size or age.
+        /// </summary>
+        /// <param name="traceText">The xml text of the trace.</param>
+        /// <param name="traceTime">The time of the trace.</param>
+        void writeTrace(const NSFString& traceText, NSFTime traceTime);
+
+        static const NSFString& FileExtension() { static NSFString string(".xml"); return string; };
+        static const NSFString& TraceLogEndText() { static NSFString string("</TraceLog>\n"); return string; };
+        static const NSFString& TraceLogStartText() { static NSFString string("<TraceLog>\n"); return string; };
+    };
+}
+
+#endif // NSF_TRACE_FILE_SINK_H
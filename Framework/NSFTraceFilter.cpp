@@ -0,0 +1,153 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTraceFilter.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTraceFilter::NSFTraceFilter()
+        : categories(AllTraceCategories), eventFilterSet(false), stateMachineFilterSet(false),
+        eventsEnabledByDefault(true), stateMachinesEnabledByDefault(true), filterMutex(NSFOSMutex::create())
+    {
+    }
+
+    NSFTraceFilter::~NSFTraceFilter()
+    {
+        delete filterMutex;
+    }
+
+    void NSFTraceFilter::setCategoryEnabled(NSFTraceCategory category, bool value)
+    {
+        LOCK(filterMutex)
+        {
+            if (value)
+            {
+                categories = categories | category;
+            }
+            else
+            {
+                categories = categories & ~(UInt32)category;
+            }
+        }
+        ENDLOCK;
+    }
+
+    bool NSFTraceFilter::isEventEnabled(const NSFString& name)
+    {
+        if (!eventFilterSet)
+        {
+            return true;
+        }
+
+        LOCK(filterMutex)
+        {
+            return isNameEnabled(eventSettings, name, eventsEnabledByDefault);
+        }
+        ENDLOCK;
+    }
+
+    void NSFTraceFilter::setEventEnabled(const NSFString& name, bool value)
+    {
+        LOCK(filterMutex)
+        {
+            eventSettings[name] = value;
+            eventFilterSet = true;
+        }
+        ENDLOCK;
+    }
+
+    void NSFTraceFilter::setEventsEnabledByDefault(bool value)
+    {
+        LOCK(filterMutex)
+        {
+            eventsEnabledByDefault = value;
+            eventFilterSet = true;
+        }
+        ENDLOCK;
+    }
+
+    bool NSFTraceFilter::isStateMachineEnabled(const NSFString& name)
+    {
+        if (!stateMachineFilterSet)
+        {
+            return true;
+        }
+
+        LOCK(filterMutex)
+        {
+            return isNameEnabled(stateMachineSettings, name, stateMachinesEnabledByDefault);
+        }
+        ENDLOCK;
+    }
+
+    void NSFTraceFilter::setStateMachineEnabled(const NSFString& name, bool value)
+    {
+        LOCK(filterMutex)
+        {
+            stateMachineSettings[name] = value;
+            stateMachineFilterSet = true;
+        }
+        ENDLOCK;
+    }
+
+    void NSFTraceFilter::setStateMachinesEnabledByDefault(bool value)
+    {
+        LOCK(filterMutex)
+        {
+            stateMachinesEnabledByDefault = value;
+            stateMachineFilterSet = true;
+        }
+        ENDLOCK;
+    }
+
+    void NSFTraceFilter::reset()
+    {
+        LOCK(filterMutex)
+        {
+            categories = AllTraceCategories;
+            eventFilterSet = false;
+            stateMachineFilterSet = false;
+            eventsEnabledByDefault = true;
+            stateMachinesEnabledByDefault = true;
+            eventSettings.clear();
+            stateMachineSettings.clear();
+        }
+        ENDLOCK;
+    }
+
+    // Private
+
+    bool NSFTraceFilter::isNameEnabled(const std::map<NSFString, bool>& settings, const NSFString& name, bool enabledByDefault)
+    {
+        std::map<NSFString, bool>::const_iterator settingIterator = settings.find(name);
+
+        if (settingIterator == settings.end())
+        {
+            return enabledByDefault;
+        }
+
+        return settingIterator->second;
+    }
+}
@@ -0,0 +1,176 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TRACE_FILTER_H
+#define NSF_TRACE_FILTER_H
+
+#include "NSFCoreTypes.h"
+#include "NSFOSMutex.h"
+
+#include <map>
+
+// Trace levels for NSF_TRACE_LEVEL, which selects the framework traces compiled into the framework.
+// At the error level, only error and exception traces remain, and at level none, the framework adds no traces at all.
+// Traces added by applications are not affected.
+#define NSF_TRACE_LEVEL_NONE 0
+#define NSF_TRACE_LEVEL_ERROR 1
+#define NSF_TRACE_LEVEL_ALL 2
+
+#ifndef NSF_TRACE_LEVEL
+#define NSF_TRACE_LEVEL NSF_TRACE_LEVEL_ALL
+#endif
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents the categories of traces added by the framework.
+    /// </summary>
+    /// <remarks>
+    /// The values are flags, so that a set of categories may be held in a single integer.
+    /// </remarks>
+    enum NSFTraceCategory
+    {
+        StateEnteredTraceCategory = 0x01,
+        EventQueuedTraceCategory = 0x02,
+        EventHandledTraceCategory = 0x04,
+        ActionExecutedTraceCategory = 0x08,
+        ErrorTraceCategory = 0x10,
+        ExceptionTraceCategory = 0x20,
+        AllTraceCategories = 0x3F
+    };
+
+    /// <summary>
+    /// Represents a filter that selects the framework traces added to a trace log, by category, state machine and event name.
+    /// </summary>
+    /// <remarks>
+    /// Framework call sites check the category first, which is a single test of a flag, before evaluating any names,
+    /// so disabled categories cost almost nothing.
+    /// State machine and event names are only looked up when a setting has been made for at least one name.
+    /// A state machine name filters the states entered in the state machine, and the events queued to or handled by it.
+    /// The filter may be changed while traces are being added, from any thread.
+    /// </remarks>
+    class NSFTraceFilter
+    {
+    public:
+
+        /// <summary>
+        /// Creates a trace filter that passes all traces.
+        /// </summary>
+        NSFTraceFilter();
+
+        /// <summary>
+        /// Destroys a trace filter.
+        /// </summary>
+        ~NSFTraceFilter();
+
+        /// <summary>
+        /// Gets the set of enabled categories, as a combination of NSFTraceCategory flags.
+        /// </summary>
+        UInt32 getCategories() const { return categories; }
+
+        /// <summary>
+        /// Sets the set of enabled categories, as a combination of NSFTraceCategory flags.
+        /// </summary>
+        void setCategories(UInt32 value) { categories = value; }
+
+        /// <summary>
+        /// Indicates if a category of traces is enabled.
+        /// </summary>
+        bool isCategoryEnabled(NSFTraceCategory category) const { return ((categories & category) != 0); }
+
+        /// <summary>
+        /// Enables or disables a category of traces.
+        /// </summary>
+        void setCategoryEnabled(NSFTraceCategory category, bool value);
+
+        /// <summary>
+        /// Indicates if traces for an event are enabled.
+        /// </summary>
+        /// <param name="name">The name of the event.</param>
+        /// <returns>The setting for the event, if any, otherwise the default setting for events.</returns>
+        bool isEventEnabled(const NSFString& name);
+
+        /// <summary>
+        /// Enables or disables traces for an event.
+        /// </summary>
+        /// <param name="name">The name of the event.</param>
+        /// <param name="value">True to enable traces for the event, false to disable them.</param>
+        void setEventEnabled(const NSFString& name, bool value);
+
+        /// <summary>
+        /// Sets the setting for events that have no setting of their own.
+        /// </summary>
+        /// <remarks>
+        /// Disabling events by default, then enabling particular events, limits event traces to those events.
+        /// </remarks>
+        void setEventsEnabledByDefault(bool value);
+
+        /// <summary>
+        /// Indicates if traces for a state machine are enabled.
+        /// </summary>
+        /// <param name="name">The name of the state machine.</param>
+        /// <returns>The setting for the state machine, if any, otherwise the default setting for state machines.</returns>
+        bool isStateMachineEnabled(const NSFString& name);
+
+        /// <summary>
+        /// Enables or disables traces for a state machine.
+        /// </summary>
+        /// <param name="name">The name of the state machine.</param>
+        /// <param name="value">True to enable traces for the state machine, false to disable them.</param>
+        void setStateMachineEnabled(const NSFString& name, bool value);
+
+        /// <summary>
+        /// Sets the setting for state machines that have no setting of their own.
+        /// </summary>
+        /// <remarks>
+        /// Disabling state machines by default, then enabling particular state machines, limits traces to those state machines.
+        /// </remarks>
+        void setStateMachinesEnabledByDefault(bool value);
+
+        /// <summary>
+        /// Removes all settings, so that the filter passes all traces.
+        /// </summary>
+        void reset();
+
+    private:
+
+        volatile UInt32 categories;
+        volatile bool eventFilterSet;
+        volatile bool stateMachineFilterSet;
+        bool eventsEnabledByDefault;
+        bool stateMachinesEnabledByDefault;
+        std::map<NSFString, bool> eventSettings;
+        std::map<NSFString, bool> stateMachineSettings;
+        NSFOSMutex* filterMutex;
+
+        /// <summary>
+        /// Looks up the setting for a name.
+        /// </summary>
+        /// <remarks>
+        /// The filter mutex must be locked when calling this method.
+        /// </remarks>
+        static bool isNameEnabled(const std::map<NSFString, bool>& settings, const NSFString& name, bool enabledByDefault);
+    };
+}
+
+#endif // NSF_TRACE_FILTER_H
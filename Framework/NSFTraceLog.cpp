@@ -1,177 +1,680 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "NSFTraceLog.h"
-
-#include "NSFEventThread.h"
-#include "NSFExceptionHandler.h"
-#include "NSFTimerThread.h"
-
-namespace NorthStateFramework
-{
-    // Public
-
-#if (defined WIN32) || (defined WINCE)
-    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
-#pragma warning( push )
-#pragma warning( disable : 4355 )
-#endif
-
-    NSFTraceLog::NSFTraceLog(const NSFString& name)
-        : NSFTaggedObject(name), enabled(false), eventHandler(name, new NSFEventThread(name, NSFOSThread::getLowestPriority())),
-        maxTraces(500), traceAddEvent(TraceAddString(), &eventHandler), traceLogMutex(NSFOSMutex::create()),
-        traceSaveEvent(TraceSaveString(), &eventHandler), xmlLog(TraceLogTag())
-    {
-        eventHandler.setLoggingEnabled(false);
-
-        eventHandler.addEventReaction(&traceAddEvent, NSFAction(this, &NSFTraceLog::addTraceToLog));
-        eventHandler.addEventReaction(&traceSaveEvent, NSFAction(this, &NSFTraceLog::saveTrace));
-
-        eventHandler.startEventHandler();
-
-        addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), "TraceStart");
-    }
-
-#if (defined WIN32) || (defined WINCE)
-    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
-#pragma warning( pop )
-#endif
-
-    NSFTraceLog::~NSFTraceLog()
-    {
-        eventHandler.terminate(true);
-        delete eventHandler.getEventThread();
-        delete traceLogMutex;
-    }
-
-    void NSFTraceLog::addTrace(const NSFString& type, const NSFString& tag, const NSFString& data)
-    {
-        addTrace(type, tag, data, emptyString(), emptyString(), emptyString(), emptyString());
-    }
-
-    void NSFTraceLog::addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2)
-    {
-        addTrace(type, tag1, data1, tag2, data2, emptyString(), emptyString());
-    }
-
-    void NSFTraceLog::addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3)
-    {
-        // If logging is not enabled, then return without action
-        if (!enabled)
-        {
-            return;
-        }
-
-        NSFXMLElement* trace = NULL;
-
-        try
-        {
-            // Lock to prevent events from being added to the queue with timestamps out of order
-            LOCK(traceLogMutex)
-            {
-                // Create the new trace element
-                trace = new NSFXMLElement(TraceTag());
-
-                // Add the time
-                trace->addChildElementBack(new NSFXMLElement(TimeTag(), toString(NSFTimerThread::getPrimaryTimerThread().getCurrentTime())));
-
-                // Add a trace for the type
-                NSFXMLElement* typeTrace = new NSFXMLElement(type);
-                trace->addChildElementBack(typeTrace);
-
-                // Add the new data under the type element;
-                typeTrace->addChildElementBack(new NSFXMLElement(tag1, data1));
-
-                if (!tag2.empty()) typeTrace->addChildElementBack(new NSFXMLElement(tag2, data2));
-                if (!tag3.empty()) typeTrace->addChildElementBack(new NSFXMLElement(tag3, data3));
-
-                eventHandler.queueEvent(traceAddEvent.copy(true, trace));
-            }
-            ENDLOCK;
-        }
-        catch(...)
-        {
-            // If unable to add a trace, just do nothing, because calling the exception handler may result in an infinite loop
-            delete trace;
-        }
-    }
-
-    bool NSFTraceLog::allTracesLogged()
-    {
-        return !eventHandler.hasEvent();
-    }
-
-    void NSFTraceLog::saveLog()
-    {
-        saveLog(getName());
-    }
-
-    void NSFTraceLog::saveLog(const NSFString& fileName)
-    {
-        if (enabled)
-        {
-            traceSaveEvent.copy(true, fileName)->queueEvent();
-        }
-    }
-
-    // Private
-
-    void NSFTraceLog::addTraceToLog(const NSFEventContext& context)
-    {
-        try
-        {
-            xmlLog.jumpToRootElement();
-
-            UInt32 numberOfChildElements;
-            while (xmlLog.getNumberOfChildElements(numberOfChildElements) && (numberOfChildElements >= maxTraces))
-            {
-                xmlLog.deleteChildElementFront();
-            }
-
-            xmlLog.addChildElementBack(((NSFDataEvent<NSFXMLElement*>*)context.getEvent())->getData());
-        }
-        catch (...)
-        {
-            // If unable to add a trace, just do nothing, because calling the exception handler may result in an infinite loop
-        }
-    }
-
-    void NSFTraceLog::saveTrace(const NSFEventContext& context)
-    {
-        try
-        {
-            addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), TraceSaveString());
-            xmlLog.save(((NSFDataEvent<NSFString>*)context.getEvent())->getData());
-            addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), TraceSaveCompleteString());
-        }
-        catch (const std::exception& exception)
-        {
-            // If unable to save a trace, just add a trace with the exception message, because calling the exception handler may result in an infinite loop
-            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), getName() + " exception saving trace: " + exception.what());
-        }
-        catch (...)
-        {
-            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), "Unknown Exception saving trace");
-        }
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTraceLog.h"
+
+#include "NSFEventThread.h"
+#include "NSFExceptionHandler.h"
+#include "NSFTimerThread.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace NorthStateFramework
+{
+#if defined NSF_THREAD_LOCAL_STORAGE
+    thread_local NSFTraceLog::ThreadTraceBuffers NSFTraceLog::threadTraceBuffers;
+
+    NSFTraceLog::ThreadTraceBuffers::~ThreadTraceBuffers()
+    {
+        if (traceBuffers.empty())
+        {
+            return;
+        }
+
+        // The trace logs mutex keeps the logs from being destroyed while the buffers are returned
+        LOCK(getTraceLogsMutex())
+        {
+            for (std::vector<ThreadTraceBuffer>::size_type i = 0; i < traceBuffers.size(); ++i)
+            {
+                if (isTraceLogLive(traceBuffers[i]))
+                {
+                    traceBuffers[i].traceLog->releaseTraceBuffer(traceBuffers[i].traceBuffer, traceBuffers[i].generation);
+                }
+            }
+        }
+        ENDLOCK;
+    }
+#endif
+
+    // Public
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( push )
+#pragma warning( disable : 4355 )
+#endif
+
+    NSFTraceLog::NSFTraceLog(const NSFString& name)
+        : NSFTaggedObject(name), enabled(false), eventHandler(name, new NSFEventThread(name, NSFOSThread::getLowestPriority())),
+        maxTraces(500), traceLogMutex(NSFOSMutex::create()), traceSaveEvent(TraceSaveString(), &eventHandler),
+        traceBinarySaveEvent(TraceBinarySaveString(), &eventHandler), stringTable(StringTableCapacity), traceBufferCapacity(maxTraces),
+        traceStreamEvent(TraceStreamString(), &eventHandler), traceSink(NULL)
+    {
+#if defined NSF_THREAD_LOCAL_STORAGE
+        static volatile UInt32 traceLogCount = 0;
+
+        // Ids distinguish the log from a destroyed log at the same address, whose buffers threads may still refer to
+        traceLogId = NSFOSThread::atomicIncrement(traceLogCount);
+        traceBufferGeneration = 0;
+
+        LOCK(getTraceLogsMutex())
+        {
+            getTraceLogs().insert(this);
+        }
+        ENDLOCK;
+#else
+        for (int i = 0; i < TraceBufferCount; ++i)
+        {
+            sharedTraceBuffers[i] = new NSFTraceBuffer(maxTraces);
+            traceBuffers.push_back(sharedTraceBuffers[i]);
+        }
+#endif
+
+        eventHandler.setLoggingEnabled(false);
+
+        eventHandler.addEventReaction(&traceSaveEvent, NSFAction(this, &NSFTraceLog::saveTrace));
+        eventHandler.addEventReaction(&traceBinarySaveEvent, NSFAction(this, &NSFTraceLog::saveBinaryTrace));
+        eventHandler.addEventReaction(&traceStreamEvent, NSFAction(this, &NSFTraceLog::streamTrace));
+
+        eventHandler.startEventHandler();
+
+        addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), "TraceStart");
+    }
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( pop )
+#endif
+
+    NSFTraceLog::~NSFTraceLog()
+    {
+        stopStreaming();
+
+        eventHandler.terminate(true);
+        delete eventHandler.getEventThread();
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+        // Threads exiting from now on no longer return their buffers to the log
+        LOCK(getTraceLogsMutex())
+        {
+            getTraceLogs().erase(this);
+        }
+        ENDLOCK;
+#endif
+
+        delete traceLogMutex;
+
+        retiredTraceBuffers.splice(retiredTraceBuffers.end(), traceBuffers);
+
+        std::list<NSFTraceBuffer*>::iterator bufferIterator;
+        for (bufferIterator = retiredTraceBuffers.begin(); bufferIterator != retiredTraceBuffers.end(); ++bufferIterator)
+        {
+            delete *bufferIterator;
+        }
+    }
+
+    void NSFTraceLog::setMaxTraces(UInt32 value)
+    {
+        LOCK(traceLogMutex)
+        {
+            maxTraces = value;
+
+            // Each buffer holds the maximum number of traces, so that the most recent traces are kept even if one thread adds them all
+            if (traceBufferCapacity >= value)
+            {
+                return;
+            }
+
+            traceBufferCapacity = value;
+
+            // Threads may still be adding traces to the replaced buffers, so they are kept, and saved along with the new ones
+            retiredTraceBuffers.splice(retiredTraceBuffers.end(), traceBuffers);
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+            // Threads take new buffers with their next trace
+            freeTraceBuffers.clear();
+            ++traceBufferGeneration;
+#else
+            for (int i = 0; i < TraceBufferCount; ++i)
+            {
+                sharedTraceBuffers[i] = new NSFTraceBuffer(value);
+                traceBuffers.push_back(sharedTraceBuffers[i]);
+            }
+#endif
+        }
+        ENDLOCK;
+    }
+
+    void NSFTraceLog::addTrace(const NSFString& type, const NSFString& tag, const NSFString& data)
+    {
+        addTrace(type, tag, data, emptyString(), emptyString(), emptyString(), emptyString());
+    }
+
+    void NSFTraceLog::addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2)
+    {
+        addTrace(type, tag1, data1, tag2, data2, emptyString(), emptyString());
+    }
+
+    void NSFTraceLog::addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3)
+    {
+        // If logging is not enabled, then return without action
+        if (!enabled)
+        {
+            return;
+        }
+
+        try
+        {
+            NSFTraceBuffer* traceBuffer = getTraceBuffer();
+            NSFTraceRecord record;
+
+            record.time = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+            record.typeId = stringTable.getId(type);
+            record.tagIds[0] = stringTable.getId(tag1);
+            setRecordData(traceBuffer, record, 0, data1);
+            record.tagIds[1] = stringTable.getId(tag2);
+            setRecordData(traceBuffer, record, 1, data2);
+            record.tagIds[2] = stringTable.getId(tag3);
+            setRecordData(traceBuffer, record, 2, data3);
+
+            traceBuffer->addRecord(record);
+        }
+        catch(...)
+        {
+            // If unable to add a trace, just do nothing, because calling the exception handler may result in an infinite loop
+        }
+    }
+
+    bool NSFTraceLog::allTracesLogged()
+    {
+        return !eventHandler.hasEvent();
+    }
+
+    void NSFTraceLog::saveLog()
+    {
+        saveLog(getName());
+    }
+
+    void NSFTraceLog::saveLog(const NSFString& fileName)
+    {
+        if (enabled)
+        {
+            traceSaveEvent.copy(true, fileName)->queueEvent();
+        }
+    }
+
+    void NSFTraceLog::saveLog(const NSFString& fileName, NSFTraceFileFormat format)
+    {
+        if (format != BinaryTraceFileFormat)
+        {
+            saveLog(fileName);
+        }
+        else if (enabled)
+        {
+            traceBinarySaveEvent.copy(true, fileName)->queueEvent();
+        }
+    }
+
+    void NSFTraceLog::startStreaming(NSFTraceFileSink* sink)
+    {
+        stopStreaming();
+
+        LOCK(traceLogMutex)
+        {
+            sink->openFile(NSFTimerThread::getPrimaryTimerThread().getCurrentTime());
+
+            traceSink = sink;
+
+            std::list<NSFTraceBuffer*>::iterator bufferIterator;
+            for (bufferIterator = retiredTraceBuffers.begin(); bufferIterator != retiredTraceBuffers.end(); ++bufferIterator)
+            {
+                (*bufferIterator)->resetRead();
+            }
+
+            for (bufferIterator = traceBuffers.begin(); bufferIterator != traceBuffers.end(); ++bufferIterator)
+            {
+                (*bufferIterator)->resetRead();
+            }
+        }
+        ENDLOCK;
+
+        traceStreamEvent.schedule(sink->getFlushInterval(), sink->getFlushInterval());
+    }
+
+    void NSFTraceLog::stopStreaming()
+    {
+        LOCK(traceLogMutex)
+        {
+            if (traceSink == NULL)
+            {
+                return;
+            }
+
+            traceStreamEvent.unschedule();
+
+            try
+            {
+                writeStreamRecords();
+            }
+            catch(...)
+            {
+                // The sink is deleted regardless, as its file may not be writable
+            }
+
+            delete traceSink;
+            traceSink = NULL;
+        }
+        ENDLOCK;
+    }
+
+    // Protected
+
+    void NSFTraceLog::saveTrace(const NSFEventContext& context)
+    {
+        try
+        {
+            addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), TraceSaveString());
+
+            std::vector<NSFTraceRecord> records;
+            getSaveRecords(records);
+
+            NSFXMLDocument xmlLog(TraceLogTag());
+
+            for (std::vector<NSFTraceRecord>::size_type i = 0; i < records.size(); ++i)
+            {
+                xmlLog.addChildElementBack(createTraceElement(records[i]));
+            }
+
+            xmlLog.save(((NSFDataEvent<NSFString>*)context.getEvent())->getData());
+            addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), TraceSaveCompleteString());
+        }
+        catch (const std::exception& exception)
+        {
+            // If unable to save a trace, just add a trace with the exception message, because calling the exception handler may result in an infinite loop
+            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), getName() + " exception saving trace: " + exception.what());
+        }
+        catch (...)
+        {
+            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), "Unknown Exception saving trace");
+        }
+    }
+
+    void NSFTraceLog::saveBinaryTrace(const NSFEventContext& context)
+    {
+        try
+        {
+            addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), TraceSaveString());
+
+            std::vector<NSFTraceRecord> records;
+            getSaveRecords(records);
+
+            NSFTraceBinaryFile binaryLog;
+
+            for (std::vector<NSFTraceRecord>::size_type i = 0; i < records.size(); ++i)
+            {
+                const NSFTraceRecord& record = records[i];
+
+                binaryLog.addTrace(record.time, stringTable.getString(record.typeId),
+                    stringTable.getString(record.tagIds[0]), getRecordData(record, 0),
+                    stringTable.getString(record.tagIds[1]), getRecordData(record, 1),
+                    stringTable.getString(record.tagIds[2]), getRecordData(record, 2));
+            }
+
+            binaryLog.save(((NSFDataEvent<NSFString>*)context.getEvent())->getData());
+            addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), TraceSaveCompleteString());
+        }
+        catch (const std::exception& exception)
+        {
+            // If unable to save a trace, just add a trace with the exception message, because calling the exception handler may result in an infinite loop
+            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), getName() + " exception saving trace: " + exception.what());
+        }
+        catch (...)
+        {
+            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), "Unknown Exception saving trace");
+        }
+    }
+
+    void NSFTraceLog::streamTrace(const NSFEventContext&)
+    {
+        try
+        {
+            LOCK(traceLogMutex)
+            {
+                // Streaming may have stopped after this event was queued
+                if (traceSink == NULL)
+                {
+                    return;
+                }
+
+                writeStreamRecords();
+                traceSink->flush();
+            }
+            ENDLOCK;
+        }
+        catch (const std::exception& exception)
+        {
+            // If unable to stream traces, just add a trace with the exception message, because calling the exception handler may result in an infinite loop
+            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), getName() + " exception streaming trace: " + exception.what());
+        }
+        catch (...)
+        {
+            addTrace(NSFTraceTags::ExceptionTag(), NSFTraceTags::MessageTag(), "Unknown Exception streaming trace");
+        }
+    }
+
+    // Private
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+    NSFTraceBuffer* NSFTraceLog::acquireTraceBuffer(UInt32& generation)
+    {
+        NSFTraceBuffer* traceBuffer;
+
+        LOCK(traceLogMutex)
+        {
+            generation = traceBufferGeneration;
+
+            if (!freeTraceBuffers.empty())
+            {
+                traceBuffer = freeTraceBuffers.front();
+                freeTraceBuffers.pop_front();
+            }
+            else
+            {
+                traceBuffer = new NSFTraceBuffer(traceBufferCapacity);
+                traceBuffers.push_back(traceBuffer);
+            }
+        }
+        ENDLOCK;
+
+        return traceBuffer;
+    }
+#endif
+
+    void NSFTraceLog::appendEscapedText(const NSFString& data, NSFString& text)
+    {
+        // Escape the same characters as an xml element does, so that streamed files match saved files
+        for (NSFString::size_type i = 0; i < data.size(); ++i)
+        {
+            switch (data[i])
+            {
+            case '&':
+                text += "&amp;";
+                break;
+
+            case '<':
+                text += "&lt;";
+                break;
+
+            case '>':
+                text += "&gt;";
+                break;
+
+            case '"':
+                text += "&quot;";
+                break;
+
+            case '\'':
+                text += "&apos;";
+                break;
+
+            default:
+                text += data[i];
+                break;
+            }
+        }
+    }
+
+    void NSFTraceLog::appendTraceText(const NSFTraceRecord& record, NSFString& text)
+    {
+        const NSFString& type = stringTable.getString(record.typeId);
+
+        text += "<" + TraceTag() + ">\n";
+        text += "<" + TimeTag() + ">" + toString(record.time) + "</" + TimeTag() + ">\n";
+        text += "<" + type + ">\n";
+
+        for (int i = 0; i < NSFTraceRecord::MaxTags; ++i)
+        {
+            if ((i == 0) || (record.tagIds[i] != NSFTraceStringTable::EmptyStringId))
+            {
+                const NSFString& tag = stringTable.getString(record.tagIds[i]);
+                text += "<" + tag + ">";
+                appendEscapedText(getRecordData(record, i), text);
+                text += "</" + tag + ">\n";
+            }
+        }
+
+        text += "</" + type + ">\n";
+        text += "</" + TraceTag() + ">\n";
+    }
+
+    NSFXMLElement* NSFTraceLog::createTraceElement(const NSFTraceRecord& record)
+    {
+        NSFXMLElement* trace = new NSFXMLElement(TraceTag());
+
+        // Add the time
+        trace->addChildElementBack(new NSFXMLElement(TimeTag(), toString(record.time)));
+
+        // Add a trace for the type
+        NSFXMLElement* typeTrace = new NSFXMLElement(stringTable.getString(record.typeId));
+        trace->addChildElementBack(typeTrace);
+
+        // Add the data under the type element, where the first tag is always present
+        for (int i = 0; i < NSFTraceRecord::MaxTags; ++i)
+        {
+            if ((i == 0) || (record.tagIds[i] != NSFTraceStringTable::EmptyStringId))
+            {
+                typeTrace->addChildElementBack(new NSFXMLElement(stringTable.getString(record.tagIds[i]), getRecordData(record, i)));
+            }
+        }
+
+        return trace;
+    }
+
+    NSFString NSFTraceLog::getRecordData(const NSFTraceRecord& record, int index)
+    {
+        if (record.dataIds[index] == NSFTraceRecord::InlineDataId)
+        {
+            return record.inlineData[index];
+        }
+
+        NSFString data;
+
+        // Mark data overwritten since its record was read, or truncated when it was added
+        if (!record.buffer->getText(record, index, data))
+        {
+            return TruncatedDataString();
+        }
+
+        if (record.textLengths[index] > NSFTraceRecord::MaxTextDataLength)
+        {
+            data += TruncatedDataString();
+        }
+
+        return data;
+    }
+
+    void NSFTraceLog::getSaveRecords(std::vector<NSFTraceRecord>& records)
+    {
+        UInt32 traceLimit;
+
+        LOCK(traceLogMutex)
+        {
+            std::list<NSFTraceBuffer*>::iterator bufferIterator;
+            for (bufferIterator = retiredTraceBuffers.begin(); bufferIterator != retiredTraceBuffers.end(); ++bufferIterator)
+            {
+                (*bufferIterator)->getRecords(records);
+            }
+
+            for (bufferIterator = traceBuffers.begin(); bufferIterator != traceBuffers.end(); ++bufferIterator)
+            {
+                (*bufferIterator)->getRecords(records);
+            }
+
+            traceLimit = maxTraces;
+        }
+        ENDLOCK;
+
+        // Merge the traces of all threads in time order, keeping the order in which each thread added traces with the same time
+        std::stable_sort(records.begin(), records.end(), isEarlier);
+
+        if (records.size() > traceLimit)
+        {
+            records.erase(records.begin(), records.end() - traceLimit);
+        }
+    }
+
+    NSFTraceBuffer* NSFTraceLog::getTraceBuffer()
+    {
+#if defined NSF_THREAD_LOCAL_STORAGE
+        std::vector<ThreadTraceBuffer>& threadBuffers = threadTraceBuffers.traceBuffers;
+
+        for (std::vector<ThreadTraceBuffer>::size_type i = 0; i < threadBuffers.size(); ++i)
+        {
+            ThreadTraceBuffer& threadBuffer = threadBuffers[i];
+
+            if ((threadBuffer.traceLog == this) && (threadBuffer.traceLogId == traceLogId))
+            {
+                if (threadBuffer.generation != traceBufferGeneration)
+                {
+                    threadBuffer.traceBuffer = acquireTraceBuffer(threadBuffer.generation);
+                }
+
+                return threadBuffer.traceBuffer;
+            }
+        }
+
+        // Register the thread with the log on its first trace, dropping its buffers of destroyed logs
+        LOCK(getTraceLogsMutex())
+        {
+            std::vector<ThreadTraceBuffer>::iterator threadBufferIterator = threadBuffers.begin();
+            while (threadBufferIterator != threadBuffers.end())
+            {
+                if (isTraceLogLive(*threadBufferIterator))
+                {
+                    ++threadBufferIterator;
+                }
+                else
+                {
+                    threadBufferIterator = threadBuffers.erase(threadBufferIterator);
+                }
+            }
+        }
+        ENDLOCK;
+
+        ThreadTraceBuffer threadBuffer;
+        threadBuffer.traceLog = this;
+        threadBuffer.traceLogId = traceLogId;
+        threadBuffer.traceBuffer = acquireTraceBuffer(threadBuffer.generation);
+        threadBuffers.push_back(threadBuffer);
+
+        return threadBuffer.traceBuffer;
+#else
+        // Spread the thread ids, which may be addresses with many low bits in common, across the buffers
+        UInt32 threadHash = (UInt32)NSFOSThread::getCurrentOSThreadId() * 2654435761U;
+
+        return sharedTraceBuffers[(threadHash >> 16) % TraceBufferCount];
+#endif
+    }
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+    NSFOSMutex* NSFTraceLog::getTraceLogsMutex()
+    {
+        // Never deleted, as threads may exit after static objects are destroyed
+        static NSFOSMutex* traceLogsMutex = NSFOSMutex::create();
+
+        return traceLogsMutex;
+    }
+
+    std::set<NSFTraceLog*>& NSFTraceLog::getTraceLogs()
+    {
+        static std::set<NSFTraceLog*>* traceLogs = new std::set<NSFTraceLog*>();
+
+        return *traceLogs;
+    }
+#endif
+
+    bool NSFTraceLog::isEarlier(const NSFTraceRecord& record1, const NSFTraceRecord& record2)
+    {
+        return (record1.time < record2.time);
+    }
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+    bool NSFTraceLog::isTraceLogLive(const ThreadTraceBuffer& threadTraceBuffer)
+    {
+        std::set<NSFTraceLog*>& traceLogs = getTraceLogs();
+
+        return ((traceLogs.find(threadTraceBuffer.traceLog) != traceLogs.end()) && (threadTraceBuffer.traceLog->traceLogId == threadTraceBuffer.traceLogId));
+    }
+
+    void NSFTraceLog::releaseTraceBuffer(NSFTraceBuffer* traceBuffer, UInt32 generation)
+    {
+        LOCK(traceLogMutex)
+        {
+            // A buffer replaced since the thread took it is already retired
+            if (generation == traceBufferGeneration)
+            {
+                freeTraceBuffers.push_back(traceBuffer);
+            }
+        }
+        ENDLOCK;
+    }
+#endif
+
+    void NSFTraceLog::setRecordData(NSFTraceBuffer* traceBuffer, NSFTraceRecord& record, int index, const NSFString& data)
+    {
+        if (data.size() > (NSFString::size_type)NSFTraceRecord::MaxInlineDataLength)
+        {
+            traceBuffer->addText(record, index, data);
+            return;
+        }
+
+        record.dataIds[index] = NSFTraceRecord::InlineDataId;
+        memcpy(record.inlineData[index], data.c_str(), data.size() + 1);
+    }
+
+    void NSFTraceLog::writeStreamRecords()
+    {
+        streamRecords.clear();
+
+        std::list<NSFTraceBuffer*>::iterator bufferIterator;
+        for (bufferIterator = retiredTraceBuffers.begin(); bufferIterator != retiredTraceBuffers.end(); ++bufferIterator)
+        {
+            traceSink->addDroppedTraces((*bufferIterator)->readRecords(streamRecords));
+        }
+
+        for (bufferIterator = traceBuffers.begin(); bufferIterator != traceBuffers.end(); ++bufferIterator)
+        {
+            traceSink->addDroppedTraces((*bufferIterator)->readRecords(streamRecords));
+        }
+
+        std::stable_sort(streamRecords.begin(), streamRecords.end(), isEarlier);
+
+        for (std::vector<NSFTraceRecord>::size_type i = 0; i < streamRecords.size(); ++i)
+        {
+            streamText.clear();
+            appendTraceText(streamRecords[i], streamText);
+            traceSink->writeTrace(streamText, streamRecords[i].time);
+        }
+    }
+}
@@ -1,214 +1,432 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NSF_TRACE_LOG_H
-#define NSF_TRACE_LOG_H
-
-#include "NSFDataEvent.h"
-#include "NSFEventHandler.h"
-#include "NSFTaggedTypes.h"
-#include "NSFXMLDocument.h"
-
-namespace NorthStateFramework
-{
-    /// <summary>
-    /// Represents commonly used tags for the trace log.
-    /// </summary>
-    class NSFTraceTags
-    {
-    public:
-
-        static const NSFString& ActionExecutedTag() { static NSFString string("ActionExecuted"); return string; };
-        static const NSFString& ActionTag() { static NSFString string("Action"); return string; };
-        static const NSFString& DestinationTag() { static NSFString string("Destination"); return string; };
-        static const NSFString& ErrorTag() { static NSFString string("Error"); return string; };
-        static const NSFString& EventQueuedTag() { static NSFString string("EventQueued"); return string; };
-        static const NSFString& EventTag() { static NSFString string("Event"); return string; };
-        static const NSFString& ExceptionTag() { static NSFString string("Exception"); return string; };
-        static const NSFString& InformationalTag() { static NSFString string("Informational"); return string; };
-        static const NSFString& MessageReceivedTag() { static NSFString string("MessageReceived"); return string; };
-        static const NSFString& MessageSentTag() { static NSFString string("MessageSent"); return string; };
-        static const NSFString& MessageTag() { static NSFString string("Message"); return string; };
-        static const NSFString& NameTag() { static NSFString string("Name"); return string; };
-        static const NSFString& ObjectTag() { static NSFString string("Object"); return string; };
-        static const NSFString& SourceTag() { static NSFString string("Source"); return string; };
-        static const NSFString& StateEnteredTag() { static NSFString string("StateEntered"); return string; };
-        static const NSFString& StateMachineTag() { static NSFString string("StateMachine"); return string; };
-        static const NSFString& StateTag() { static NSFString string("State"); return string; };
-        static const NSFString& UnknownTag() { static NSFString string("Unknown"); return string; };
-        static const NSFString& ValueTag() { static NSFString string("Value"); return string; };
-        static const NSFString& VariableTag() { static NSFString string("Variable"); return string; };
-    };
-
-    /// <summary>
-    /// Represents a trace log.
-    /// </summary>
-    class NSFTraceLog : public NSFTaggedObject
-    {
-    public:
-
-        /// <summary>
-        /// Creates a trace log
-        /// </summary>
-        /// <param name="name">The name of the log.</param>
-        /// <remarks>
-        /// By default, thread priority is set to lowest.
-        /// </remarks>
-        NSFTraceLog(const NSFString& name);
-
-        /// <summary>
-        /// Destroys a trace log
-        /// </summary>
-        virtual ~NSFTraceLog();
-
-        /// <summary>
-        /// Gets the framework trace log.
-        /// </summary>
-        /// <remarks>
-        /// This log is where framework traces are recorded, and where static logging operations record traces.
-        /// Most application use this log for custom trace recording, as well.
-        /// </remarks>
-        static NSFTraceLog& getPrimaryTraceLog() { static NSFTraceLog traceLog = NSFTraceLog("PrimaryTraceLog"); return traceLog; };
-
-        /// <summary>
-        /// Gets the flag indicating if tracing is enabled.
-        /// </summary>
-        /// <remarks>
-        /// If tracing is disabled, no additions will be made to the trace log.
-        /// </remarks>
-        bool getEnabled() const { return enabled; }
-
-        /// <summary>
-        /// Sets the flag indicating if tracing is enabled.
-        /// </summary>
-        /// <remarks>
-        /// If tracing is disabled, no additions will be made to the trace log.
-        /// </remarks>
-        void setEnabled(bool value) { enabled = value; }
-
-        /// <summary>
-        /// Gets the maximum number of trace entries in the log.
-        /// </summary>
-        /// <remarks>
-        /// Once the trace limit is reached, old traces are deleted in favor of new ones.
-        /// </remarks>
-        UInt32 getMaxTraces() const { return maxTraces; }
-
-        /// <summary>
-        /// Sets the maximum number of trace entries in the log.
-        /// </summary>
-        /// <remarks>
-        /// Once the trace limit is reached, old traces are deleted in favor of new ones.
-        /// </remarks>
-        void  setMaxTraces(UInt32 value) { maxTraces = value; }
-
-        /// <summary>
-        /// Adds a trace to the log.
-        /// </summary>
-        /// <param name="type">The type of the trace.</param>
-        /// <param name="tag">The tag associated with the trace.</param>
-        /// <param name="data">The data associated with the tag.</param>
-        void addTrace(const NSFString& type, const NSFString& tag, const NSFString& data);
-
-        /// <summary>
-        /// Adds a trace to the log.
-        /// </summary>
-        /// <param name="type">The type of the trace.</param>
-        /// <param name="tag1">The first tag associated with the trace.</param>
-        /// <param name="data1">The data associated with the first tag.</param>
-        /// <param name="tag2">The second tag associated with the trace.</param>
-        /// <param name="data2">The data associated with the second tag.</param>
-        void addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2);
-
-        /// <summary>
-        /// Adds a trace to the log.
-        /// </summary>
-        /// <param name="type">The type of the trace.</param>
-        /// <param name="tag1">The first tag associated with the trace.</param>
-        /// <param name="data1">The data associated with the first tag.</param>
-        /// <param name="tag2">The second tag associated with the trace.</param>
-        /// <param name="data2">The data associated with the second tag.</param>
-        /// <param name="tag3">The third tag associated with the trace.</param>
-        /// <param name="data3">The data associated with the third tag.</param>
-        void addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3);
-
-        /// <summary>
-        /// Have all traces that have been added been logged
-        /// </summary>
-        /// <returns>
-        /// True if the NSFTraceLog has logged all the added traces.
-        /// False if there are traces that have yet to be processed.
-        /// </returns>
-        bool allTracesLogged();
-
-        /// <summary>
-        /// Saves the trace log to a file with the name of the log.
-        /// </summary>
-        /// <remarks>
-        /// The trace log is saved in xml format.
-        /// </remarks>
-        void saveLog();
-
-        /// <summary>
-        /// Saves the trace log to the specified filename.
-        /// </summary>
-        /// <param name="fileName">The relative or fully qualified name for the file.</param>
-        /// <remarks>
-        /// The trace log is saved in xml format.
-        /// </remarks>
-        void saveLog(const NSFString& fileName);
-
-    protected:
-
-        /// <summary>
-        /// Reaction that does the work adding a trace element to the log.
-        /// </summary>
-        /// <param name="context">Additional contextual information.</param>
-        void addTraceToLog(const NSFEventContext& context);
-
-        /// <summary>
-        /// Reaction that does the work of saving the file.
-        /// </summary>
-        /// <param name="context">Additional contextual information.</param>
-        void saveTrace(const NSFEventContext& context);
-
-    private:
-
-        bool enabled;
-        NSFEventHandler eventHandler;
-        UInt32 maxTraces;
-        NSFDataEvent<NSFXMLElement*> traceAddEvent;
-        NSFOSMutex* traceLogMutex;
-        NSFDataEvent<NSFString> traceSaveEvent;
-        NSFXMLDocument xmlLog;
-
-        static const NSFString& TimeTag() { static NSFString string("Time"); return string; };
-        static const NSFString& TraceTag() { static NSFString string("Trace"); return string; };
-        static const NSFString& TraceLogTag() { static NSFString string("TraceLog"); return string; };
-        static const NSFString& TraceAddString() { static NSFString string("TraceAdd"); return string; };
-        static const NSFString& TraceSaveString() { static NSFString string("TraceSave"); return string; };
-        static const NSFString& TraceSaveCompleteString() { static NSFString string("TraceSaveComplete"); return string; };
-    };
-}
-
-#endif // NSF_TRACE_LOG_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TRACE_LOG_H
+#define NSF_TRACE_LOG_H
+
+#include "NSFDataEvent.h"
+#include "NSFEventHandler.h"
+#include "NSFTaggedTypes.h"
+#include "NSFTraceBinaryFile.h"
+#include "NSFTraceBuffer.h"
+#include "NSFTraceFileSink.h"
+#include "NSFTraceFilter.h"
+#include "NSFTraceStringTable.h"
+#include "NSFXMLDocument.h"
+
+#include <set>
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents commonly used tags for the trace log.
+    /// </summary>
+    class NSFTraceTags
+    {
+    public:
+
+        static const NSFString& ActionExecutedTag() { static NSFString string("ActionExecuted"); return string; };
+        static const NSFString& ActionTag() { static NSFString string("Action"); return string; };
+        static const NSFString& DestinationTag() { static NSFString string("Destination"); return string; };
+        static const NSFString& ErrorTag() { static NSFString string("Error"); return string; };
+        static const NSFString& EventHandledTag() { static NSFString string("EventHandled"); return string; };
+        static const NSFString& EventQueuedTag() { static NSFString string("EventQueued"); return string; };
+        static const NSFString& EventTag() { static NSFString string("Event"); return string; };
+        static const NSFString& ExceptionTag() { static NSFString string("Exception"); return string; };
+        static const NSFString& InformationalTag() { static NSFString string("Informational"); return string; };
+        static const NSFString& MessageReceivedTag() { static NSFString string("MessageReceived"); return string; };
+        static const NSFString& MessageSentTag() { static NSFString string("MessageSent"); return string; };
+        static const NSFString& MessageTag() { static NSFString string("Message"); return string; };
+        static const NSFString& NameTag() { static NSFString string("Name"); return string; };
+        static const NSFString& ObjectTag() { static NSFString string("Object"); return string; };
+        static const NSFString& SourceTag() { static NSFString string("Source"); return string; };
+        static const NSFString& StateEnteredTag() { static NSFString string("StateEntered"); return string; };
+        static const NSFString& StateMachineTag() { static NSFString string("StateMachine"); return string; };
+        static const NSFString& StateTag() { static NSFString string("State"); return string; };
+        static const NSFString& UnknownTag() { static NSFString string("Unknown"); return string; };
+        static const NSFString& ValueTag() { static NSFString string("Value"); return string; };
+        static const NSFString& VariableTag() { static NSFString string("Variable"); return string; };
+    };
+
+    /// <summary>
+    /// Represents a trace log.
+    /// </summary>
+    /// <remarks>
+    /// Traces are recorded as fixed size binary records, with their type and tag names replaced by ids in a string table,
+    /// in ring buffers that are written without locking a mutex.
+    /// Short data strings are held in the record, and longer ones in a ring of text overwritten along with the records, truncated beyond NSFTraceRecord::MaxTextDataLength characters.
+    /// Each thread adds traces to its own buffer, which it takes from the log with its first trace, and returns to the log for reuse by another thread when it exits.
+    /// The records of a returned buffer are kept until they are overwritten.
+    /// Where thread local storage is not available, each thread adds traces to one of several shared buffers, selected by its thread id.
+    /// The xml form of the traces is only produced when the log is saved, or when traces are streamed to a trace file sink.
+    /// </remarks>
+    class NSFTraceLog : public NSFTaggedObject
+    {
+    public:
+
+        friend class NSFTraceBinaryFile;
+
+        /// <summary>
+        /// Creates a trace log
+        /// </summary>
+        /// <param name="name">The name of the log.</param>
+        /// <remarks>
+        /// By default, thread priority is set to lowest.
+        /// </remarks>
+        NSFTraceLog(const NSFString& name);
+
+        /// <summary>
+        /// Destroys a trace log
+        /// </summary>
+        virtual ~NSFTraceLog();
+
+        /// <summary>
+        /// Gets the framework trace log.
+        /// </summary>
+        /// <remarks>
+        /// This log is where framework traces are recorded, and where static logging operations record traces.
+        /// Most application use this log for custom trace recording, as well.
+        /// </remarks>
+        static NSFTraceLog& getPrimaryTraceLog() { static NSFTraceLog traceLog = NSFTraceLog("PrimaryTraceLog"); return traceLog; };
+
+        /// <summary>
+        /// Gets the flag indicating if tracing is enabled.
+        /// </summary>
+        /// <remarks>
+        /// If tracing is disabled, no additions will be made to the trace log.
+        /// </remarks>
+        bool getEnabled() const { return enabled; }
+
+        /// <summary>
+        /// Sets the flag indicating if tracing is enabled.
+        /// </summary>
+        /// <remarks>
+        /// If tracing is disabled, no additions will be made to the trace log.
+        /// </remarks>
+        void setEnabled(bool value) { enabled = value; }
+
+        /// <summary>
+        /// Gets the filter that selects the framework traces added to the log.
+        /// </summary>
+        /// <remarks>
+        /// The filter applies to the traces added by the framework, which check it before adding a trace to the primary trace log.
+        /// Traces added directly by applications are not filtered.
+        /// </remarks>
+        NSFTraceFilter& getFilter() { return filter; }
+
+        /// <summary>
+        /// Indicates if tracing is enabled for a category of framework traces.
+        /// </summary>
+        /// <remarks>
+        /// This is the cheap check made by framework call sites before they evaluate any trace data.
+        /// </remarks>
+        bool isTraceEnabled(NSFTraceCategory category) const { return (enabled && filter.isCategoryEnabled(category)); }
+
+        /// <summary>
+        /// Gets the maximum number of trace entries in the log.
+        /// </summary>
+        /// <remarks>
+        /// Once the trace limit is reached, old traces are deleted in favor of new ones.
+        /// </remarks>
+        UInt32 getMaxTraces() const { return maxTraces; }
+
+        /// <summary>
+        /// Sets the maximum number of trace entries in the log.
+        /// </summary>
+        /// <remarks>
+        /// Once the trace limit is reached, old traces are deleted in favor of new ones.
+        /// Increasing the limit allocates larger trace buffers, so it is best set before tracing begins.
+        /// Each thread's buffer holds the maximum number of traces, so that the most recent traces are kept even if one thread adds them all.
+        /// </remarks>
+        void setMaxTraces(UInt32 value);
+
+        /// <summary>
+        /// Adds a trace to the log.
+        /// </summary>
+        /// <param name="type">The type of the trace.</param>
+        /// <param name="tag">The tag associated with the trace.</param>
+        /// <param name="data">The data associated with the tag.</param>
+        void addTrace(const NSFString& type, const NSFString& tag, const NSFString& data);
+
+        /// <summary>
+        /// Adds a trace to the log.
+        /// </summary>
+        /// <param name="type">The type of the trace.</param>
+        /// <param name="tag1">The first tag associated with the trace.</param>
+        /// <param name="data1">The data associated with the first tag.</param>
+        /// <param name="tag2">The second tag associated with the trace.</param>
+        /// <param name="data2">The data associated with the second tag.</param>
+        void addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2);
+
+        /// <summary>
+        /// Adds a trace to the log.
+        /// </summary>
+        /// <param name="type">The type of the trace.</param>
+        /// <param name="tag1">The first tag associated with the trace.</param>
+        /// <param name="data1">The data associated with the first tag.</param>
+        /// <param name="tag2">The second tag associated with the trace.</param>
+        /// <param name="data2">The data associated with the second tag.</param>
+        /// <param name="tag3">The third tag associated with the trace.</param>
+        /// <param name="data3">The data associated with the third tag.</param>
+        void addTrace(const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3);
+
+        /// <summary>
+        /// Have all traces that have been added been logged
+        /// </summary>
+        /// <returns>
+        /// True if the NSFTraceLog has logged all the added traces.
+        /// False if there are traces that have yet to be processed.
+        /// </returns>
+        bool allTracesLogged();
+
+        /// <summary>
+        /// Saves the trace log to a file with the name of the log.
+        /// </summary>
+        /// <remarks>
+        /// The trace log is saved in xml format.
+        /// </remarks>
+        void saveLog();
+
+        /// <summary>
+        /// Saves the trace log to the specified filename.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name for the file.</param>
+        /// <remarks>
+        /// The trace log is saved in xml format.
+        /// </remarks>
+        void saveLog(const NSFString& fileName);
+
+        /// <summary>
+        /// Saves the trace log to the specified filename, in the specified format.
+        /// </summary>
+        /// <param name="fileName">The relative or fully qualified name for the file.</param>
+        /// <param name="format">The format of the file.</param>
+        /// <remarks>
+        /// The binary format is several times faster to save and many times smaller than xml, which suits saving large logs when an exception occurs.
+        /// Binary files are compressed, and may be converted to xml with the TraceDecoder tool.
+        /// </remarks>
+        void saveLog(const NSFString& fileName, NSFTraceFileFormat format);
+
+        /// <summary>
+        /// Starts streaming traces to a trace file sink.
+        /// </summary>
+        /// <param name="sink">The sink to stream traces to.</param>
+        /// <remarks>
+        /// At each of the sink's flush intervals, the traces added since the previous interval are written to the sink on the trace log's thread,
+        /// starting with the traces the log holds when streaming starts.
+        /// The trace log takes ownership of the sink, and deletes it when streaming stops.
+        /// If the sink's first file cannot be opened, an exception is thrown and the caller retains ownership of the sink.
+        /// Any sink already streaming is stopped first.
+        /// </remarks>
+        void startStreaming(NSFTraceFileSink* sink);
+
+        /// <summary>
+        /// Stops streaming traces, writing any remaining traces to the sink before deleting it.
+        /// </summary>
+        void stopStreaming();
+
+    protected:
+
+        /// <summary>
+        /// Reaction that does the work of saving the file.
+        /// </summary>
+        /// <param name="context">Additional contextual information.</param>
+        void saveTrace(const NSFEventContext& context);
+
+        /// <summary>
+        /// Reaction that does the work of saving the file in binary format.
+        /// </summary>
+        /// <param name="context">Additional contextual information.</param>
+        void saveBinaryTrace(const NSFEventContext& context);
+
+        /// <summary>
+        /// Reaction that writes the traces added since the previous flush interval to the trace file sink.
+        /// </summary>
+        /// <param name="context">Additional contextual information.</param>
+        void streamTrace(const NSFEventContext& context);
+
+    private:
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+        /// <summary>
+        /// Represents the trace buffer that a thread adds traces to in a trace log.
+        /// </summary>
+        struct ThreadTraceBuffer
+        {
+            NSFTraceLog* traceLog;
+            UInt32 traceLogId;
+            UInt32 generation;
+            NSFTraceBuffer* traceBuffer;
+        };
+
+        /// <summary>
+        /// Represents the trace buffers of a thread, which are returned to their trace logs when the thread exits.
+        /// </summary>
+        struct ThreadTraceBuffers
+        {
+            std::vector<ThreadTraceBuffer> traceBuffers;
+
+            ~ThreadTraceBuffers();
+        };
+
+        static thread_local ThreadTraceBuffers threadTraceBuffers;
+#else
+        static const int TraceBufferCount = 8;
+#endif
+
+        static const UInt32 StringTableCapacity = 8192;
+
+        bool enabled;
+        NSFTraceFilter filter;
+        NSFEventHandler eventHandler;
+        UInt32 maxTraces;
+        NSFOSMutex* traceLogMutex;
+        NSFDataEvent<NSFString> traceSaveEvent;
+        NSFDataEvent<NSFString> traceBinarySaveEvent;
+        NSFTraceStringTable stringTable;
+        UInt32 traceBufferCapacity;
+        std::list<NSFTraceBuffer*> traceBuffers;
+        std::list<NSFTraceBuffer*> retiredTraceBuffers;
+#if defined NSF_THREAD_LOCAL_STORAGE
+        std::list<NSFTraceBuffer*> freeTraceBuffers;
+        UInt32 traceLogId;
+        volatile UInt32 traceBufferGeneration;
+#else
+        NSFTraceBuffer* sharedTraceBuffers[TraceBufferCount];
+#endif
+        NSFEvent traceStreamEvent;
+        NSFTraceFileSink* traceSink;
+        std::vector<NSFTraceRecord> streamRecords;
+        NSFString streamText;
+
+#if defined NSF_THREAD_LOCAL_STORAGE
+        /// <summary>
+        /// Gets the mutex that guards the set of existing trace logs.
+        /// </summary>
+        static NSFOSMutex* getTraceLogsMutex();
+
+        /// <summary>
+        /// Gets the set of existing trace logs, which exiting threads check before returning their trace buffers.
+        /// </summary>
+        static std::set<NSFTraceLog*>& getTraceLogs();
+
+        /// <summary>
+        /// Indicates if a thread's trace buffer belongs to an existing trace log.
+        /// </summary>
+        /// <remarks>
+        /// The trace logs mutex must be locked when calling this method.
+        /// </remarks>
+        static bool isTraceLogLive(const ThreadTraceBuffer& threadTraceBuffer);
+
+        /// <summary>
+        /// Takes a trace buffer for the calling thread, reusing one returned by an exited thread if possible.
+        /// </summary>
+        /// <param name="generation">The generation of the trace buffer, which changes when the buffers are replaced.</param>
+        /// <returns>The trace buffer.</returns>
+        NSFTraceBuffer* acquireTraceBuffer(UInt32& generation);
+
+        /// <summary>
+        /// Returns the trace buffer of an exiting thread for reuse, unless it has been replaced.
+        /// </summary>
+        /// <param name="traceBuffer">The trace buffer.</param>
+        /// <param name="generation">The generation of the trace buffer.</param>
+        void releaseTraceBuffer(NSFTraceBuffer* traceBuffer, UInt32 generation);
+#endif
+
+        /// <summary>
+        /// Appends a data string with the characters that are special in xml escaped.
+        /// </summary>
+        /// <param name="data">The data string.</param>
+        /// <param name="text">The text to append to.</param>
+        static void appendEscapedText(const NSFString& data, NSFString& text);
+
+        /// <summary>
+        /// Appends the xml text of a trace record, formatted as a saved trace log formats it.
+        /// </summary>
+        /// <param name="record">The trace record.</param>
+        /// <param name="text">The text to append to.</param>
+        void appendTraceText(const NSFTraceRecord& record, NSFString& text);
+
+        /// <summary>
+        /// Creates the xml element for a trace record.
+        /// </summary>
+        /// <param name="record">The trace record.</param>
+        /// <returns>The new element.</returns>
+        NSFXMLElement* createTraceElement(const NSFTraceRecord& record);
+
+        /// <summary>
+        /// Gets a data string of a trace record.
+        /// </summary>
+        /// <param name="record">The trace record.</param>
+        /// <param name="index">The index of the tag and data pair.</param>
+        /// <returns>The data string, marked with an ellipsis if it was truncated, or only an ellipsis if it has been overwritten.</returns>
+        NSFString getRecordData(const NSFTraceRecord& record, int index);
+
+        /// <summary>
+        /// Gets the records to save, merged in time order and limited to the maximum number of traces.
+        /// </summary>
+        /// <param name="records">The list to which the records are appended.</param>
+        void getSaveRecords(std::vector<NSFTraceRecord>& records);
+
+        /// <summary>
+        /// Gets the trace buffer for the calling thread.
+        /// </summary>
+        /// <remarks>
+        /// A thread takes its buffer with its first trace, and again after the buffers are replaced to increase their capacity.
+        /// </remarks>
+        NSFTraceBuffer* getTraceBuffer();
+
+        /// <summary>
+        /// Indicates if a trace record is earlier than another.
+        /// </summary>
+        static bool isEarlier(const NSFTraceRecord& record1, const NSFTraceRecord& record2);
+
+        /// <summary>
+        /// Sets a data string of a trace record, holding it in the record if it is short enough, or in the text of the trace buffer otherwise.
+        /// </summary>
+        /// <param name="traceBuffer">The trace buffer to which the record will be added.</param>
+        /// <param name="record">The trace record.</param>
+        /// <param name="index">The index of the tag and data pair.</param>
+        /// <param name="data">The data string.</param>
+        void setRecordData(NSFTraceBuffer* traceBuffer, NSFTraceRecord& record, int index, const NSFString& data);
+
+        /// <summary>
+        /// Writes the traces added since the previous write to the trace file sink.
+        /// </summary>
+        /// <remarks>
+        /// The trace log mutex must be locked when calling this method.
+        /// </remarks>
+        void writeStreamRecords();
+
+        static const NSFString& TimeTag() { static NSFString string("Time"); return string; };
+        static const NSFString& TraceBinarySaveString() { static NSFString string("TraceBinarySave"); return string; };
+        static const NSFString& TraceTag() { static NSFString string("Trace"); return string; };
+        static const NSFString& TraceLogTag() { static NSFString string("TraceLog"); return string; };
+        static const NSFString& TraceSaveString() { static NSFString string("TraceSave"); return string; };
+        static const NSFString& TraceSaveCompleteString() { static NSFString string("TraceSaveComplete"); return string; };
+        static const NSFString& TraceStreamString() { static NSFString string("TraceStream"); return string; };
+        static const NSFString& TruncatedDataString() { static NSFString string("..."); return string; };
+    };
+}
+
+#endif // NSF_TRACE_LOG_H
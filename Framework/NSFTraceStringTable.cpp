@@ -0,0 +1,160 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFTraceStringTable.h"
+
+#include "NSFOSThread.h"
+#include "NSFTraceLog.h"
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFTraceStringTable::NSFTraceStringTable(UInt32 capacity)
+        : capacity(capacity), count(0), strings(new NSFString*[capacity]), slots(NULL), slotMask(1), tableMutex(NSFOSMutex::create())
+    {
+        // Keep the slots at most half full, so that searches are short and always reach an empty slot
+        while (slotMask < (2 * capacity))
+        {
+            slotMask <<= 1;
+        }
+
+        slots = new UInt32[slotMask];
+        --slotMask;
+
+        for (UInt32 i = 0; i <= slotMask; ++i)
+        {
+            slots[i] = 0;
+        }
+
+        // The empty string is not placed in the slots, as it is recognized without searching
+        strings[EmptyStringId] = new NSFString();
+        count = 1;
+
+        UInt32 id;
+        UInt32 slot;
+        findString(NSFTraceTags::UnknownTag(), getHash(NSFTraceTags::UnknownTag()), id, slot);
+        addString(NSFTraceTags::UnknownTag(), slot);
+    }
+
+    NSFTraceStringTable::~NSFTraceStringTable()
+    {
+        for (UInt32 i = 0; i < count; ++i)
+        {
+            delete strings[i];
+        }
+
+        delete[] strings;
+        delete[] slots;
+        delete tableMutex;
+    }
+
+    UInt32 NSFTraceStringTable::getId(const NSFString& string)
+    {
+        if (string.empty())
+        {
+            return EmptyStringId;
+        }
+
+        UInt32 hash = getHash(string);
+        UInt32 id;
+        UInt32 slot;
+
+        if (findString(string, hash, id, slot))
+        {
+            return id;
+        }
+
+        LOCK(tableMutex)
+        {
+            // Another thread may have added the string since it was searched for
+            if (findString(string, hash, id, slot))
+            {
+                return id;
+            }
+
+            if (count >= capacity)
+            {
+                return UnknownStringId;
+            }
+
+            return addString(string, slot);
+        }
+        ENDLOCK;
+    }
+
+    const NSFString& NSFTraceStringTable::getString(UInt32 id) const
+    {
+        if (id >= count)
+        {
+            return *strings[UnknownStringId];
+        }
+
+        return *strings[id];
+    }
+
+    // Private
+
+    bool NSFTraceStringTable::findString(const NSFString& string, UInt32 hash, UInt32& id, UInt32& slot) const
+    {
+        for (slot = hash & slotMask; slots[slot] != 0; slot = (slot + 1) & slotMask)
+        {
+            // Read the string only after the slot that publishes it
+            NSFOSThread::memoryBarrier();
+
+            if (*strings[slots[slot] - 1] == string)
+            {
+                id = slots[slot] - 1;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    UInt32 NSFTraceStringTable::addString(const NSFString& string, UInt32 slot)
+    {
+        UInt32 id = count;
+        strings[id] = new NSFString(string.c_str());
+
+        // Complete the string before publishing it in its slot
+        NSFOSThread::memoryBarrier();
+
+        slots[slot] = id + 1;
+        count = id + 1;
+
+        return id;
+    }
+
+    UInt32 NSFTraceStringTable::getHash(const NSFString& string)
+    {
+        UInt32 hash = 2166136261U;
+
+        for (NSFString::size_type i = 0; i < string.size(); ++i)
+        {
+            hash = (hash ^ (UInt8)string[i]) * 16777619U;
+        }
+
+        return hash;
+    }
+}
@@ -0,0 +1,120 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_TRACE_STRING_TABLE_H
+#define NSF_TRACE_STRING_TABLE_H
+
+#include "NSFCoreTypes.h"
+#include "NSFOSMutex.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a table of the type and tag names used in trace records, each identified by its position in the table.
+    /// </summary>
+    /// <remarks>
+    /// Data strings are not added to the table, as their many distinct values would fill it.
+    /// Strings are added to the table the first time they are traced, and are never removed,
+    /// so an id remains valid for the life of the table.
+    /// Looking up a string that is already in the table does not lock a mutex.
+    /// Once the table is full, strings not already in the table are given the id of NSFTraceTags::UnknownTag().
+    /// </remarks>
+    class NSFTraceStringTable
+    {
+    public:
+
+        /// <summary>
+        /// Creates a trace string table.
+        /// </summary>
+        /// <param name="capacity">The maximum number of strings in the table.</param>
+        NSFTraceStringTable(UInt32 capacity);
+
+        /// <summary>
+        /// Destroys a trace string table.
+        /// </summary>
+        ~NSFTraceStringTable();
+
+        /// <summary>
+        /// Gets the number of strings in the table.
+        /// </summary>
+        UInt32 getCount() const { return count; }
+
+        /// <summary>
+        /// Gets the id of a string, adding the string to the table if necessary.
+        /// </summary>
+        /// <param name="string">The string.</param>
+        /// <returns>The id of the string.</returns>
+        UInt32 getId(const NSFString& string);
+
+        /// <summary>
+        /// Gets the string with the specified id.
+        /// </summary>
+        /// <param name="id">The id of the string.</param>
+        /// <returns>The string, or NSFTraceTags::UnknownTag() if the id is not in the table.</returns>
+        const NSFString& getString(UInt32 id) const;
+
+        /// <summary>
+        /// The id of the empty string.
+        /// </summary>
+        static const UInt32 EmptyStringId = 0;
+
+        /// <summary>
+        /// The id of NSFTraceTags::UnknownTag().
+        /// </summary>
+        static const UInt32 UnknownStringId = 1;
+
+    private:
+
+        UInt32 capacity;
+        volatile UInt32 count;
+        NSFString** strings;
+        UInt32* slots;
+        UInt32 slotMask;
+        NSFOSMutex* tableMutex;
+
+        /// <summary>
+        /// Searches the hash slots for a string.
+        /// </summary>
+        /// <param name="string">The string.</param>
+        /// <param name="hash">The hash of the string.</param>
+        /// <param name="id">The id of the string, if found.</param>
+        /// <param name="slot">The slot holding the string if found, otherwise the empty slot where it belongs.</param>
+        /// <returns>True if the string was found, otherwise false.</returns>
+        bool findString(const NSFString& string, UInt32 hash, UInt32& id, UInt32& slot) const;
+
+        /// <summary>
+        /// Adds a string to the table.
+        /// </summary>
+        /// <remarks>
+        /// The table mutex must be locked when calling this method.
+        /// </remarks>
+        UInt32 addString(const NSFString& string, UInt32 slot);
+
+        /// <summary>
+        /// Gets the FNV-1a hash of a string.
+        /// </summary>
+        static UInt32 getHash(const NSFString& string);
+    };
+}
+
+#endif // NSF_TRACE_STRING_TABLE_H
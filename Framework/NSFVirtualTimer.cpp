@@ -0,0 +1,181 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFVirtualTimer.h"
+
+#include <stdexcept>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFVirtualTimer::NSFVirtualTimer(const NSFString& name, NSFTime startTime)
+        : NSFOSTimer(name), currentTime(startTime), nextTimeout(MaxTime), idle(false), timerMutex(NSFOSMutex::create()),
+        idleSignal(NSFOSSignal::create(name + "Idle")), timeoutSignal(NSFOSSignal::create(name + "Timeout"))
+    {
+    }
+
+    NSFVirtualTimer::~NSFVirtualTimer()
+    {
+        delete timerMutex;
+        delete idleSignal;
+        delete timeoutSignal;
+    }
+
+    void NSFVirtualTimer::advanceTime(NSFTime deltaTime)
+    {
+        waitForIdle();
+
+        NSFTime targetTime;
+        LOCK(timerMutex)
+        {
+            targetTime = currentTime + deltaTime;
+        }
+        ENDLOCK;
+
+        // Step through each timeout up to the target time, so that actions execute at exactly their scheduled times
+        while (true)
+        {
+            NSFTime stepTime;
+            LOCK(timerMutex)
+            {
+                stepTime = (nextTimeout < targetTime) ? nextTimeout : targetTime;
+            }
+            ENDLOCK;
+
+            moveTime(stepTime);
+
+            if (stepTime == targetTime)
+            {
+                break;
+            }
+        }
+    }
+
+    bool NSFVirtualTimer::advanceToNextTimeout()
+    {
+        waitForIdle();
+
+        NSFTime stepTime;
+        LOCK(timerMutex)
+        {
+            if (nextTimeout == MaxTime)
+            {
+                return false;
+            }
+
+            stepTime = nextTimeout;
+        }
+        ENDLOCK;
+
+        moveTime(stepTime);
+
+        return true;
+    }
+
+    NSFTime NSFVirtualTimer::getCurrentTime()
+    {
+        LOCK(timerMutex)
+        {
+            return currentTime;
+        }
+        ENDLOCK;
+    }
+
+    void NSFVirtualTimer::setNextTimeout(NSFTime timeout)
+    {
+        LOCK(timerMutex)
+        {
+            nextTimeout = timeout;
+        }
+        ENDLOCK;
+
+        // Wake the timer thread so that it checks the new timeout
+        timeoutSignal->send();
+    }
+
+    void NSFVirtualTimer::waitForNextTimeout()
+    {
+        while (true)
+        {
+            LOCK(timerMutex)
+            {
+                if (currentTime >= nextTimeout)
+                {
+                    idle = false;
+                    return;
+                }
+
+                idle = true;
+            }
+            ENDLOCK;
+
+            idleSignal->send();
+            timeoutSignal->wait();
+        }
+    }
+
+    // Private
+
+    void NSFVirtualTimer::moveTime(NSFTime time)
+    {
+        LOCK(timerMutex)
+        {
+            if (time > currentTime)
+            {
+                currentTime = time;
+            }
+
+            // The timer thread is no longer idle if the new time releases it
+            if (currentTime >= nextTimeout)
+            {
+                idle = false;
+            }
+        }
+        ENDLOCK;
+
+        timeoutSignal->send();
+
+        waitForIdle();
+    }
+
+    void NSFVirtualTimer::waitForIdle()
+    {
+        while (true)
+        {
+            LOCK(timerMutex)
+            {
+                if (idle)
+                {
+                    return;
+                }
+            }
+            ENDLOCK;
+
+            if (!idleSignal->wait(IdleTimeout))
+            {
+                throw std::runtime_error(getName() + " timer thread did not become idle");
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NSF_VIRTUAL_TIMER_H
+#define NSF_VIRTUAL_TIMER_H
+
+#include "NSFOSTimer.h"
+
+#include "NSFOSMutex.h"
+#include "NSFOSSignal.h"
+
+namespace NorthStateFramework
+{
+    /// <summary>
+    /// Represents a timer whose time only moves when it is advanced explicitly.
+    /// </summary>
+    /// <remarks>
+    /// A virtual timer lets tests run long timer driven scenarios instantly and repeatably.
+    /// It is used by passing it to a timer thread's constructor, or to NSFTimerThread::setTimer(...) for the primary timer thread.
+    /// Advancing the time steps through each pending timeout in order, waiting at each step until the timer thread has executed the ready actions,
+    /// so actions execute at exactly their scheduled times, independent of the load on the host.
+    /// Events queued by timer actions are handled asynchronously on their event threads, which must be allowed to catch up before checking results.
+    /// Event threads with local timers enabled wait in real time, so local timers should not be used with a virtual timer.
+    /// </remarks>
+    class NSFVirtualTimer : public NSFOSTimer
+    {
+    public:
+
+        /// <summary>
+        /// Creates a virtual timer.
+        /// </summary>
+        /// <param name="name">The name of the timer.</param>
+        /// <param name="startTime">The initial time, in the units selected in NSFCustomConfig.h.</param>
+        NSFVirtualTimer(const NSFString& name, NSFTime startTime);
+
+        /// <summary>
+        /// Destroys a virtual timer.
+        /// </summary>
+        ~NSFVirtualTimer();
+
+        /// <summary>
+        /// Advances the time, executing timeouts in order.
+        /// </summary>
+        /// <param name="deltaTime">The amount to advance the time, in the units selected in NSFCustomConfig.h.</param>
+        /// <remarks>
+        /// The method returns after the timer thread has executed all actions scheduled up to and including the new time.
+        /// It must not be called from the timer thread.
+        /// An exception is thrown if the timer thread does not finish executing the actions at a timeout within IdleTimeout.
+        /// </remarks>
+        void advanceTime(NSFTime deltaTime);
+
+        /// <summary>
+        /// Advances the time to the next timeout, executing the actions scheduled for it.
+        /// </summary>
+        /// <returns>True if there was a timeout to advance to, otherwise false.</returns>
+        bool advanceToNextTimeout();
+
+        NSFTime getCurrentTime();
+
+        virtual void setNextTimeout(NSFTime timeout);
+
+        virtual void waitForNextTimeout();
+
+        /// <summary>
+        /// The time allowed for the timer thread to execute the actions at a timeout, in milli-seconds.
+        /// </summary>
+        static const Int32 IdleTimeout = 10000;
+
+    private:
+
+        NSFTime currentTime;
+        NSFTime nextTimeout;
+        bool idle;
+        NSFOSMutex* timerMutex;
+        NSFOSSignal* idleSignal;
+        NSFOSSignal* timeoutSignal;
+
+        /// <summary>
+        /// Moves the time to the specified value and waits until the timer thread is idle again.
+        /// </summary>
+        /// <param name="time">The new time, which must not be before the current time.</param>
+        void moveTime(NSFTime time);
+
+        /// <summary>
+        /// Waits until the timer thread is blocked waiting for a timeout after the current time.
+        /// </summary>
+        void waitForIdle();
+    };
+}
+
+#endif // NSF_VIRTUAL_TIMER_H
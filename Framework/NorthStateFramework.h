@@ -1,62 +1,79 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef NORTH_STATE_FRAMEWORK_H
-#define NORTH_STATE_FRAMEWORK_H
-
-// This file includes all headers necessary for complete functionality of the North State Framework
-
-#include "NSFDelegateContext.h"
-#include "NSFDelegates.h"
-#include "NSFChoiceState.h"
-#include "NSFCompositeState.h"
-#include "NSFCoreTypes.h"
-#include "NSFDataEvent.h"
-#include "NSFDebugUtility.h"
-#include "NSFDeepHistory.h"
-#include "NSFEnvironment.h"
-#include "NSFEvent.h"
-#include "NSFEventHandler.h"
-#include "NSFEventThread.h"
-#include "NSFExceptionHandler.h"
-#include "NSFExternalTransition.h"
-#include "NSFForkJoin.h"
-#include "NSFForkJoinTransition.h"
-#include "NSFInitialState.h"
-#include "NSFInternalTransition.h"
-#include "NSFLocalTransition.h"
-#include "NSFRegion.h"
-#include "NSFScheduledAction.h"
-#include "NSFShallowHistory.h"
-#include "NSFState.h"
-#include "NSFStateMachine.h"
-#include "NSFTimerAction.h"
-#include "NSFTimerThread.h"
-#include "NSFTraceLog.h"
-#include "NSFTransition.h"
-#include "NSFXMLDocument.h"
-
-using namespace std;
-using namespace NorthStateFramework;
-
-#endif // NORTH_STATE_FRAMEWORK_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NORTH_STATE_FRAMEWORK_H
+#define NORTH_STATE_FRAMEWORK_H
+
+// This file includes all headers necessary for complete functionality of the North State Framework
+
+#include "NSFDelegateContext.h"
+#include "NSFDelegates.h"
+#include "NSFBroadcastEvent.h"
+#include "NSFChoiceState.h"
+#include "NSFChromeTraceExporter.h"
+#include "NSFCompositeState.h"
+#include "NSFCoreTypes.h"
+#include "NSFDataEvent.h"
+#include "NSFDebugUtility.h"
+#include "NSFDeepHistory.h"
+#include "NSFEnvironment.h"
+#include "NSFEvent.h"
+#include "NSFEventHandler.h"
+#include "NSFEventPool.h"
+#include "NSFEventThread.h"
+#include "NSFEventTimer.h"
+#include "NSFExceptionHandler.h"
+#include "NSFExternalTransition.h"
+#include "NSFForkJoin.h"
+#include "NSFForkJoinTransition.h"
+#include "NSFInitialState.h"
+#include "NSFInlineDataEvent.h"
+#include "NSFInternalTransition.h"
+#include "NSFLocalTransition.h"
+#include "NSFPassivationManager.h"
+#include "NSFRegion.h"
+#include "NSFRegionWorkerPool.h"
+#include "NSFScheduledAction.h"
+#include "NSFShallowHistory.h"
+#include "NSFState.h"
+#include "NSFStateMachine.h"
+#include "NSFStateMachineConfiguration.h"
+#include "NSFStateMachineProxy.h"
+#include "NSFStateTimeoutEvent.h"
+#include "NSFTimerAction.h"
+#include "NSFTimerQueue.h"
+#include "NSFTimerThread.h"
+#include "NSFTraceBinaryFile.h"
+#include "NSFTraceBuffer.h"
+#include "NSFTraceFileSink.h"
+#include "NSFTraceFilter.h"
+#include "NSFTraceLog.h"
+#include "NSFTraceStringTable.h"
+#include "NSFTransition.h"
+#include "NSFVirtualTimer.h"
+#include "NSFXMLDocument.h"
+
+using namespace std;
+using namespace NorthStateFramework;
+
+#endif // NORTH_STATE_FRAMEWORK_H
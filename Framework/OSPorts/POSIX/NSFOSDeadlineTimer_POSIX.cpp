@@ -0,0 +1,120 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NSFCustomConfig.h"
+
+#if defined NSF_OS_POSIX
+
+#include "NSFOSDeadlineTimer_POSIX.h"
+
+#if defined NSF_OS_POSIX_TIMERFD
+
+#include <stdexcept>
+#include <errno.h>
+#include <cstring>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace NorthStateFramework
+{
+    // Public
+
+    NSFOSDeadlineTimer_POSIX::NSFOSDeadlineTimer_POSIX(const NSFString& name)
+        : NSFOSTimer(name), startTime(now()), timerDescriptor(timerfd_create(ClockNumber, TFD_CLOEXEC))
+    {
+        if (timerDescriptor == -1)
+        {
+            throw std::runtime_error(getName() + " timer timerfd_create() failed in constructor: " + toString(strerror(errno)));
+        }
+    }
+
+    NSFOSDeadlineTimer_POSIX::~NSFOSDeadlineTimer_POSIX()
+    {
+        close(timerDescriptor);
+    }
+
+    NSFTime NSFOSDeadlineTimer_POSIX::getCurrentTime()
+    {
+        return (now() - startTime);
+    }
+
+    void NSFOSDeadlineTimer_POSIX::setNextTimeout(NSFTime timeout)
+    {
+        // A zero deadline disarms the timer, which is the behavior wanted when there is no next timeout
+        itimerspec deadline;
+        memset(&deadline, 0, sizeof(deadline));
+
+        if (timeout < MaxTime - startTime)
+        {
+            NSFTime absoluteTimeout = startTime + ((timeout > 0) ? timeout : 0);
+
+            deadline.it_value.tv_sec = (time_t)(absoluteTimeout / TimeUnitsPerSecond);
+            deadline.it_value.tv_nsec = (long)convertTime(absoluteTimeout % TimeUnitsPerSecond, TimeUnitsPerSecond, NanoSecondsPerSecond);
+
+            // A timeout at the very start of the monotonic clock has already passed, but must still arm the timer
+            if ((deadline.it_value.tv_sec == 0) && (deadline.it_value.tv_nsec == 0))
+            {
+                deadline.it_value.tv_nsec = 1;
+            }
+        }
+
+        // Re-arming replaces the previous deadline, so a thread blocked in waitForNextTimeout wakes at the new deadline
+        if (timerfd_settime(timerDescriptor, TFD_TIMER_ABSTIME, &deadline, NULL) != 0)
+        {
+            throw std::runtime_error(getName() + " timer timerfd_settime() failed in setNextTimeout(NSFTime timeout): " + toString(strerror(errno)));
+        }
+    }
+
+    void NSFOSDeadlineTimer_POSIX::waitForNextTimeout()
+    {
+        UInt64 expirations;
+
+        while (read(timerDescriptor, &expirations, sizeof(expirations)) < 0)
+        {
+            switch (errno)
+            {
+            case EINTR:
+                // The call was interrupted by a signal handler ... return to waiting for the deadline.
+                break;
+            default:
+                throw std::runtime_error(getName() + " timer read() failed in waitForNextTimeout(): " + toString(strerror(errno)));
+            }
+        }
+    }
+
+    // Private
+
+    NSFTime NSFOSDeadlineTimer_POSIX::now()
+    {
+        timespec timespecNow;
+        clock_gettime(ClockNumber, &timespecNow);
+
+        NSFTime now = ((NSFTime)timespecNow.tv_sec * TimeUnitsPerSecond) + convertTime(timespecNow.tv_nsec, NanoSecondsPerSecond, TimeUnitsPerSecond);
+
+        return now;
+    }
+}
+
+#endif // NSF_OS_POSIX_TIMERFD
+
+#endif // NSF_OS_POSIX
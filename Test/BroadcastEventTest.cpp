@@ -0,0 +1,249 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BroadcastEventTest.h"
+
+#include <string.h>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    // BroadcastEventTestPayload
+
+    volatile UInt32 BroadcastEventTestPayload::copyCount = 0;
+    volatile UInt32 BroadcastEventTestPayload::destroyCount = 0;
+
+    BroadcastEventTestPayload::BroadcastEventTestPayload()
+        : sequence(0)
+    {
+        memset(data, 0, DataSize);
+    }
+
+    BroadcastEventTestPayload::BroadcastEventTestPayload(const BroadcastEventTestPayload& other)
+        : sequence(other.sequence)
+    {
+        memcpy(data, other.data, DataSize);
+        NSFOSThread::atomicIncrement(copyCount);
+    }
+
+    BroadcastEventTestPayload::~BroadcastEventTestPayload()
+    {
+        NSFOSThread::atomicIncrement(destroyCount);
+    }
+
+    BroadcastEventTestPayload& BroadcastEventTestPayload::operator=(const BroadcastEventTestPayload& other)
+    {
+        sequence = other.sequence;
+        memcpy(data, other.data, DataSize);
+        NSFOSThread::atomicIncrement(copyCount);
+        return *this;
+    }
+
+    // BroadcastEventTest
+
+    BroadcastEventTest::BroadcastEventTest(const NSFString& name, int numberOfThreads, int numberOfHandlers, int numberOfBroadcasts)
+        : name(name.c_str()), numberOfThreads(numberOfThreads), numberOfHandlers(numberOfHandlers), numberOfBroadcasts(numberOfBroadcasts),
+        handledMutex(NSFOSMutex::create()), handledCount(0), payloadError(false),
+        broadcastEvent("BroadcastEventTestBroadcast", NULL, NULL), dataEvent("BroadcastEventTestData", NULL, NULL)
+    {
+    }
+
+    BroadcastEventTest::~BroadcastEventTest()
+    {
+        delete handledMutex;
+    }
+
+    bool BroadcastEventTest::runTest(NSFString& errorMessage)
+    {
+        std::vector<NSFEventThread*> eventThreads;
+        std::list<INSFEventHandler*> destinations;
+        std::vector<NSFEventHandler*> eventHandlers;
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            eventThreads.push_back(new NSFEventThread("BroadcastEventTestThread"));
+        }
+
+        for (int i = 0; i < numberOfHandlers; ++i)
+        {
+            NSFEventHandler* eventHandler = new NSFEventHandler("BroadcastEventTestHandler", eventThreads[i % numberOfThreads]);
+            eventHandler->setLoggingEnabled(false);
+            eventHandler->addEventReaction(&broadcastEvent, NSFAction(this, &BroadcastEventTest::handleBroadcastEvent));
+            eventHandler->addEventReaction(&dataEvent, NSFAction(this, &BroadcastEventTest::handleDataEvent));
+            eventHandler->startEventHandler();
+            eventHandlers.push_back(eventHandler);
+            destinations.push_back(eventHandler);
+        }
+
+        BroadcastEventTestPayload payload;
+        UInt32 startCopyCount = BroadcastEventTestPayload::copyCount;
+        UInt32 startDestroyCount = BroadcastEventTestPayload::destroyCount;
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfBroadcasts; ++i)
+        {
+            payload.sequence = i;
+            broadcastEvent.broadcast(payload, destinations);
+        }
+
+        bool completed = waitForHandled(numberOfHandlers * numberOfBroadcasts);
+
+        NSFTime broadcastEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        // Each payload is deleted with the last copy of its event, which is deleted just after it is handled
+        NSFTime timeout = broadcastEndTime + (10 * TimeUnitsPerSecond);
+        while (completed && (BroadcastEventTestPayload::destroyCount - startDestroyCount < (UInt32)numberOfBroadcasts) &&
+            (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        UInt32 broadcastCopyCount = BroadcastEventTestPayload::copyCount - startCopyCount;
+        UInt32 broadcastDestroyCount = BroadcastEventTestPayload::destroyCount - startDestroyCount;
+
+        NSFTime copyStartTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        if (completed)
+        {
+            for (int i = 0; i < numberOfBroadcasts; ++i)
+            {
+                payload.sequence = i;
+
+                for (int j = 0; j < numberOfHandlers; ++j)
+                {
+                    eventHandlers[j]->queueEvent(dataEvent.copy(true, payload));
+                }
+            }
+
+            completed = waitForHandled(2 * numberOfHandlers * numberOfBroadcasts);
+        }
+
+        NSFTime copyEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfHandlers; ++i)
+        {
+            delete eventHandlers[i];
+        }
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            delete eventThreads[i];
+        }
+
+        if (!completed)
+        {
+            errorMessage = "Only " + toString(handledCount) + " events handled";
+            return false;
+        }
+
+        if (payloadError)
+        {
+            errorMessage = "Handlers of a broadcast did not share a single payload";
+            return false;
+        }
+
+        if (broadcastCopyCount != (UInt32)numberOfBroadcasts)
+        {
+            errorMessage = "Payload copied " + toString(broadcastCopyCount) + " times for " + toString(numberOfBroadcasts) + " broadcasts";
+            return false;
+        }
+
+        if (broadcastDestroyCount != (UInt32)numberOfBroadcasts)
+        {
+            errorMessage = "Only " + toString(broadcastDestroyCount) + " of " + toString(numberOfBroadcasts) + " payloads deleted after handling";
+            return false;
+        }
+
+        NSFTime destinationCount = (NSFTime)numberOfHandlers * numberOfBroadcasts;
+        NSFTime broadcastTime = convertTime(broadcastEndTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / destinationCount;
+        NSFTime copyTime = convertTime(copyEndTime - copyStartTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / destinationCount;
+
+        // Add results to name for test visibility
+        name += "; Handlers = " + toString(numberOfHandlers) + ", Payload = " + toString(sizeof(BroadcastEventTestPayload)) +
+            " Bytes, Broadcast / Copy Time = " + toString(broadcastTime) + " / " + toString(copyTime) + " nS per Destination";
+
+        return true;
+    }
+
+    // Private
+
+    void BroadcastEventTest::handleBroadcastEvent(const NSFEventContext& context)
+    {
+        NSFBroadcastEvent<BroadcastEventTestPayload>* nsfEvent = static_cast<NSFBroadcastEvent<BroadcastEventTestPayload>*>(context.getEvent());
+        const BroadcastEventTestPayload& payload = nsfEvent->getData();
+
+        LOCK(handledMutex)
+        {
+            std::map<int, const BroadcastEventTestPayload*>::iterator addressIterator = payloadAddresses.find(payload.sequence);
+
+            if (addressIterator == payloadAddresses.end())
+            {
+                payloadAddresses[payload.sequence] = &payload;
+            }
+            else if (addressIterator->second != &payload)
+            {
+                payloadError = true;
+            }
+
+            ++handledCount;
+        }
+        ENDLOCK;
+    }
+
+    void BroadcastEventTest::handleDataEvent(const NSFEventContext&)
+    {
+        LOCK(handledMutex)
+        {
+            ++handledCount;
+        }
+        ENDLOCK;
+    }
+
+    bool BroadcastEventTest::waitForHandled(int count)
+    {
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (30 * TimeUnitsPerSecond);
+
+        while (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout)
+        {
+            LOCK(handledMutex)
+            {
+                if (handledCount >= count)
+                {
+                    return true;
+                }
+            }
+            ENDLOCK;
+
+            NSFOSThread::sleep(1);
+        }
+
+        return false;
+    }
+}
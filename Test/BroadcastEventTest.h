@@ -0,0 +1,98 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BROADCAST_EVENT_TEST_H
+#define BROADCAST_EVENT_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <map>
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Payload broadcast by the broadcast event test, counting its copies and destructions.
+    /// </summary>
+    struct BroadcastEventTestPayload
+    {
+        static const int DataSize = 4096;
+
+        BroadcastEventTestPayload();
+
+        BroadcastEventTestPayload(const BroadcastEventTestPayload& other);
+
+        ~BroadcastEventTestPayload();
+
+        BroadcastEventTestPayload& operator=(const BroadcastEventTestPayload& other);
+
+        int sequence;
+        char data[DataSize];
+
+        static volatile UInt32 copyCount;
+        static volatile UInt32 destroyCount;
+    };
+
+    /// <summary>
+    /// Broadcast a large payload to many event handlers on several threads, verify that every handler receives the same
+    /// single copy of the payload and that the payload is deleted after the last handler, then compare the time per destination
+    /// with queuing a data event copy to each destination.
+    /// </summary>
+    class BroadcastEventTest : public ITestInterface
+    {
+    public:
+
+        BroadcastEventTest(const NSFString& name, int numberOfThreads, int numberOfHandlers, int numberOfBroadcasts);
+
+        ~BroadcastEventTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfThreads;
+        int numberOfHandlers;
+        int numberOfBroadcasts;
+        NSFOSMutex* handledMutex;
+        int handledCount;
+        bool payloadError;
+        std::map<int, const BroadcastEventTestPayload*> payloadAddresses;
+
+        NSFBroadcastEvent<BroadcastEventTestPayload> broadcastEvent;
+        NSFDataEvent<BroadcastEventTestPayload> dataEvent;
+
+        void handleBroadcastEvent(const NSFEventContext& context);
+
+        void handleDataEvent(const NSFEventContext& context);
+
+        bool waitForHandled(int count);
+    };
+}
+
+#endif // BROADCAST_EVENT_TEST_H
@@ -0,0 +1,276 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ChromeTraceExportTest.h"
+
+#include <fstream>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    ChromeTraceExportTest::ChromeTraceExportTest(const NSFString& name)
+        : name(name.c_str()), handledSignal(NSFOSSignal::create("ChromeTraceExportTestHandled"))
+    {
+    }
+
+    ChromeTraceExportTest::~ChromeTraceExportTest()
+    {
+        delete handledSignal;
+    }
+
+    bool ChromeTraceExportTest::runTest(NSFString& errorMessage)
+    {
+        return exportKnownTraces(errorMessage) && exportLiveTraces(errorMessage);
+    }
+
+    // Private
+
+    void ChromeTraceExportTest::addTrace(NSFXMLDocument& traceLog, NSFTime milliSeconds, const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3)
+    {
+        NSFXMLElement* trace = new NSFXMLElement("Trace");
+        trace->addChildElementBack(new NSFXMLElement("Time", toString(milliSeconds * TimeUnitsPerMilliSecond)));
+
+        NSFXMLElement* typeTrace = new NSFXMLElement(type);
+        trace->addChildElementBack(typeTrace);
+        typeTrace->addChildElementBack(new NSFXMLElement(tag1, data1));
+
+        if (!tag2.empty())
+        {
+            typeTrace->addChildElementBack(new NSFXMLElement(tag2, data2));
+        }
+
+        if (!tag3.empty())
+        {
+            typeTrace->addChildElementBack(new NSFXMLElement(tag3, data3));
+        }
+
+        traceLog.addChildElementBack(trace);
+    }
+
+    bool ChromeTraceExportTest::checkExport(const NSFString& json, const NSFString& expectedText, NSFString& errorMessage)
+    {
+        if (json.find(expectedText) == NSFString::npos)
+        {
+            errorMessage = "Exported trace is missing " + expectedText;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ChromeTraceExportTest::exportKnownTraces(NSFString& errorMessage)
+    {
+        const NSFString FileName = "ChromeTraceExportTest.json";
+
+        NSFXMLDocument traceLog("TraceLog");
+        addTrace(traceLog, 1000, NSFTraceTags::StateEnteredTag(), NSFTraceTags::StateMachineTag(), "Machine1", NSFTraceTags::StateTag(), "Idle", "", "");
+        addTrace(traceLog, 1000, NSFTraceTags::StateEnteredTag(), NSFTraceTags::StateMachineTag(), "Machine2", NSFTraceTags::StateTag(), "Idle", "", "");
+        addTrace(traceLog, 2000, NSFTraceTags::EventQueuedTag(), NSFTraceTags::NameTag(), "Start", NSFTraceTags::SourceTag(), "Machine1", NSFTraceTags::DestinationTag(), "Machine2");
+        addTrace(traceLog, 2500, NSFTraceTags::EventHandledTag(), NSFTraceTags::NameTag(), "Start", NSFTraceTags::DestinationTag(), "Machine2", "", "");
+        addTrace(traceLog, 2500, NSFTraceTags::StateEnteredTag(), NSFTraceTags::StateMachineTag(), "Machine2", NSFTraceTags::StateTag(), "Running", "", "");
+        addTrace(traceLog, 2500, NSFTraceTags::StateEnteredTag(), NSFTraceTags::StateMachineTag(), "Machine2", NSFTraceTags::StateTag(), "Fast", "", "");
+        addTrace(traceLog, 3000, NSFTraceTags::ActionExecutedTag(), NSFTraceTags::ActionTag(), "Tick", "", "", "", "");
+        addTrace(traceLog, 4000, NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), "Say \"hi\"\\", "", "", "", "");
+
+        // Data that reads like an xml entity is exported as it was traced, not decoded again
+        addTrace(traceLog, 4000, NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), "<a> &amp; <b>", "", "", "", "");
+
+        // Traces from different threads with the same time may be saved with the handling before the queuing
+        addTrace(traceLog, 4000, NSFTraceTags::EventHandledTag(), NSFTraceTags::NameTag(), "Stop", NSFTraceTags::DestinationTag(), "Machine2", "", "");
+        addTrace(traceLog, 4000, NSFTraceTags::EventQueuedTag(), NSFTraceTags::NameTag(), "Stop", NSFTraceTags::SourceTag(), "Machine1", NSFTraceTags::DestinationTag(), "Machine2");
+
+        NSFChromeTraceExporter exporter;
+        exporter.addTraceLog(traceLog);
+        exporter.save(FileName);
+
+        NSFString json = readFile(FileName);
+
+        if (!isBalanced(json))
+        {
+            errorMessage = "Exported trace is not well formed";
+            return false;
+        }
+
+        if (exporter.getTraceCount() != 11)
+        {
+            errorMessage = "Exporter converted " + toString(exporter.getTraceCount()) + " traces instead of 11";
+            return false;
+        }
+
+        // Tracks are numbered in order of appearance: Machine1, Machine2, Machine2 Queue, Timers, Traces
+        if (!checkExport(json, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,\"args\":{\"name\":\"Machine2 Queue\"}}", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Idle\",\"cat\":\"State\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"dur\":1500000,\"ts\":1000000,\"args\":{\"states\":\"Idle\"}}", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Fast\",\"cat\":\"State\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"dur\":1500000,\"ts\":2500000,\"args\":{\"states\":\"Running, Fast\"}}", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Idle\",\"cat\":\"State\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"dur\":3000000,\"ts\":1000000,\"args\":{\"states\":\"Idle\"}}", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Start\",\"cat\":\"Event\",\"ph\":\"s\",\"pid\":1,\"tid\":1,\"id\":1,\"ts\":2000000}", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Start\",\"cat\":\"Event\",\"ph\":\"f\",\"pid\":1,\"tid\":2,\"bp\":\"e\",\"id\":1,\"ts\":2500000}", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Start\",\"cat\":\"QueueWait\",\"ph\":\"X\",\"pid\":1,\"tid\":3,\"dur\":500000,\"ts\":2000000", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Stop\",\"cat\":\"QueueWait\",\"ph\":\"X\",\"pid\":1,\"tid\":3,\"dur\":0,\"ts\":4000000", errorMessage) ||
+            !checkExport(json, "{\"name\":\"Tick\",\"cat\":\"Timer\",\"ph\":\"i\",\"pid\":1,\"tid\":4,\"s\":\"t\",\"ts\":3000000}", errorMessage) ||
+            !checkExport(json, "\"args\":{\"Name\":\"Say \\\"hi\\\"\\\\\"}", errorMessage) ||
+            !checkExport(json, "\"args\":{\"Name\":\"<a> &amp; <b>\"}", errorMessage))
+        {
+            return false;
+        }
+
+        // Without queue wait timing, flow arrows end at the destination when the event is queued
+        NSFChromeTraceExporter noWaitExporter;
+        noWaitExporter.setQueueWaitEnabled(false);
+        noWaitExporter.addTraceLog(traceLog);
+        noWaitExporter.save(FileName);
+
+        json = readFile(FileName);
+
+        if (!checkExport(json, "{\"name\":\"Start\",\"cat\":\"Event\",\"ph\":\"f\",\"pid\":1,\"tid\":2,\"bp\":\"e\",\"id\":1,\"ts\":2000000}", errorMessage))
+        {
+            return false;
+        }
+
+        if (json.find("QueueWait") != NSFString::npos)
+        {
+            errorMessage = "Exported trace has queue wait slices with queue wait timing disabled";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ChromeTraceExportTest::exportLiveTraces(NSFString& errorMessage)
+    {
+        const NSFString TraceFileName = "ChromeTraceExportTest.xml";
+        const NSFString FileName = "ChromeTraceExportTestLive.json";
+
+        remove(TraceFileName.c_str());
+
+        NSFEventThread* thread = new NSFEventThread("ChromeTraceExportTestThread");
+        thread->setEventHandledLoggingEnabled(true);
+
+        NSFEventHandler* eventHandler = new NSFEventHandler("ChromeTraceExportTestHandler", thread);
+        NSFEvent testEvent("ChromeTraceExportTestEvent", eventHandler);
+        eventHandler->addEventReaction(&testEvent, NSFAction(this, &ChromeTraceExportTest::handleTestEvent));
+        eventHandler->startEventHandler();
+
+        handledSignal->clear();
+        testEvent.queueEvent();
+        bool handled = handledSignal->wait(1000);
+
+        eventHandler->terminate(true);
+        delete eventHandler;
+        delete thread;
+
+        if (!handled)
+        {
+            errorMessage = "Test event was not handled";
+            return false;
+        }
+
+        NSFTraceLog::getPrimaryTraceLog().saveLog(TraceFileName);
+
+        // The file is saved on the trace log's thread, so wait until it loads
+        NSFChromeTraceExporter exporter;
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (5 * TimeUnitsPerSecond);
+
+        while (!exporter.addTraceFile(TraceFileName))
+        {
+            if (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() > timeout)
+            {
+                errorMessage = "Unable to load saved trace log";
+                return false;
+            }
+
+            NSFOSThread::sleep(10);
+        }
+
+        exporter.save(FileName);
+
+        NSFString json = readFile(FileName);
+
+        if (!isBalanced(json))
+        {
+            errorMessage = "Exported live trace is not well formed";
+            return false;
+        }
+
+        if (!checkExport(json, "{\"name\":\"ChromeTraceExportTestEvent\",\"cat\":\"QueueWait\"", errorMessage) ||
+            !checkExport(json, "\"args\":{\"name\":\"ChromeTraceExportTestHandler Queue\"}", errorMessage))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    void ChromeTraceExportTest::handleTestEvent(const NSFEventContext&)
+    {
+        handledSignal->send();
+    }
+
+    bool ChromeTraceExportTest::isBalanced(const NSFString& json)
+    {
+        int depth = 0;
+        bool inString = false;
+
+        for (NSFString::size_type i = 0; i < json.size(); ++i)
+        {
+            char character = json[i];
+
+            if (inString)
+            {
+                if (character == '\\')
+                {
+                    ++i;
+                }
+                else if (character == '"')
+                {
+                    inString = false;
+                }
+            }
+            else if (character == '"')
+            {
+                inString = true;
+            }
+            else if ((character == '{') || (character == '['))
+            {
+                ++depth;
+            }
+            else if ((character == '}') || (character == ']'))
+            {
+                if (--depth < 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return (depth == 0) && !inString;
+    }
+
+    NSFString ChromeTraceExportTest::readFile(const NSFString& fileName)
+    {
+        std::ifstream file(fileName.c_str());
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+}
@@ -0,0 +1,70 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CHROME_TRACE_EXPORT_TEST_H
+#define CHROME_TRACE_EXPORT_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Export a known trace log to Chrome trace event format and verify the timeline, then export live traces with queue wait timing.
+    /// </summary>
+    class ChromeTraceExportTest : public ITestInterface
+    {
+    public:
+
+        ChromeTraceExportTest(const NSFString& name);
+
+        ~ChromeTraceExportTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        NSFOSSignal* handledSignal;
+
+        void addTrace(NSFXMLDocument& traceLog, NSFTime milliSeconds, const NSFString& type, const NSFString& tag1, const NSFString& data1, const NSFString& tag2, const NSFString& data2, const NSFString& tag3, const NSFString& data3);
+
+        bool checkExport(const NSFString& json, const NSFString& expectedText, NSFString& errorMessage);
+
+        bool exportKnownTraces(NSFString& errorMessage);
+
+        bool exportLiveTraces(NSFString& errorMessage);
+
+        void handleTestEvent(const NSFEventContext& context);
+
+        static bool isBalanced(const NSFString& json);
+
+        static NSFString readFile(const NSFString& fileName);
+    };
+}
+
+#endif // CHROME_TRACE_EXPORT_TEST_H
@@ -0,0 +1,110 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "DataEventMoveTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    DataEventMoveTest::DataEventMoveTest(const NSFString& name, int numberOfEvents)
+        : name(name.c_str()), numberOfEvents(numberOfEvents), payloadEvent("PayloadEvent", NULL, NULL)
+    {
+    }
+
+    bool DataEventMoveTest::runTest(NSFString& errorMessage)
+    {
+#if defined NSF_MOVE_SEMANTICS
+        UInt32 payloadSize = PayloadSize;
+
+        // Moving the payload must hand off its buffer rather than copying it
+        Payload movedPayload(payloadSize, 1);
+        const UInt8* movedBuffer = &movedPayload[0];
+        NSFDataEvent<Payload>* movedEvent = payloadEvent.copy(true, std::move(movedPayload));
+
+        if ((&movedEvent->getData()[0] != movedBuffer) || (movedEvent->getData().size() != payloadSize) || (movedEvent->getId() != payloadEvent.getId()))
+        {
+            delete movedEvent;
+            errorMessage = "Payload was not moved into the event";
+            return false;
+        }
+
+        delete movedEvent;
+
+        // Deleted data events are returned to the event pool for reuse
+        if (NSFEventPool<NSFDataEvent<Payload> >::getPooledEventCount() == 0)
+        {
+            errorMessage = "Deleted event was not returned to the event pool";
+            return false;
+        }
+
+        NSFDataEvent<Payload>* emplacedEvent = payloadEvent.emplace(true, payloadSize, (UInt8)2);
+
+        if ((emplacedEvent->getData().size() != payloadSize) || (emplacedEvent->getData()[payloadSize - 1] != 2) || (emplacedEvent->getId() != payloadEvent.getId()))
+        {
+            delete emplacedEvent;
+            errorMessage = "Payload was not constructed in place in the event";
+            return false;
+        }
+
+        delete emplacedEvent;
+
+        // Each variant creates an event holding a newly filled payload, as a producer handing off data would
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            Payload payload(payloadSize, (UInt8)i);
+            delete payloadEvent.copy(true, payload);
+        }
+
+        NSFTime copyEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            Payload payload(payloadSize, (UInt8)i);
+            delete payloadEvent.copy(true, std::move(payload));
+        }
+
+        NSFTime moveEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            delete payloadEvent.emplace(true, payloadSize, (UInt8)i);
+        }
+
+        NSFTime emplaceEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        NSFTime copyTime = convertTime(copyEndTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfEvents;
+        NSFTime moveTime = convertTime(moveEndTime - copyEndTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfEvents;
+        NSFTime emplaceTime = convertTime(emplaceEndTime - moveEndTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfEvents;
+
+        // Add results to name for test visibility
+        name += "; Payload = " + toString(payloadSize / 1024) + " KB, Copy / Move / Emplace Time = " + toString(copyTime) + " / " + toString(moveTime) + " / " + toString(emplaceTime) + " nS";
+#else
+        name += "; Move semantics not available";
+#endif // NSF_MOVE_SEMANTICS
+
+        return true;
+    }
+}
@@ -0,0 +1,62 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef DATA_EVENT_MOVE_TEST_H
+#define DATA_EVENT_MOVE_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Verify that a large data payload is moved into a data event rather than copied, and that emplace constructs it in place,
+    /// then report the time to create an event with a 64KB payload by copying, moving, and emplacing.
+    /// </summary>
+    class DataEventMoveTest : public ITestInterface
+    {
+    public:
+
+        DataEventMoveTest(const NSFString& name, int numberOfEvents);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        typedef std::vector<UInt8> Payload;
+
+        static const UInt32 PayloadSize = 64 * 1024;
+
+        NSFString name;
+        int numberOfEvents;
+        NSFDataEvent<Payload> payloadEvent;
+    };
+}
+
+#endif // DATA_EVENT_MOVE_TEST_H
@@ -0,0 +1,162 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "EventConstructionTest.h"
+
+#include <algorithm>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    EventConstructionTest::EventConstructionTest(const NSFString& name, int numberOfThreads, int numberOfEvents)
+        : name(name.c_str()), numberOfThreads(numberOfThreads), numberOfEvents(numberOfEvents), workerMutex(NSFOSMutex::create()),
+        workersStarted(0), workersCompleted(0)
+    {
+    }
+
+    EventConstructionTest::~EventConstructionTest()
+    {
+        delete workerMutex;
+    }
+
+    bool EventConstructionTest::runTest(NSFString& errorMessage)
+    {
+        workerIds.assign(numberOfThreads, std::vector<NSFId>());
+
+        std::vector<NSFOSThread*> workerThreads;
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads.push_back(NSFOSThread::create("EventConstructionTestWorker", NSFAction(this, &EventConstructionTest::workerLoop), NSFOSThread::getMediumPriority()));
+        }
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads[i]->startThread();
+        }
+
+        bool completed = false;
+        NSFTime timeout = startTime + (60 * TimeUnitsPerSecond);
+
+        while (!completed && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            NSFOSThread::sleep(1);
+
+            LOCK(workerMutex)
+            {
+                completed = (workersCompleted == numberOfThreads);
+            }
+            ENDLOCK;
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            delete workerThreads[i];
+        }
+
+        if (!completed)
+        {
+            errorMessage = "Workers did not complete";
+            return false;
+        }
+
+        if (!checkWorkerIds(errorMessage))
+        {
+            return false;
+        }
+
+        // The time includes a few milliseconds of polling for completion
+        NSFTime constructionTime = convertTime(endTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / ((NSFTime)numberOfThreads * numberOfEvents);
+
+        // Add results to name for test visibility
+        name += "; Threads = " + toString(numberOfThreads) + ", Event Construction Time = " + toString(constructionTime) + " nS";
+
+        return true;
+    }
+
+    // Private
+
+    bool EventConstructionTest::checkWorkerIds(NSFString& errorMessage)
+    {
+        std::vector<NSFId> allIds;
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            for (std::vector<NSFId>::size_type j = 1; j < workerIds[i].size(); ++j)
+            {
+                if (workerIds[i][j] <= workerIds[i][j - 1])
+                {
+                    errorMessage = "Event ids did not increase on a worker thread";
+                    return false;
+                }
+            }
+
+            allIds.insert(allIds.end(), workerIds[i].begin(), workerIds[i].end());
+        }
+
+        std::sort(allIds.begin(), allIds.end());
+
+        if (std::adjacent_find(allIds.begin(), allIds.end()) != allIds.end())
+        {
+            errorMessage = "Events constructed on different threads have the same id";
+            return false;
+        }
+
+        return true;
+    }
+
+    void EventConstructionTest::workerLoop(const NSFContext&)
+    {
+        int worker;
+
+        LOCK(workerMutex)
+        {
+            worker = workersStarted++;
+        }
+        ENDLOCK;
+
+        std::vector<NSFId>& ids = workerIds[worker];
+        ids.reserve(numberOfEvents);
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            NSFEvent nsfEvent("EventConstructionTestEvent", NULL, NULL);
+            ids.push_back(nsfEvent.getId());
+        }
+
+        LOCK(workerMutex)
+        {
+            ++workersCompleted;
+        }
+        ENDLOCK;
+    }
+}
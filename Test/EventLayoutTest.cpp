@@ -0,0 +1,184 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "EventLayoutTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    EventLayoutTest::EventLayoutTest(const NSFString& name, int numberOfEvents)
+        : name(name.c_str()), numberOfEvents(numberOfEvents), handledMutex(NSFOSMutex::create()), handledCount(0),
+        eventThread("EventLayoutTestThread"), eventHandler("EventLayoutTestHandler", &eventThread), layoutEvent("EventLayoutTestEvent", &eventHandler)
+    {
+        eventHandler.setLoggingEnabled(false);
+        eventHandler.addEventReaction(&layoutEvent, NSFAction(this, &EventLayoutTest::handleEvent));
+        eventHandler.startEventHandler();
+    }
+
+    EventLayoutTest::~EventLayoutTest()
+    {
+        delete handledMutex;
+    }
+
+    bool EventLayoutTest::runTest(NSFString& errorMessage)
+    {
+        if (!checkTimerAttachment(errorMessage))
+        {
+            return false;
+        }
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            delete layoutEvent.copy(true);
+        }
+
+        NSFTime copyEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        int startCount = handledCount;
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            eventHandler.queueEvent(layoutEvent.copy(true));
+        }
+
+        if (!waitForHandled(startCount + numberOfEvents))
+        {
+            errorMessage = "Only " + toString(handledCount - startCount) + " of " + toString(numberOfEvents) + " events handled";
+            return false;
+        }
+
+        NSFTime queueEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        // Guard against a zero elapsed time on platforms with a coarse clock
+        NSFTime copyTime = (copyEndTime > startTime) ? (copyEndTime - startTime) : 1;
+        NSFTime queueTime = (queueEndTime > copyEndTime) ? (queueEndTime - copyEndTime) : 1;
+
+        NSFTime copiesPerSecond = ((NSFTime)numberOfEvents * TimeUnitsPerSecond) / copyTime;
+        NSFTime queuedPerSecond = ((NSFTime)numberOfEvents * TimeUnitsPerSecond) / queueTime;
+
+        // Add results to name for test visibility
+        name += "; Event / Event Timer Size = " + toString(sizeof(NSFEvent)) + " / " + toString(sizeof(NSFEventTimer)) +
+            " Bytes, Copied and Deleted = " + toString(copiesPerSecond) + ", Queued and Handled = " + toString(queuedPerSecond) + " per Second";
+
+        return true;
+    }
+
+    // Private
+
+    bool EventLayoutTest::checkTimerAttachment(NSFString& errorMessage)
+    {
+        NSFEvent* eventCopy = layoutEvent.copy(false);
+
+        // Reading timer settings and unscheduling must not attach a timer
+        bool attachedEarly = layoutEvent.hasTimer() || eventCopy->hasTimer() || (eventCopy->getDelayTime() != 0) || eventCopy->isScheduled();
+        eventCopy->unschedule();
+        attachedEarly |= eventCopy->hasTimer();
+
+        if (attachedEarly)
+        {
+            delete eventCopy;
+            errorMessage = "Timer attached to an event that was not scheduled";
+            return false;
+        }
+
+        int startCount = handledCount;
+        eventCopy->schedule(TimeUnitsPerMilliSecond, 0);
+
+        if (!eventCopy->hasTimer() || (eventCopy->getTimer()->getEvent() != eventCopy) || (eventCopy->getTimer()->getName() != eventCopy->getName()))
+        {
+            delete eventCopy;
+            errorMessage = "Timer not attached to a scheduled event";
+            return false;
+        }
+
+        if (!waitForHandled(startCount + 1))
+        {
+            delete eventCopy;
+            errorMessage = "Scheduled event not handled";
+            return false;
+        }
+
+        // The schedule of an event is not copied
+        NSFEvent* scheduledCopy = eventCopy->copy(false);
+        bool copiedTimer = scheduledCopy->hasTimer();
+        delete scheduledCopy;
+
+        // Unscheduling detaches the event from the timer thread, leaving the timer attached for the next schedule
+        eventCopy->schedule(TimeUnitsPerSecond, 0);
+        eventCopy->unschedule();
+        bool unscheduled = !eventCopy->isScheduled() && eventCopy->hasTimer();
+        delete eventCopy;
+
+        if (copiedTimer)
+        {
+            errorMessage = "Timer copied with its event";
+            return false;
+        }
+
+        if (!unscheduled)
+        {
+            errorMessage = "Scheduled event not unscheduled";
+            return false;
+        }
+
+        return true;
+    }
+
+    void EventLayoutTest::handleEvent(const NSFEventContext&)
+    {
+        LOCK(handledMutex)
+        {
+            ++handledCount;
+        }
+        ENDLOCK;
+    }
+
+    bool EventLayoutTest::waitForHandled(int count)
+    {
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (30 * TimeUnitsPerSecond);
+
+        while (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout)
+        {
+            LOCK(handledMutex)
+            {
+                if (handledCount >= count)
+                {
+                    return true;
+                }
+            }
+            ENDLOCK;
+
+            NSFOSThread::sleep(1);
+        }
+
+        return false;
+    }
+}
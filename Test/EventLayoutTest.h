@@ -0,0 +1,69 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef EVENT_LAYOUT_TEST_H
+#define EVENT_LAYOUT_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Verify that a timer is attached to an event only when it is scheduled, and that a scheduled event is still delivered,
+    /// then report the event size and the rates at which events are copied and deleted, and queued and handled.
+    /// </summary>
+    class EventLayoutTest : public ITestInterface
+    {
+    public:
+
+        EventLayoutTest(const NSFString& name, int numberOfEvents);
+
+        ~EventLayoutTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfEvents;
+        NSFOSMutex* handledMutex;
+        int handledCount;
+
+        NSFEventThread eventThread;
+        NSFEventHandler eventHandler;
+        NSFEvent layoutEvent;
+
+        bool checkTimerAttachment(NSFString& errorMessage);
+
+        void handleEvent(const NSFEventContext& context);
+
+        bool waitForHandled(int count);
+    };
+}
+
+#endif // EVENT_LAYOUT_TEST_H
@@ -0,0 +1,213 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "InlineDataEventTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    InlineDataEventTest::InlineDataEventTest(const NSFString& name, int numberOfEvents)
+        : name(name.c_str()), numberOfEvents(numberOfEvents), handledMutex(NSFOSMutex::create()), handledCount(0), handledSum(0),
+        inlineEvent("InlineDataEventTestInline", NULL, NULL), dataEvent("InlineDataEventTestData", NULL, NULL)
+    {
+    }
+
+    InlineDataEventTest::~InlineDataEventTest()
+    {
+        delete handledMutex;
+    }
+
+    bool InlineDataEventTest::runTest(NSFString& errorMessage)
+    {
+        if (!checkPayloads(errorMessage))
+        {
+            return false;
+        }
+
+        NSFEventThread* eventThread = new NSFEventThread("InlineDataEventTestThread");
+        NSFEventHandler* eventHandler = new NSFEventHandler("InlineDataEventTestHandler", eventThread);
+        eventHandler->setLoggingEnabled(false);
+        eventHandler->addEventReaction(&inlineEvent, NSFAction(this, &InlineDataEventTest::handleInlineEvent));
+        eventHandler->addEventReaction(&dataEvent, NSFAction(this, &InlineDataEventTest::handleDataEvent));
+        eventHandler->startEventHandler();
+
+        InlineDataEventTestPosition position = { 0, 1, 2, 3, 4 };
+        UInt64 expectedSum = 0;
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            position.sequence = i;
+            eventHandler->queueEvent(inlineEvent.copy(true, position));
+            expectedSum += i;
+        }
+
+        bool completed = waitForHandled(numberOfEvents);
+
+        NSFTime inlineEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        if (completed)
+        {
+            for (int i = 0; i < numberOfEvents; ++i)
+            {
+                position.sequence = i;
+                eventHandler->queueEvent(dataEvent.copy(true, position));
+                expectedSum += i;
+            }
+
+            completed = waitForHandled(2 * numberOfEvents);
+        }
+
+        NSFTime dataEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        delete eventHandler;
+        delete eventThread;
+
+        if (!completed)
+        {
+            errorMessage = "Only " + toString(handledCount) + " events handled";
+            return false;
+        }
+
+        if (handledSum != expectedSum)
+        {
+            errorMessage = "Payloads were not delivered intact";
+            return false;
+        }
+
+        NSFTime inlineTime = convertTime(inlineEndTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfEvents;
+        NSFTime dataTime = convertTime(dataEndTime - inlineEndTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfEvents;
+
+        // Add results to name for test visibility
+        name += "; Event / Inline Data Event Size = " + toString(sizeof(NSFEvent)) + " / " + toString(sizeof(NSFInlineDataEvent)) +
+            " Bytes, Inline / Data Event Time = " + toString(inlineTime) + " / " + toString(dataTime) + " nS";
+
+        return true;
+    }
+
+    // Private
+
+    bool InlineDataEventTest::checkPayloads(NSFString& errorMessage)
+    {
+        if (inlineEvent.hasData())
+        {
+            errorMessage = "Event created without a payload has a payload";
+            return false;
+        }
+
+        NSFInlineDataEvent* counterEvent = inlineEvent.copy(true, (UInt32)7);
+        bool counterValid = counterEvent->hasData<UInt32>() && !counterEvent->hasData<Int32>() && (counterEvent->getData<UInt32>() == 7);
+
+        // A payload of the same size but a different type must be rejected
+        bool wrongTypeRejected = false;
+        try
+        {
+            counterEvent->getData<Int32>();
+        }
+        catch (const std::runtime_error&)
+        {
+            wrongTypeRejected = true;
+        }
+
+        InlineDataEventTestPosition position = { 5, -1, -2, -3, 4 };
+        counterEvent->setData(position);
+
+        NSFInlineDataEvent* positionEvent = static_cast<NSFInlineDataEvent*>(counterEvent->copy(true));
+        const InlineDataEventTestPosition& copiedPosition = positionEvent->getData<InlineDataEventTestPosition>();
+        bool positionValid = !positionEvent->hasData<UInt32>() && (positionEvent->getId() == inlineEvent.getId()) &&
+            (copiedPosition.sequence == 5) && (copiedPosition.x == -1) && (copiedPosition.y == -2) && (copiedPosition.z == -3) && (copiedPosition.time == 4);
+
+        positionEvent->clearData();
+        bool cleared = !positionEvent->hasData();
+
+        delete counterEvent;
+        delete positionEvent;
+
+        if (!counterValid || !positionValid)
+        {
+            errorMessage = "Payload did not match the value set";
+            return false;
+        }
+
+        if (!wrongTypeRejected)
+        {
+            errorMessage = "Payload of the wrong type was not rejected";
+            return false;
+        }
+
+        if (!cleared)
+        {
+            errorMessage = "Payload was not cleared";
+            return false;
+        }
+
+        return true;
+    }
+
+    void InlineDataEventTest::handleInlineEvent(const NSFEventContext& context)
+    {
+        NSFInlineDataEvent* nsfEvent = static_cast<NSFInlineDataEvent*>(context.getEvent());
+
+        LOCK(handledMutex)
+        {
+            handledSum += nsfEvent->getData<InlineDataEventTestPosition>().sequence;
+            ++handledCount;
+        }
+        ENDLOCK;
+    }
+
+    void InlineDataEventTest::handleDataEvent(const NSFEventContext& context)
+    {
+        NSFDataEvent<InlineDataEventTestPosition>* nsfEvent = static_cast<NSFDataEvent<InlineDataEventTestPosition>*>(context.getEvent());
+
+        LOCK(handledMutex)
+        {
+            handledSum += nsfEvent->getData().sequence;
+            ++handledCount;
+        }
+        ENDLOCK;
+    }
+
+    bool InlineDataEventTest::waitForHandled(int count)
+    {
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (30 * TimeUnitsPerSecond);
+
+        while (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout)
+        {
+            LOCK(handledMutex)
+            {
+                if (handledCount >= count)
+                {
+                    return true;
+                }
+            }
+            ENDLOCK;
+
+            NSFOSThread::sleep(1);
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,83 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef INLINE_DATA_EVENT_TEST_H
+#define INLINE_DATA_EVENT_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Small payload carried inline by the inline data event test.
+    /// </summary>
+    struct InlineDataEventTestPosition
+    {
+        UInt32 sequence;
+        Int32 x;
+        Int32 y;
+        Int32 z;
+        UInt64 time;
+    };
+
+    /// <summary>
+    /// Verify that inline data events carry payloads of different types and reject requests for the wrong type,
+    /// then report the event size and the time to queue and handle an inline data event and an equivalent data event.
+    /// </summary>
+    class InlineDataEventTest : public ITestInterface
+    {
+    public:
+
+        InlineDataEventTest(const NSFString& name, int numberOfEvents);
+
+        ~InlineDataEventTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfEvents;
+        NSFOSMutex* handledMutex;
+        int handledCount;
+        UInt64 handledSum;
+
+        NSFInlineDataEvent inlineEvent;
+        NSFDataEvent<InlineDataEventTestPosition> dataEvent;
+
+        bool checkPayloads(NSFString& errorMessage);
+
+        void handleInlineEvent(const NSFEventContext& context);
+
+        void handleDataEvent(const NSFEventContext& context);
+
+        bool waitForHandled(int count);
+    };
+}
+
+#endif // INLINE_DATA_EVENT_TEST_H
@@ -0,0 +1,302 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "LocalTimerTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    const int LocalTimerTest::NumberOfThreads;
+
+    LocalTimerTest::LocalTimerTest(const NSFString& name, int numberOfOperations)
+        : name(name.c_str()), numberOfOperations(numberOfOperations), eventSignal(NSFOSSignal::create("LocalTimerTestSignal")), workerMutex(NSFOSMutex::create()),
+        workersStarted(0), workersCompleted(0)
+    {
+    }
+
+    LocalTimerTest::~LocalTimerTest()
+    {
+        delete eventSignal;
+        delete workerMutex;
+    }
+
+    bool LocalTimerTest::runTest(NSFString& errorMessage)
+    {
+        if (!testLocalScheduling(errorMessage) || !testMovingScheduledEvent(errorMessage))
+        {
+            return false;
+        }
+
+        NSFTime primaryOperationsPerSecond;
+        NSFTime localOperationsPerSecond;
+
+        if (!measureOperations(false, primaryOperationsPerSecond, errorMessage) ||
+            !measureOperations(true, localOperationsPerSecond, errorMessage))
+        {
+            return false;
+        }
+
+        // Add results to name for test visibility
+        name += "; Threads = " + toString(NumberOfThreads) + ", Schedule + Unschedule / Sec = " + toString(primaryOperationsPerSecond) + " Primary, "
+            + toString(localOperationsPerSecond) + " Local";
+
+        return true;
+    }
+
+    // Private
+
+    bool LocalTimerTest::testLocalScheduling(NSFString& errorMessage)
+    {
+        NSFTimerThread& primaryTimerThread = NSFTimerThread::getPrimaryTimerThread();
+        NSFEventThread* eventThread = new NSFEventThread("LocalTimerTestThread");
+        NSFEventHandler* eventHandler = new NSFEventHandler("LocalTimerTestHandler", eventThread);
+        NSFEvent* event = new NSFEvent("LocalTimerTestEvent", eventHandler);
+
+        eventHandler->addEventReaction(event, NSFAction(this, &LocalTimerTest::handleEvent));
+        eventHandler->startEventHandler();
+        eventThread->setLocalTimersEnabled(true);
+        eventSignal->clear();
+
+        bool result = false;
+
+        // Use a while loop to allow breaking out on failure with common clean up
+        while (true)
+        {
+            event->schedule(10 * TimeUnitsPerMilliSecond, 0);
+
+            if (!eventThread->isScheduled(event->getTimer()) || primaryTimerThread.isScheduled(event->getTimer()))
+            {
+                errorMessage = "Event not scheduled on its destination's event thread";
+                break;
+            }
+
+            if (!eventSignal->wait(1000))
+            {
+                errorMessage = "Locally scheduled event not handled";
+                break;
+            }
+
+            event->schedule(TimeUnitsPerSecond, 0);
+            event->unschedule();
+
+            if (event->isScheduled())
+            {
+                errorMessage = "Locally scheduled event not unscheduled";
+                break;
+            }
+
+            // Disabling local timers must move scheduled events to the primary timer thread
+            event->schedule(TimeUnitsPerSecond, 0);
+            eventThread->setLocalTimersEnabled(false);
+
+            if (eventThread->isScheduled(event->getTimer()) || !primaryTimerThread.isScheduled(event->getTimer()))
+            {
+                errorMessage = "Event not moved to the primary timer thread";
+                break;
+            }
+
+            event->unschedule();
+
+            result = true;
+            break;
+        }
+
+        delete event;
+        delete eventHandler;
+        delete eventThread;
+
+        return result;
+    }
+
+    bool LocalTimerTest::testMovingScheduledEvent(NSFString& errorMessage)
+    {
+        NSFEventThread* eventThreadA = new NSFEventThread("LocalTimerTestThreadA");
+        NSFEventThread* eventThreadB = new NSFEventThread("LocalTimerTestThreadB");
+        NSFEventHandler* eventHandlerA = new NSFEventHandler("LocalTimerTestHandlerA", eventThreadA);
+        NSFEventHandler* eventHandlerB = new NSFEventHandler("LocalTimerTestHandlerB", eventThreadB);
+        NSFEvent* movingEvent = new NSFEvent("LocalTimerTestMovingEvent", eventHandlerA);
+        NSFEvent* stayingEvent = new NSFEvent("LocalTimerTestStayingEvent", eventHandlerA);
+
+        eventHandlerA->addEventReaction(movingEvent, NSFAction(this, &LocalTimerTest::handleEvent));
+        eventHandlerA->addEventReaction(stayingEvent, NSFAction(this, &LocalTimerTest::handleEvent));
+        eventHandlerB->addEventReaction(movingEvent, NSFAction(this, &LocalTimerTest::handleEvent));
+        eventHandlerA->startEventHandler();
+        eventHandlerB->startEventHandler();
+        eventThreadA->setLocalTimersEnabled(true);
+        eventThreadB->setLocalTimersEnabled(true);
+        eventSignal->clear();
+
+        bool result = false;
+
+        // Use a while loop to allow breaking out on failure with common clean up
+        while (true)
+        {
+            // Rescheduling with a new destination must move the event from the first thread's queue to the second's
+            movingEvent->schedule(TimeUnitsPerSecond, 0);
+            movingEvent->schedule(NULL, eventHandlerB, 10 * TimeUnitsPerMilliSecond, 0);
+
+            if (eventThreadA->isScheduled(movingEvent->getTimer()) || !eventThreadB->isScheduled(movingEvent->getTimer()))
+            {
+                errorMessage = "Event not moved to its new destination's event thread";
+                break;
+            }
+
+            if (!eventSignal->wait(1000))
+            {
+                errorMessage = "Moved event not handled";
+                break;
+            }
+
+            // The first thread's queue must still be intact after the event left it
+            stayingEvent->schedule(10 * TimeUnitsPerMilliSecond, 0);
+
+            if (!eventSignal->wait(1000))
+            {
+                errorMessage = "Event not handled after another event moved away from its thread";
+                break;
+            }
+
+            // Unscheduling must find the event on the thread holding it, after it moves back
+            movingEvent->schedule(TimeUnitsPerSecond, 0);
+            movingEvent->schedule(NULL, eventHandlerA, TimeUnitsPerSecond, 0);
+            movingEvent->unschedule();
+
+            if (movingEvent->isScheduled() || eventThreadA->isScheduled(movingEvent->getTimer()) || eventThreadB->isScheduled(movingEvent->getTimer()))
+            {
+                errorMessage = "Moved event not unscheduled";
+                break;
+            }
+
+            result = true;
+            break;
+        }
+
+        delete movingEvent;
+        delete stayingEvent;
+        delete eventHandlerA;
+        delete eventHandlerB;
+        delete eventThreadA;
+        delete eventThreadB;
+
+        return result;
+    }
+
+    bool LocalTimerTest::measureOperations(bool localTimersEnabled, NSFTime& operationsPerSecond, NSFString& errorMessage)
+    {
+        std::vector<NSFEventThread*> eventThreads;
+        std::vector<NSFEventHandler*> eventHandlers;
+        std::vector<NSFOSThread*> workerThreads;
+
+        workerEvents.clear();
+        workersStarted = 0;
+        workersCompleted = 0;
+
+        // Each worker schedules its own event, so that contention is only on the timer queue
+        for (int i = 0; i < NumberOfThreads; ++i)
+        {
+            eventThreads.push_back(new NSFEventThread("LocalTimerTestThread"));
+            eventThreads[i]->setLocalTimersEnabled(localTimersEnabled);
+            eventHandlers.push_back(new NSFEventHandler("LocalTimerTestHandler", eventThreads[i]));
+            workerEvents.push_back(new NSFEvent("LocalTimerTestEvent", eventHandlers[i]));
+            workerThreads.push_back(NSFOSThread::create("LocalTimerTestWorker", NSFAction(this, &LocalTimerTest::workerLoop), NSFOSThread::getMediumPriority()));
+        }
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < NumberOfThreads; ++i)
+        {
+            workerThreads[i]->startThread();
+        }
+
+        NSFTime timeout = startTime + (60 * TimeUnitsPerSecond);
+        bool completed = false;
+
+        while (!completed && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            NSFOSThread::sleep(1);
+
+            LOCK(workerMutex)
+            {
+                completed = (workersCompleted == NumberOfThreads);
+            }
+            ENDLOCK;
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        if (!completed)
+        {
+            // Worker threads still reference the events, so they are intentionally leaked
+            errorMessage = "Scheduling workers did not complete";
+            return false;
+        }
+
+        for (int i = 0; i < NumberOfThreads; ++i)
+        {
+            delete workerEvents[i];
+            delete eventHandlers[i];
+            delete eventThreads[i];
+            delete workerThreads[i];
+        }
+
+        workerEvents.clear();
+
+        if (endTime <= startTime)
+        {
+            endTime = startTime + 1;
+        }
+
+        operationsPerSecond = (NSFTime)NumberOfThreads * numberOfOperations * TimeUnitsPerSecond / (endTime - startTime);
+
+        return true;
+    }
+
+    void LocalTimerTest::handleEvent(const NSFEventContext&)
+    {
+        eventSignal->send();
+    }
+
+    void LocalTimerTest::workerLoop(const NSFContext&)
+    {
+        NSFEvent* event;
+
+        LOCK(workerMutex)
+        {
+            event = workerEvents[workersStarted++];
+        }
+        ENDLOCK;
+
+        for (int i = 0; i < numberOfOperations; ++i)
+        {
+            event->schedule(TimeUnitsPerSecond, 0);
+            event->unschedule();
+        }
+
+        LOCK(workerMutex)
+        {
+            ++workersCompleted;
+        }
+        ENDLOCK;
+    }
+}
@@ -0,0 +1,76 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef LOCAL_TIMER_TEST_H
+#define LOCAL_TIMER_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test scheduling of events on their destination's event thread, and measure scheduling throughput from several threads
+    /// with events scheduled on the primary timer thread and on local event thread timer queues.
+    /// </summary>
+    class LocalTimerTest : public ITestInterface
+    {
+    public:
+
+        LocalTimerTest(const NSFString& name, int numberOfOperations);
+
+        ~LocalTimerTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const int NumberOfThreads = 4;
+
+        NSFString name;
+        int numberOfOperations;
+        NSFOSSignal* eventSignal;
+        NSFOSMutex* workerMutex;
+        std::vector<NSFEvent*> workerEvents;
+        int workersStarted;
+        int workersCompleted;
+
+        bool testLocalScheduling(NSFString& errorMessage);
+
+        bool testMovingScheduledEvent(NSFString& errorMessage);
+
+        bool measureOperations(bool localTimersEnabled, NSFTime& operationsPerSecond, NSFString& errorMessage);
+
+        void handleEvent(const NSFEventContext& context);
+
+        void workerLoop(const NSFContext& context);
+    };
+}
+
+#endif // LOCAL_TIMER_TEST_H
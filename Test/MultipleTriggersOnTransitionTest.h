@@ -1,71 +1,71 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef MULTIPLE_TRIGGERS_ON_TRANSITION_TEST_H
-#define MULTIPLE_TRIGGERS_ON_TRANSITION_TEST_H
-
-#include "TestHarness.h"
-#include "TestInterface.h"
-
-using namespace NorthStateFramework;
-using namespace std;
-
-namespace NSFTest
-{
-    /// <summary>
-    /// Test multiple triggers for a single transition.
-    /// </summary>
-    class MultipleTriggersOnTransitionTest : public NSFStateMachine, public ITestInterface
-    {
-    public:
-        MultipleTriggersOnTransitionTest(const NSFString& name);
-
-        ~MultipleTriggersOnTransitionTest();
-
-        const NSFString& getName() { return NSFStateMachine::getName();}
-
-        bool runTest(NSFString& errorMessage);
-
-    private:
-
-        TestHarness testHarness;
-
-        // Events
-        NSFEvent event1;
-        NSFEvent event2;
-        NSFEvent event3;
-        NSFEvent event4;
-
-        // Regions and states, from outer to inner
-        NSFInitialState initialState;
-        NSFCompositeState state1;
-        NSFCompositeState state2;
-
-        // Transitions, ordered internal, local, external
-        NSFExternalTransition initialAToState1Transition;
-        NSFExternalTransition state1ToState2Transition;
-        NSFExternalTransition state2ToState1Transition;
-    };
-}
-
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef MULTIPLE_TRIGGERS_ON_TRANSITION_TEST_H
+#define MULTIPLE_TRIGGERS_ON_TRANSITION_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+using namespace std;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test multiple triggers for a single transition.
+    /// </summary>
+    class MultipleTriggersOnTransitionTest : public NSFStateMachine, public ITestInterface
+    {
+    public:
+        MultipleTriggersOnTransitionTest(const NSFString& name);
+
+        ~MultipleTriggersOnTransitionTest();
+
+        const NSFString& getName() { return NSFStateMachine::getName();}
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        TestHarness testHarness;
+
+        // Events
+        NSFEvent event1;
+        NSFEvent event2;
+        NSFEvent event3;
+        NSFEvent event4;
+
+        // Regions and states, from outer to inner
+        NSFInitialState initialState;
+        NSFCompositeState state1;
+        NSFCompositeState state2;
+
+        // Transitions, ordered internal, local, external
+        NSFExternalTransition initialAToState1Transition;
+        NSFExternalTransition state1ToState2Transition;
+        NSFExternalTransition state2ToState1Transition;
+    };
+}
+
 #endif // MULTIPLE_TRIGGERS_ON_TRANSITION_TEST_H
\ No newline at end of file
@@ -0,0 +1,248 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "NameTableTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    NameTableTest::NameTableTest(const NSFString& name, int numberOfThreads, int numberOfCopies)
+        : name(name.c_str()), numberOfThreads(numberOfThreads), numberOfCopies(numberOfCopies), workerMutex(NSFOSMutex::create()),
+        workersStarted(0), workersCompleted(0)
+    {
+    }
+
+    NameTableTest::~NameTableTest()
+    {
+        delete workerMutex;
+    }
+
+    bool NameTableTest::runTest(NSFString& errorMessage)
+    {
+        if (!checkEventNames(errorMessage))
+        {
+            return false;
+        }
+
+        workerNames.assign(numberOfThreads, std::vector<const NSFString*>());
+
+        // Count before creating the workers, as their name is released when they are deleted
+        UInt32 startCount = NSFNameTable::getCount();
+
+        std::vector<NSFOSThread*> workerThreads;
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads.push_back(NSFOSThread::create("NameTableTestWorker", NSFAction(this, &NameTableTest::workerLoop), NSFOSThread::getMediumPriority()));
+        }
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads[i]->startThread();
+        }
+
+        bool completed = false;
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (10 * TimeUnitsPerSecond);
+
+        while (!completed && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            NSFOSThread::sleep(1);
+
+            LOCK(workerMutex)
+            {
+                completed = (workersCompleted == numberOfThreads);
+            }
+            ENDLOCK;
+        }
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            delete workerThreads[i];
+        }
+
+        if (!completed)
+        {
+            errorMessage = "Workers did not complete";
+            return false;
+        }
+
+        if (!checkWorkerNames(errorMessage))
+        {
+            return false;
+        }
+
+        if (NSFNameTable::getCount() != startCount + NumberOfNames)
+        {
+            errorMessage = "Name table added " + toString(NSFNameTable::getCount() - startCount) + " names instead of " + toString((UInt32)NumberOfNames);
+            return false;
+        }
+
+        // Releasing every reference to the names removes them from the table
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            for (int j = 0; j < NumberOfNames; ++j)
+            {
+                NSFNameTable::release(workerNames[i][j]);
+            }
+        }
+
+        if (NSFNameTable::getCount() != startCount)
+        {
+            errorMessage = "Name table kept " + toString(NSFNameTable::getCount() - startCount) + " released names";
+            return false;
+        }
+
+        NSFTime copyTime = measureCopyTime();
+
+        // Add results to name for test visibility
+        name += "; Threads = " + toString(numberOfThreads) + ", Event Copy Time = " + toString(copyTime) + " nS";
+
+        return true;
+    }
+
+    // Private
+
+    bool NameTableTest::checkEventNames(NSFString& errorMessage)
+    {
+        // Build the names separately, so that the events do not start from the same string
+        NSFString firstName = "NameTableTest";
+        NSFString secondName = "NameTable";
+        secondName += "Test";
+
+        NSFEvent firstEvent(firstName, NULL, NULL);
+        NSFEvent secondEvent(secondName, NULL, NULL);
+
+        if ((&firstEvent.getName() != &secondEvent.getName()) || (firstEvent.getName() != firstName))
+        {
+            errorMessage = "Events with equal names do not share the interned name";
+            return false;
+        }
+
+        NSFEvent* eventCopy = firstEvent.copy(false);
+        bool copyShared = (&eventCopy->getName() == &firstEvent.getName());
+        delete eventCopy;
+
+        if (!copyShared)
+        {
+            errorMessage = "Event copy does not share the interned name";
+            return false;
+        }
+
+        eventCopy = firstEvent.copy("NameTableTestCopy", false);
+        bool copyRenamed = (eventCopy->getName() == "NameTableTestCopy") && (firstEvent.getName() == firstName);
+        delete eventCopy;
+
+        if (!copyRenamed)
+        {
+            errorMessage = "Renamed event copy does not have its own name";
+            return false;
+        }
+
+        NSFXMLElement firstElement(firstName);
+        NSFXMLElement secondElement(secondName, "Text");
+
+        if (&firstElement.getTag() != &secondElement.getTag())
+        {
+            errorMessage = "Xml elements with equal tags do not share the interned tag";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool NameTableTest::checkWorkerNames(NSFString& errorMessage)
+    {
+        for (int i = 0; i < NumberOfNames; ++i)
+        {
+            const NSFString* internedName = workerNames[0][i];
+
+            if (*internedName != "NameTableTestWorkerName" + toString(i))
+            {
+                errorMessage = "Interned name does not match the name";
+                return false;
+            }
+
+            for (int j = 1; j < numberOfThreads; ++j)
+            {
+                if (workerNames[j][i] != internedName)
+                {
+                    errorMessage = "Name interned concurrently by workers was interned more than once";
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    NSFTime NameTableTest::measureCopyTime()
+    {
+        NSFEvent nsfEvent("NameTableTestCopyTimeEvent", NULL, NULL);
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfCopies; ++i)
+        {
+            delete nsfEvent.copy(false);
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        return convertTime(endTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfCopies;
+    }
+
+    void NameTableTest::workerLoop(const NSFContext&)
+    {
+        int worker;
+
+        LOCK(workerMutex)
+        {
+            worker = workersStarted++;
+        }
+        ENDLOCK;
+
+        // Convert the names ahead of time, so that the workers intern them as close together as possible
+        std::vector<NSFString> names;
+        for (int i = 0; i < NumberOfNames; ++i)
+        {
+            names.push_back("NameTableTestWorkerName" + toString(i));
+        }
+
+        std::vector<const NSFString*>& internedNames = workerNames[worker];
+        for (int i = 0; i < NumberOfNames; ++i)
+        {
+            internedNames.push_back(NSFNameTable::intern(names[i]));
+        }
+
+        LOCK(workerMutex)
+        {
+            ++workersCompleted;
+        }
+        ENDLOCK;
+    }
+}
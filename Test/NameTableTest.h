@@ -0,0 +1,74 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NAME_TABLE_TEST_H
+#define NAME_TABLE_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test that equal names are interned once, including when interned concurrently from several threads,
+    /// and are removed when released, then measure the time to copy an event.
+    /// </summary>
+    class NameTableTest : public ITestInterface
+    {
+    public:
+
+        NameTableTest(const NSFString& name, int numberOfThreads, int numberOfCopies);
+
+        ~NameTableTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const int NumberOfNames = 1000;
+
+        NSFString name;
+        int numberOfThreads;
+        int numberOfCopies;
+        NSFOSMutex* workerMutex;
+        int workersStarted;
+        int workersCompleted;
+        std::vector<std::vector<const NSFString*> > workerNames;
+
+        bool checkEventNames(NSFString& errorMessage);
+
+        bool checkWorkerNames(NSFString& errorMessage);
+
+        NSFTime measureCopyTime();
+
+        void workerLoop(const NSFContext& context);
+    };
+}
+
+#endif // NAME_TABLE_TEST_H
@@ -0,0 +1,257 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ParallelRegionTest.h"
+
+namespace NSFTest
+{
+    ParallelRegionWorker::ParallelRegionWorker(int workSize)
+        : checksum(2166136261U), workSize(workSize)
+    {
+    }
+
+    void ParallelRegionWorker::doWork(const NSFStateMachineContext&)
+    {
+        for (int i = 0; i < workSize; ++i)
+        {
+            checksum = (checksum ^ (UInt8)i) * 16777619U;
+        }
+    }
+
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    ParallelRegionTestStateMachine::ParallelRegionTestStateMachine(const NSFString& name, NSFEventThread* thread, int numberOfRegions, int workSize)
+        : NSFStateMachine(name, thread), stateChangeCount(0),
+        // Events
+        event1("Event1", this),
+        event2("Event2", this),
+        event3("Event3", this),
+        // States
+        initialState("Initial", this),
+        workingState("Working", this, NULL, NULL),
+        doneState("Done", this, NULL, NULL),
+        // Transitions
+        initialToWorkingTransition("InitialToWorking", &initialState, &workingState, NULL, NULL, NULL),
+        workingToDoneTransition("WorkingToDone", &workingState, &doneState, &event3, NULL, NULL)
+    {
+        for (int i = 0; i <= numberOfRegions; ++i)
+        {
+            NSFString index = toString(i);
+
+            // The sequenced region is placed in the middle, so that independent regions on either side are processed as separate groups
+            bool independent = (i != numberOfRegions / 2);
+
+            workers.push_back(new ParallelRegionWorker(independent ? workSize : 0));
+
+            NSFRegion* region = new NSFRegion((independent ? "Independent" : "Sequenced") + index, &workingState);
+            region->setIndependent(independent);
+            regions.push_back(region);
+
+            NSFInitialState* regionInitialState = new NSFInitialState("Initial" + index, region);
+            NSFCompositeState* idleState = new NSFCompositeState("Idle" + index, region, NULL, NULL);
+            NSFCompositeState* busyState = new NSFCompositeState("Busy" + index, region, NULL, NULL);
+            states.push_back(regionInitialState);
+            states.push_back(idleState);
+            states.push_back(busyState);
+            idleStates.push_back(idleState);
+            busyStates.push_back(busyState);
+
+            transitions.push_back(new NSFExternalTransition("Initial" + index + "ToIdle" + index, regionInitialState, idleState, NULL, NULL, NULL));
+            transitions.push_back(new NSFExternalTransition("Idle" + index + "ToBusy" + index, idleState, busyState, &event1, NULL, NSFAction(workers.back(), &ParallelRegionWorker::doWork)));
+            transitions.push_back(new NSFExternalTransition("Busy" + index + "ToIdle" + index, busyState, idleState, &event2, NULL, NSFAction(workers.back(), &ParallelRegionWorker::doWork)));
+        }
+
+        // Event3 is handled within the working state only while the first region is busy
+        busy0ReactionTransition = new NSFInternalTransition("Busy0Reaction", busyStates.front(), &event3, NULL, NULL);
+
+        // The count is not atomic, so it only matches sequential processing if state change actions are serialized
+        StateChangeActions += NSFAction(this, &ParallelRegionTestStateMachine::countStateChange);
+    }
+
+    ParallelRegionTestStateMachine::~ParallelRegionTestStateMachine()
+    {
+        terminate(true);
+
+        delete busy0ReactionTransition;
+
+        for (std::vector<NSFExternalTransition*>::size_type i = 0; i < transitions.size(); ++i)
+        {
+            delete transitions[i];
+        }
+
+        for (std::vector<NSFState*>::size_type i = 0; i < states.size(); ++i)
+        {
+            delete states[i];
+        }
+
+        for (std::vector<NSFRegion*>::size_type i = 0; i < regions.size(); ++i)
+        {
+            delete regions[i];
+            delete workers[i];
+        }
+    }
+
+    void ParallelRegionTestStateMachine::countStateChange(const NSFStateMachineContext&)
+    {
+        ++stateChangeCount;
+    }
+
+    ParallelRegionTest::ParallelRegionTest(const NSFString& name, int numberOfRegions, int workSize, int numberOfCycles)
+        : name(name.c_str()), numberOfCycles(numberOfCycles),
+        eventThread(new NSFEventThread(name)),
+        regionWorkerPool(new NSFRegionWorkerPool(name + "Worker", numberOfRegions - 1)),
+        sequentialStateMachine(new ParallelRegionTestStateMachine(name + "Sequential", eventThread, numberOfRegions, workSize)),
+        parallelStateMachine(new ParallelRegionTestStateMachine(name + "Parallel", eventThread, numberOfRegions, workSize))
+    {
+        parallelStateMachine->setRegionWorkerPool(regionWorkerPool);
+    }
+
+    ParallelRegionTest::~ParallelRegionTest()
+    {
+        delete sequentialStateMachine;
+        delete parallelStateMachine;
+        delete regionWorkerPool;
+        delete eventThread;
+    }
+
+    bool ParallelRegionTest::runTest(NSFString& errorMessage)
+    {
+        NSFTime sequentialCycleTime = 0;
+        NSFTime parallelCycleTime = 0;
+
+        if (!runStateMachine(sequentialStateMachine, sequentialCycleTime, errorMessage) ||
+            !runStateMachine(parallelStateMachine, parallelCycleTime, errorMessage))
+        {
+            return false;
+        }
+
+        // Test
+        //  concurrent processing results in the same configuration as sequential processing
+        //  concurrent processing executes the same actions as sequential processing
+        std::vector<UInt8> sequentialSnapshot;
+        std::vector<UInt8> parallelSnapshot;
+        sequentialStateMachine->saveSnapshot(sequentialSnapshot);
+        parallelStateMachine->saveSnapshot(parallelSnapshot);
+
+        if (sequentialSnapshot != parallelSnapshot)
+        {
+            errorMessage = "Parallel State Machine configuration does not match sequential configuration.";
+            return false;
+        }
+
+        for (std::vector<ParallelRegionWorker*>::size_type i = 0; i < sequentialStateMachine->workers.size(); ++i)
+        {
+            if (sequentialStateMachine->workers[i]->getChecksum() != parallelStateMachine->workers[i]->getChecksum())
+            {
+                errorMessage = "Parallel State Machine actions do not match sequential actions.";
+                return false;
+            }
+        }
+
+        // Test
+        //  concurrent processing executes every state change action
+        if (sequentialStateMachine->stateChangeCount != parallelStateMachine->stateChangeCount)
+        {
+            errorMessage = "Parallel State Machine state change actions do not match sequential state change actions.";
+            return false;
+        }
+
+        // Add results to name for test visibility
+        name += "; Regions = " + toString(regionWorkerPool->getNumberOfThreads() + 1) + ", Sequential / Parallel Cycle Time = " + toString(sequentialCycleTime) + " / " + toString(parallelCycleTime) + " uS";
+
+        return true;
+    }
+
+    bool ParallelRegionTest::runStateMachine(ParallelRegionTestStateMachine* stateMachine, NSFTime& cycleTime, NSFString& errorMessage)
+    {
+        // Cycles are queued back to back, which would otherwise be detected as a consecutive loop
+        stateMachine->setConsecutiveLoopDetectionEnabled(false);
+        stateMachine->setLoggingEnabled(false);
+        stateMachine->startStateMachine();
+
+        if (!testHarness.doesEventResultInState(NULL, stateMachine->idleStates.front(), stateMachine->idleStates.back()))
+        {
+            errorMessage = stateMachine->getName() + " did not start properly.";
+            return false;
+        }
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int cycle = 0; cycle < numberOfCycles; ++cycle)
+        {
+            stateMachine->queueEvent(&stateMachine->event1);
+            stateMachine->queueEvent(&stateMachine->event2);
+        }
+
+        while (stateMachine->hasEvent())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        cycleTime = convertTime(endTime - startTime, TimeUnitsPerSecond, MicroSecondsPerSecond) / numberOfCycles;
+
+        // Test
+        //  event handled by any region is not processed by the composite state
+        if (!testHarness.doesEventResultInState(&stateMachine->event1, stateMachine->busyStates.front(), stateMachine->busyStates.back()))
+        {
+            errorMessage = stateMachine->getName() + " did not enter busy states.";
+            return false;
+        }
+
+        stateMachine->queueEvent(&stateMachine->event3);
+
+        while (stateMachine->hasEvent())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        if (!stateMachine->isInState(&stateMachine->workingState))
+        {
+            errorMessage = stateMachine->getName() + " did not handle event in a region.";
+            return false;
+        }
+
+        // Test
+        //  event unhandled by all regions is processed by the composite state
+        if (!testHarness.doesEventResultInState(&stateMachine->event2, stateMachine->idleStates.front(), stateMachine->idleStates.back()) ||
+            !testHarness.doesEventResultInState(&stateMachine->event3, &stateMachine->doneState))
+        {
+            errorMessage = stateMachine->getName() + " did not handle event in the composite state.";
+            return false;
+        }
+
+        stateMachine->stopStateMachine();
+
+        while (stateMachine->hasEvent())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,126 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PARALLEL_REGION_TEST_H
+#define PARALLEL_REGION_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Performs checksum work in the transition actions of one region.
+    /// </summary>
+    class ParallelRegionWorker
+    {
+    public:
+
+        ParallelRegionWorker(int workSize);
+
+        UInt32 getChecksum() const { return checksum; }
+
+        void doWork(const NSFStateMachineContext& context);
+
+    private:
+
+        UInt32 checksum;
+        int workSize;
+    };
+
+    /// <summary>
+    /// State machine with independent regions doing heavy work, and one sequenced region between them.
+    /// </summary>
+    class ParallelRegionTestStateMachine : public NSFStateMachine
+    {
+    public:
+
+        friend class ParallelRegionTest;
+
+        ParallelRegionTestStateMachine(const NSFString& name, NSFEventThread* thread, int numberOfRegions, int workSize);
+
+        ~ParallelRegionTestStateMachine();
+
+    private:
+
+        int stateChangeCount;
+
+        // Events
+        NSFEvent event1;
+        NSFEvent event2;
+        NSFEvent event3;
+
+        // Regions and states, from outer to inner
+        NSFInitialState initialState;
+        NSFCompositeState workingState;
+        NSFCompositeState doneState;
+
+        // Working regions, the sequenced region is in the middle of the independent regions
+        std::vector<ParallelRegionWorker*> workers;
+        std::vector<NSFRegion*> regions;
+        std::vector<NSFState*> states;
+        std::vector<NSFCompositeState*> idleStates;
+        std::vector<NSFCompositeState*> busyStates;
+
+        // Transitions
+        NSFExternalTransition initialToWorkingTransition;
+        NSFExternalTransition workingToDoneTransition;
+        std::vector<NSFExternalTransition*> transitions;
+        NSFInternalTransition* busy0ReactionTransition;
+
+        void countStateChange(const NSFStateMachineContext& context);
+    };
+
+    /// <summary>
+    /// Test concurrent processing of independent regions against sequential processing, and measure the speedup.
+    /// </summary>
+    class ParallelRegionTest : public ITestInterface
+    {
+    public:
+
+        ParallelRegionTest(const NSFString& name, int numberOfRegions, int workSize, int numberOfCycles);
+
+        ~ParallelRegionTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfCycles;
+        TestHarness testHarness;
+
+        NSFEventThread* eventThread;
+        NSFRegionWorkerPool* regionWorkerPool;
+        ParallelRegionTestStateMachine* sequentialStateMachine;
+        ParallelRegionTestStateMachine* parallelStateMachine;
+
+        bool runStateMachine(ParallelRegionTestStateMachine* stateMachine, NSFTime& cycleTime, NSFString& errorMessage);
+    };
+}
+
+#endif // PARALLEL_REGION_TEST_H
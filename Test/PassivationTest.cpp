@@ -0,0 +1,184 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "PassivationTest.h"
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    PassivationTestStateMachine::PassivationTestStateMachine(const NSFString& name, NSFEventThread* thread, NSFEvent* event1, NSFEvent* event2, int* stateB1EntryCount)
+        : NSFStateMachine(name, thread), stateB1EntryCount(stateB1EntryCount),
+
+        //States
+        // Region A
+        regionA("RegionA", this),
+        initialAState("InitialA", &regionA),
+        stateA1("StateA1", &regionA, NULL, NULL),
+        stateA2("StateA2", &regionA, NULL, NULL),
+
+        // Region B
+        regionB("RegionB", this),
+        initialBState("InitialB", &regionB),
+        stateB1("StateB1", &regionB, NSFAction(this, &PassivationTestStateMachine::stateB1EntryActions), NULL),
+        stateB2("StateB2", &regionB, NULL, NULL),
+
+        // ForkJoins
+        abForkJoin("ABForkJoin", this),
+
+        // Transitions, ordered internal, local, external
+        // Region A
+        initialAStateToStateA1Transition("InitialAStateToStateA1", &initialAState, &stateA1, NULL, NULL, NULL),
+        stateA1ToABForkJoinTransition("StateA1ToABForkJoin", &stateA1, &abForkJoin, event1, NULL, NULL),
+        abForkJoinToStateA2Transition("AbForkJoinToStateA2", &abForkJoin, &stateA2, NULL, NULL, NULL),
+
+        // Region B
+        initialBStateToStateB1Transition("InitialBStateToStateB1", &initialBState, &stateB1, NULL, NULL, NULL),
+        stateB1ToABForkJoinTransition("StateB1ToABForkJoin", &stateB1, &abForkJoin, event2, NULL, NULL),
+        abForkJoinToStateB2Transition("AbForkJoinToStateB2", &abForkJoin, &stateB2, NULL, NULL, NULL)
+    {
+    }
+
+    void PassivationTestStateMachine::stateB1EntryActions(const NSFStateMachineContext&)
+    {
+        ++(*stateB1EntryCount);
+    }
+
+    PassivationTest::PassivationTest(const NSFString& name)
+        : name(name.c_str()), stateB1EntryCount(0),
+        eventThread(new NSFEventThread(name)),
+        proxy(new NSFStateMachineProxy(name, eventThread, this)),
+        passivationManager(new NSFPassivationManager(name + "PassivationManager", eventThread)),
+        event1("Event1", proxy),
+        event2("Event2", proxy)
+    {
+    }
+
+    PassivationTest::~PassivationTest()
+    {
+        delete passivationManager;
+        delete proxy;
+        delete eventThread;
+    }
+
+    NSFStateMachine* PassivationTest::createStateMachine(const NSFString& name, NSFEventThread* thread)
+    {
+        return new PassivationTestStateMachine(name, thread, &event1, &event2, &stateB1EntryCount);
+    }
+
+    bool PassivationTest::runTest(NSFString& errorMessage)
+    {
+        proxy->startEventHandler();
+
+        PassivationTestStateMachine* stateMachine = (PassivationTestStateMachine*)proxy->getStateMachine();
+
+        // Test
+        //  proxy creates and starts the state machine
+        //  events queued to the proxy are forwarded to the state machine
+        //  fork join entry
+        if (!testHarness.doesEventResultInState(&event1, &stateMachine->abForkJoin, &stateMachine->stateB1))
+        {
+            errorMessage = "State Machine did not enter the fork join or did not stay in stateB1.";
+            return false;
+        }
+
+        // Test
+        //  passivation of an idle state machine
+        //  bytes saved reporting
+        if (!waitForPassivation())
+        {
+            errorMessage = "State Machine was not passivated.";
+            return false;
+        }
+
+        UInt32 configurationSize = proxy->getConfigurationSize();
+        UInt32 bytesSaved = proxy->getBytesSaved();
+
+        if ((configurationSize == 0) || (bytesSaved == 0))
+        {
+            errorMessage = "Passivated state machine did not report its configuration size and bytes saved.";
+            return false;
+        }
+
+        // Test
+        //  rehydration without entry actions
+        //  fork join progress is restored, so the second incoming transition completes the join
+        stateMachine = (PassivationTestStateMachine*)proxy->getStateMachine();
+
+        if ((proxy->getRehydrationCount() != 1) || !stateMachine->isInState(&stateMachine->abForkJoin) || (stateB1EntryCount != 1))
+        {
+            errorMessage = "State Machine was not rehydrated to its passivated configuration.";
+            return false;
+        }
+
+        if (!testHarness.doesEventResultInState(&event2, &stateMachine->stateA2, &stateMachine->stateB2))
+        {
+            errorMessage = "Rehydrated State Machine did not exit the fork join properly.";
+            return false;
+        }
+
+        // Test
+        //  eviction policy passivates idle state machines
+        passivationManager->addProxy(proxy);
+        passivationManager->setMaxIdleTime(0);
+
+        for (int i = 0; (i < 100) && (passivationManager->getPassivatedCount() == 0); ++i)
+        {
+            passivationManager->evict();
+            NSFOSThread::sleep(10);
+        }
+
+        if ((passivationManager->getPassivatedCount() != 1) || (passivationManager->getBytesSaved() == 0))
+        {
+            errorMessage = "Passivation manager did not passivate the idle State Machine.";
+            return false;
+        }
+
+        passivationManager->removeProxy(proxy);
+
+        // Add results to name for test visibility
+        name += "; Configuration / Bytes Saved = " + toString(configurationSize) + " / " + toString(bytesSaved) + " bytes";
+
+        return true;
+    }
+
+    bool PassivationTest::waitForPassivation()
+    {
+        // Passivation is skipped while the state machine still has events queued, such as its run to completion event
+        for (int i = 0; i < 100; ++i)
+        {
+            proxy->passivate();
+            NSFOSThread::sleep(10);
+
+            if (proxy->isPassivated())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
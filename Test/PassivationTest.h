@@ -0,0 +1,117 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef PASSIVATION_TEST_H
+#define PASSIVATION_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+namespace NSFTest
+{
+    /// <summary>
+    /// State machine created by the passivation test's factory.
+    /// </summary>
+    /// <remarks>
+    /// Events are owned by the test, so that they remain valid when the state machine is passivated.
+    /// </remarks>
+    class PassivationTestStateMachine : public NSFStateMachine
+    {
+    public:
+
+        friend class PassivationTest;
+
+        PassivationTestStateMachine(const NSFString& name, NSFEventThread* thread, NSFEvent* event1, NSFEvent* event2, int* stateB1EntryCount);
+
+    private:
+
+        int* stateB1EntryCount;
+
+        // Regions and states, from outer to inner
+        // Region A
+        NSFRegion regionA;
+        NSFInitialState initialAState;
+        NSFCompositeState stateA1;
+        NSFCompositeState stateA2;
+
+        // Region B
+        NSFRegion regionB;
+        NSFInitialState initialBState;
+        NSFCompositeState stateB1;
+        NSFCompositeState stateB2;
+
+        // ForkJoins
+        NSFForkJoin abForkJoin;
+
+        // Transitions, ordered internal, local, external
+        // Region A
+        NSFExternalTransition initialAStateToStateA1Transition;
+        NSFExternalTransition stateA1ToABForkJoinTransition;
+        NSFExternalTransition abForkJoinToStateA2Transition;
+
+        // Region B
+        NSFExternalTransition initialBStateToStateB1Transition;
+        NSFExternalTransition stateB1ToABForkJoinTransition;
+        NSFExternalTransition abForkJoinToStateB2Transition;
+
+        void stateB1EntryActions(const NSFStateMachineContext& context);
+    };
+
+    /// <summary>
+    /// Test passivation and rehydration of a state machine behind a proxy.
+    /// </summary>
+    class PassivationTest : public ITestInterface, public INSFStateMachineFactory
+    {
+    public:
+
+        PassivationTest(const NSFString& name);
+
+        ~PassivationTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+        NSFStateMachine* createStateMachine(const NSFString& name, NSFEventThread* thread);
+
+        UInt32 getStateMachineSize() { return sizeof(PassivationTestStateMachine); }
+
+    private:
+
+        NSFString name;
+        TestHarness testHarness;
+        int stateB1EntryCount;
+
+        NSFEventThread* eventThread;
+        NSFStateMachineProxy* proxy;
+        NSFPassivationManager* passivationManager;
+
+        // Events
+        NSFEvent event1;
+        NSFEvent event2;
+
+        bool waitForPassivation();
+    };
+}
+
+#endif // PASSIVATION_TEST_H
@@ -0,0 +1,238 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "SnapshotRestoreTest.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    SnapshotRestoreTestStateMachine::SnapshotRestoreTestStateMachine(const NSFString& name, NSFEventThread* thread, NSFEvent* event1, NSFEvent* event2, NSFEvent* event3, NSFEvent* event4, NSFEvent* event5)
+        : NSFStateMachine(name, thread), entryCount(0),
+        //States
+        initialState("Initial", this),
+        state1("State1", this, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        state2("State2", this, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        // State1 Region
+        state1InitialState("State1Initial", &state1),
+        state1History("State1History", &state1),
+        state1_1("State1_1", &state1, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        state1_2("State1_2", &state1, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        // State1_2 Region A
+        regionA("RegionA", &state1_2),
+        initialAState("InitialA", &regionA),
+        stateA1("StateA1", &regionA, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        stateA2("StateA2", &regionA, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        // State1_2 Region B
+        regionB("RegionB", &state1_2),
+        initialBState("InitialB", &regionB),
+        stateB1("StateB1", &regionB, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        stateB2("StateB2", &regionB, NSFAction(this, &SnapshotRestoreTestStateMachine::countEntry), NULL),
+        // ForkJoins
+        abForkJoin("ABForkJoin", &state1_2),
+        //Transitions
+        // SnapshotRestoreTestStateMachine Region
+        initialToState1Transition("InitialToState1", &initialState, &state1, NULL, NULL, NULL),
+        state1ToState2Transition("State1ToState2", &state1, &state2, event3, NULL, NULL),
+        state2ToState1Transition("State2ToState1", &state2, &state1, event4, NULL, NULL),
+        // State1 Region
+        state1InitialToState1HistoryTransition("State1InitialToState1History", &state1InitialState, &state1History, NULL, NULL, NULL),
+        state1HistoryToState1_1Transition("State1HistoryToState1_1", &state1History, &state1_1, NULL, NULL, NULL),
+        state1_1ToState1_2Transition("State1_1ToState1_2", &state1_1, &state1_2, event1, NULL, NULL),
+        // State1_2 Region A
+        initialAStateToStateA1Transition("InitialAStateToStateA1", &initialAState, &stateA1, NULL, NULL, NULL),
+        stateA1ToABForkJoinTransition("StateA1ToABForkJoin", &stateA1, &abForkJoin, event2, NULL, NULL),
+        abForkJoinToStateA2Transition("ABForkJoinToStateA2", &abForkJoin, &stateA2, NULL, NULL, NULL),
+        // State1_2 Region B
+        initialBStateToStateB1Transition("InitialBStateToStateB1", &initialBState, &stateB1, NULL, NULL, NULL),
+        stateB1ToABForkJoinTransition("StateB1ToABForkJoin", &stateB1, &abForkJoin, event5, NULL, NULL),
+        abForkJoinToStateB2Transition("ABForkJoinToStateB2", &abForkJoin, &stateB2, NULL, NULL, NULL)
+    {
+    }
+
+    void SnapshotRestoreTestStateMachine::countEntry(const NSFStateMachineContext&)
+    {
+        ++entryCount;
+    }
+
+    SnapshotRestoreTest::SnapshotRestoreTest(const NSFString& name, int numberOfStateMachines)
+        : name(name.c_str()), numberOfStateMachines(numberOfStateMachines),
+        eventThread(new NSFEventThread(name)),
+        event1("Event1", NULL),
+        event2("Event2", NULL),
+        event3("Event3", NULL),
+        event4("Event4", NULL),
+        event5("Event5", NULL)
+    {
+    }
+
+    SnapshotRestoreTest::~SnapshotRestoreTest()
+    {
+        delete eventThread;
+    }
+
+    bool SnapshotRestoreTest::runTest(NSFString& errorMessage)
+    {
+        SnapshotRestoreTestStateMachine original(name + "Original", eventThread, &event1, &event2, &event3, &event4, &event5);
+        original.setLoggingEnabled(false);
+        original.startStateMachine();
+
+        // Drive the original state machine into a configuration with a history substate and a partially completed fork join
+        if (!testHarness.doesEventResultInState(NULL, &original.state1_1) ||
+            !doesEventResultInState(&original, &event1, &original.state1_2) ||
+            !doesEventResultInState(&original, &event3, &original.state2) ||
+            !doesEventResultInState(&original, &event4, &original.stateB1) ||
+            !doesEventResultInState(&original, &event2, &original.abForkJoin))
+        {
+            errorMessage = "Original State Machine did not reach the configuration to snapshot.";
+            return false;
+        }
+
+        // Let run to completion finish before taking the snapshot from outside the event thread
+        while (original.hasEvent())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        std::vector<UInt8> snapshot;
+        original.saveSnapshot(snapshot);
+        original.terminate(true);
+
+        // Corrupt the run status, which follows the identifier and version, and verify the snapshot is rejected
+        std::vector<UInt8> corruptSnapshot(snapshot);
+        size_t runStatusIndex = 0;
+        while ((corruptSnapshot[runStatusIndex] & 0x80) != 0)
+        {
+            ++runStatusIndex;
+        }
+        runStatusIndex += 2;
+        corruptSnapshot[runStatusIndex] = 0x7F;
+
+        try
+        {
+            original.restoreSnapshot(corruptSnapshot);
+            errorMessage = "State Machine restored a snapshot with an invalid run status.";
+            return false;
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+
+        // Construct state machines up front, so that only restore is measured
+        std::vector<SnapshotRestoreTestStateMachine*> stateMachines;
+        for (int i = 0; i < numberOfStateMachines; ++i)
+        {
+            stateMachines.push_back(new SnapshotRestoreTestStateMachine(name + toString(i), eventThread, &event1, &event2, &event3, &event4, &event5));
+            stateMachines.back()->setLoggingEnabled(false);
+        }
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfStateMachines; ++i)
+        {
+            stateMachines[i]->restoreSnapshot(snapshot);
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        // Let the restored state machines handle their start events before verifying
+        while (stateMachines.back()->hasEvent())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        bool result = true;
+        SnapshotRestoreTestStateMachine* restored = stateMachines.front();
+
+        // Test
+        //  restored configuration is identical to the saved configuration
+        //  restore does not execute entry actions
+        std::vector<UInt8> restoredSnapshot;
+        restored->saveSnapshot(restoredSnapshot);
+
+        if ((restoredSnapshot != snapshot) || (restored->entryCount != 0))
+        {
+            errorMessage = "Restored State Machine configuration does not match the snapshot.";
+            result = false;
+        }
+
+        // Test
+        //  restored state machine is started
+        //  restored fork join completes with the remaining incoming transition
+        else if (!testHarness.doesEventResultInState(event5.copy(NULL, restored, true), &restored->stateA2, &restored->stateB2))
+        {
+            errorMessage = "Restored State Machine did not exit the fork join properly.";
+            result = false;
+        }
+
+        // Test
+        //  restored history substate
+        else if (!doesEventResultInState(restored, &event3, &restored->state2) || !doesEventResultInState(restored, &event4, &restored->state1_2))
+        {
+            errorMessage = "Restored State Machine did not re-enter its history substate.";
+            result = false;
+        }
+
+        for (int i = 0; i < numberOfStateMachines; ++i)
+        {
+            stateMachines[i]->terminate(false);
+        }
+
+        // Terminate events are handled in order, so once the last state machine has terminated, all may be safely deleted
+        stateMachines.back()->terminate(true);
+
+        for (int i = 0; i < numberOfStateMachines; ++i)
+        {
+            delete stateMachines[i];
+        }
+
+        if (result)
+        {
+            NSFTime restoreTime = convertTime(endTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfStateMachines;
+            NSFTime restoreRate = (endTime > startTime) ? ((NSFTime)numberOfStateMachines * TimeUnitsPerSecond / (endTime - startTime)) : numberOfStateMachines * TimeUnitsPerSecond;
+
+            // Add results to name for test visibility
+            name += "; Snapshot Size = " + toString(snapshot.size()) + " bytes, Restore Time = " + toString(restoreTime) + " nS, Restores / Sec = " + toString(restoreRate);
+        }
+
+        return result;
+    }
+
+    bool SnapshotRestoreTest::doesEventResultInState(NSFStateMachine* stateMachine, NSFEvent* nsfEvent, NSFState* state)
+    {
+        NSFEvent* eventCopy = nsfEvent->copy(NULL, stateMachine, true);
+
+        if (testHarness.doesEventResultInState(eventCopy, state))
+        {
+            return true;
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,135 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef SNAPSHOT_RESTORE_TEST_H
+#define SNAPSHOT_RESTORE_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+namespace NSFTest
+{
+    /// <summary>
+    /// State machine saved and restored by the snapshot restore test.
+    /// </summary>
+    /// <remarks>
+    /// Events are owned by the test, so that they are shared by all state machine instances.
+    /// </remarks>
+    class SnapshotRestoreTestStateMachine : public NSFStateMachine
+    {
+    public:
+
+        friend class SnapshotRestoreTest;
+
+        SnapshotRestoreTestStateMachine(const NSFString& name, NSFEventThread* thread, NSFEvent* event1, NSFEvent* event2, NSFEvent* event3, NSFEvent* event4, NSFEvent* event5);
+
+    private:
+
+        int entryCount;
+
+        // Regions and states, from outer to inner
+        // SnapshotRestoreTestStateMachine Region
+        NSFInitialState initialState;
+        NSFCompositeState state1;
+        NSFCompositeState state2;
+
+        // State1 Region
+        NSFInitialState state1InitialState;
+        NSFShallowHistory state1History;
+        NSFCompositeState state1_1;
+        NSFCompositeState state1_2;
+
+        // State1_2 Region A
+        NSFRegion regionA;
+        NSFInitialState initialAState;
+        NSFCompositeState stateA1;
+        NSFCompositeState stateA2;
+
+        // State1_2 Region B
+        NSFRegion regionB;
+        NSFInitialState initialBState;
+        NSFCompositeState stateB1;
+        NSFCompositeState stateB2;
+
+        // ForkJoins
+        NSFForkJoin abForkJoin;
+
+        // Transitions, ordered internal, local, external
+        // SnapshotRestoreTestStateMachine Region
+        NSFExternalTransition initialToState1Transition;
+        NSFExternalTransition state1ToState2Transition;
+        NSFExternalTransition state2ToState1Transition;
+
+        // State1 Region
+        NSFExternalTransition state1InitialToState1HistoryTransition;
+        NSFExternalTransition state1HistoryToState1_1Transition;
+        NSFExternalTransition state1_1ToState1_2Transition;
+
+        // State1_2 Region A
+        NSFExternalTransition initialAStateToStateA1Transition;
+        NSFExternalTransition stateA1ToABForkJoinTransition;
+        NSFExternalTransition abForkJoinToStateA2Transition;
+
+        // State1_2 Region B
+        NSFExternalTransition initialBStateToStateB1Transition;
+        NSFExternalTransition stateB1ToABForkJoinTransition;
+        NSFExternalTransition abForkJoinToStateB2Transition;
+
+        void countEntry(const NSFStateMachineContext& context);
+    };
+
+    /// <summary>
+    /// Test snapshot and restore of a state machine, and measure restore throughput.
+    /// </summary>
+    class SnapshotRestoreTest : public ITestInterface
+    {
+    public:
+
+        SnapshotRestoreTest(const NSFString& name, int numberOfStateMachines);
+
+        ~SnapshotRestoreTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfStateMachines;
+        TestHarness testHarness;
+
+        NSFEventThread* eventThread;
+
+        // Events
+        NSFEvent event1;
+        NSFEvent event2;
+        NSFEvent event3;
+        NSFEvent event4;
+        NSFEvent event5;
+
+        bool doesEventResultInState(NSFStateMachine* stateMachine, NSFEvent* nsfEvent, NSFState* state);
+    };
+}
+
+#endif // SNAPSHOT_RESTORE_TEST_H
@@ -0,0 +1,156 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "StateTimeoutTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    StateTimeoutTest::StateTimeoutTest(const NSFString& name)
+        : NSFStateMachine(name, new NSFEventThread(name)), changeTimeoutInStall(false),
+        timeoutEvent("TimeoutEvent", this),
+        event1("Event1", this),
+        event2("Event2", this),
+        stallEvent("StallEvent", this),
+
+        // States
+        initialState("InitialStateTimeoutTest", this),
+        stateA("StateA", this, NULL, NULL),
+        stateB("StateB", this, NULL, NULL),
+        stateC("StateC", this, NULL, NULL),
+
+        // Transitions
+        stateAReactionToStallEvent("StateAReactionToStallEvent", &stateA, &stallEvent, NULL, NSFAction(this, &StateTimeoutTest::stall)),
+        initialToStateATransition("InitialToStateA", &initialState, &stateA, NULL, NULL, NULL),
+        stateAToStateBTransition("StateAToStateB", &stateA, &stateB, &timeoutEvent, NULL, NULL),
+        stateAToStateCTransition("StateAToStateC", &stateA, &stateC, &event2, NULL, NULL),
+        stateBToStateATransition("StateBToStateA", &stateB, &stateA, &event1, NULL, NULL),
+        stateCToStateATransition("StateCToStateA", &stateC, &stateA, &event1, NULL, NULL),
+        stateCToStateBTransition("StateCToStateB", &stateC, &stateB, &timeoutEvent, NULL, NULL)
+    {
+        stateA.setTimeout(&timeoutEvent, TimeoutTime * TimeUnitsPerMilliSecond);
+    }
+
+    StateTimeoutTest::~StateTimeoutTest()
+    {
+        terminate(true);
+        delete getEventThread();
+    }
+
+    bool StateTimeoutTest::runTest(NSFString& errorMessage)
+    {
+        startStateMachine();
+
+        // Test
+        //  timeout armed on entry triggers its transition
+        if (!testHarness.doesEventResultInState(NULL, &stateB))
+        {
+            errorMessage = "State timeout did not trigger transition";
+            stopStateMachine();
+            return false;
+        }
+
+        // Test
+        //  timeout cancelled on exit does not trigger a transition from the next state
+        testHarness.doesEventResultInState(&event1, &stateA);
+
+        if (!testHarness.doesEventResultInState(&event2, &stateC))
+        {
+            errorMessage = "State machine did not transition from StateA to StateC";
+            stopStateMachine();
+            return false;
+        }
+
+        NSFOSThread::sleep(3 * TimeoutTime);
+
+        if (!stateC.isActive())
+        {
+            errorMessage = "State timeout not cancelled when state exited";
+            stopStateMachine();
+            return false;
+        }
+
+        // Test
+        //  timeout that expired while StateA was stalled, and was queued behind the event that exits StateA, is discarded
+        event1.queueEvent();
+        stallEvent.queueEvent();
+        event2.queueEvent();
+
+        NSFOSThread::sleep(4 * TimeoutTime);
+
+        if (!stateC.isActive())
+        {
+            errorMessage = "Stale state timeout not discarded";
+            stopStateMachine();
+            return false;
+        }
+
+        // Test
+        //  timeout re-armed on re-entry
+        if (!testHarness.doesEventResultInState(&event1, &stateA, &stateB))
+        {
+            errorMessage = "State timeout did not trigger transition after re-entry";
+            stopStateMachine();
+            return false;
+        }
+
+        // Test
+        //  changing the timeout while the timeout is expired and queued leaves the queued timeout to trigger its transition
+        changeTimeoutInStall = true;
+        event1.queueEvent();
+        stallEvent.queueEvent();
+
+        NSFOSThread::sleep(4 * TimeoutTime);
+
+        changeTimeoutInStall = false;
+
+        if (!stateB.isActive())
+        {
+            errorMessage = "State timeout did not trigger transition after the timeout was changed";
+            stopStateMachine();
+            return false;
+        }
+
+        stopStateMachine();
+        return true;
+    }
+
+    // Private
+
+    void StateTimeoutTest::stall(const NSFStateMachineContext&)
+    {
+        // Stall past the timeout, so that it expires and is queued behind the event that exits the state
+        NSFOSThread::sleep(2 * TimeoutTime);
+
+        if (changeTimeoutInStall)
+        {
+            stateA.setTimeout(&timeoutEvent, TimeoutTime * TimeUnitsPerMilliSecond);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef STATE_TIMEOUT_TEST_H
+#define STATE_TIMEOUT_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test state timeouts, including cancellation on exit, discarding of a timeout that expired before its state was exited,
+    /// and changing the timeout of an active state.
+    /// </summary>
+    class StateTimeoutTest : public NSFStateMachine, public ITestInterface
+    {
+    public:
+
+        StateTimeoutTest(const NSFString& name);
+
+        ~StateTimeoutTest();
+
+        const NSFString& getName() { return NSFStateMachine::getName(); }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const Int32 TimeoutTime = 50;
+
+        TestHarness testHarness;
+        bool changeTimeoutInStall;
+
+        // Events
+        NSFEvent timeoutEvent;
+        NSFEvent event1;
+        NSFEvent event2;
+        NSFEvent stallEvent;
+
+        // States
+        NSFInitialState initialState;
+        NSFCompositeState stateA;
+        NSFCompositeState stateB;
+        NSFCompositeState stateC;
+
+        // Transitions
+        NSFInternalTransition stateAReactionToStallEvent;
+        NSFExternalTransition initialToStateATransition;
+        NSFExternalTransition stateAToStateBTransition;
+        NSFExternalTransition stateAToStateCTransition;
+        NSFExternalTransition stateBToStateATransition;
+        NSFExternalTransition stateCToStateATransition;
+        NSFExternalTransition stateCToStateBTransition;
+
+        void stall(const NSFStateMachineContext& context);
+    };
+}
+
+#endif // STATE_TIMEOUT_TEST_H
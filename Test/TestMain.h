@@ -1,32 +1,54 @@
-#ifndef TEST_MAIN_H
-#define TEST_MAIN_H
-
-#include "TimerResolutionTest.h"
-#include "TimerAccuracyTest.h"
-#include "TimerGetTimeTest.h"
-#include "ContextSwitchTest.h"
-#include "BasicStateMachineTest.h"
-#include "ShallowHistoryTest.h"
-#include "DeepHistoryTest.h"
-#include "BasicForkJoinTest.h"
-#include "DeepHistoryReEntryTest.h"
-#include "StateMachineRestartTest.h"
-#include "ForkJoinToForkJoinTransitionTest.h"
-#include "MultipleTriggersOnTransitionTest.h"
-#include "ExtendedRunTest.h"
-#include "ExceptionHandlingTest.h"
-#include "StrategyTest.h"
-#include "TransitionOrderTest.h"
-#include "DocumentNavigationTest.h"
-#include "MemoryLeakTest.h"
-#include "StateMachineDeleteTest.h"
-#include "TrivialStateMachineTest.h"
-#include "ThreadCreationTest.h"
-#include "ChoiceStateTest.h"
-#include "TraceAddTest.h"
-#include "MultipleStateMachineStressTest.h"
-#include "DocumentLoadTest.h"
-#include "ContinuouslyRunningTest.h"
-#include "TimerObservedTimeGapTest.h"
-
+#ifndef TEST_MAIN_H
+#define TEST_MAIN_H
+
+#include "TimerResolutionTest.h"
+#include "TimerAccuracyTest.h"
+#include "TimerGetTimeTest.h"
+#include "ContextSwitchTest.h"
+#include "BasicStateMachineTest.h"
+#include "BroadcastEventTest.h"
+#include "DataEventMoveTest.h"
+#include "InlineDataEventTest.h"
+#include "EventLayoutTest.h"
+#include "ChromeTraceExportTest.h"
+#include "ShallowHistoryTest.h"
+#include "DeepHistoryTest.h"
+#include "BasicForkJoinTest.h"
+#include "DeepHistoryReEntryTest.h"
+#include "StateMachineRestartTest.h"
+#include "ForkJoinToForkJoinTransitionTest.h"
+#include "MultipleTriggersOnTransitionTest.h"
+#include "ExtendedRunTest.h"
+#include "ExceptionHandlingTest.h"
+#include "StrategyTest.h"
+#include "TransitionOrderTest.h"
+#include "DocumentNavigationTest.h"
+#include "MemoryLeakTest.h"
+#include "StateMachineDeleteTest.h"
+#include "TrivialStateMachineTest.h"
+#include "ThreadCreationTest.h"
+#include "ChoiceStateTest.h"
+#include "TraceAddTest.h"
+#include "TraceBinaryFileTest.h"
+#include "TraceBufferTest.h"
+#include "TraceFilterTest.h"
+#include "TraceStreamTest.h"
+#include "MultipleStateMachineStressTest.h"
+#include "NameTableTest.h"
+#include "DocumentLoadTest.h"
+#include "EventConstructionTest.h"
+#include "ContinuouslyRunningTest.h"
+#include "TimerObservedTimeGapTest.h"
+#include "PassivationTest.h"
+#include "SnapshotRestoreTest.h"
+#include "WideForkJoinTest.h"
+#include "ParallelRegionTest.h"
+#include "TimerQueueTest.h"
+#include "TimerCoalescingTest.h"
+#include "LocalTimerTest.h"
+#include "TimerExpiryStormTest.h"
+#include "TimerOverrunTest.h"
+#include "VirtualTimerTest.h"
+#include "StateTimeoutTest.h"
+
 #endif //TEST_MAIN_H
\ No newline at end of file
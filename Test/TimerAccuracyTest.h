@@ -1,64 +1,67 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef TIMER_ACCURACY_TEST_H
-#define TIMER_ACCURACY_TEST_H
-
-#include "TestHarness.h"
-#include "TestInterface.h"
-
-using namespace NorthStateFramework;
-
-namespace NSFTest
-{
-    /// <summary>
-    /// Test the accuracy of the timer.
-    /// </summary>
-    class TimerAccuracyTest :  public ITestInterface
-    {
-    public:
-
-        TimerAccuracyTest(const NSFString& name);
-
-        ~TimerAccuracyTest();
-
-        const NSFString& getName() { return name; }
-
-        bool runTest(NSFString& errorMessage);
-
-    private:
-
-        NSFString name;
-
-        NSFEventHandler eventHandler;
-        NSFEvent testEvent;
-
-        NSFTime lastTime;
-        NSFTime maxDeltaTime;
-        NSFTime minDeltaTime;
-
-        void testEventAction(const NSFEventContext& context);
-    };
-}
-
-#endif //TIMER_ACCURACY_TEST_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TIMER_ACCURACY_TEST_H
+#define TIMER_ACCURACY_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test the accuracy of the timer, and measure the jitter of a one millisecond periodic event.
+    /// </summary>
+    class TimerAccuracyTest :  public ITestInterface
+    {
+    public:
+
+        TimerAccuracyTest(const NSFString& name);
+
+        ~TimerAccuracyTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+
+        NSFEventHandler eventHandler;
+        NSFEvent testEvent;
+
+        NSFTime lastTime;
+        NSFTime maxDeltaTime;
+        NSFTime minDeltaTime;
+        NSFTime maxJitter;
+        NSFTime totalJitter;
+        NSFTime numberOfDeltas;
+
+        void testEventAction(const NSFEventContext& context);
+    };
+}
+
+#endif //TIMER_ACCURACY_TEST_H
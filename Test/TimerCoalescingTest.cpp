@@ -0,0 +1,143 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TimerCoalescingTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    // TimerCoalescingTestAction
+
+    TimerCoalescingTestAction::TimerCoalescingTestAction(const NSFString& name, NSFTimerThread* timerThread)
+        : NSFTimerAction(name), timerThread(timerThread), executionCount(0), maxLateness(0)
+    {
+    }
+
+    void TimerCoalescingTestAction::execute()
+    {
+        // Periodic actions are rescheduled before they execute, so the due time is one period before the execution time
+        NSFTime lateness = timerThread->getCurrentTime() - (getExecutionTime() - getRepeatTime());
+
+        if (lateness > maxLateness)
+        {
+            maxLateness = lateness;
+        }
+
+        ++executionCount;
+    }
+
+    // TimerCoalescingTest
+
+    TimerCoalescingTest::TimerCoalescingTest(const NSFString& name, int numberOfTimers)
+        : name(name.c_str()), numberOfTimers(numberOfTimers)
+    {
+    }
+
+    bool TimerCoalescingTest::runTest(NSFString& errorMessage)
+    {
+        NSFTime slackTime = 50 * TimeUnitsPerMilliSecond;
+        NSFTime wakeupsWithoutSlack;
+        NSFTime wakeupsWithSlack;
+        NSFTime latenessWithoutSlack;
+        NSFTime latenessWithSlack;
+
+        if (!measureWakeups(0, wakeupsWithoutSlack, latenessWithoutSlack, errorMessage) ||
+            !measureWakeups(slackTime, wakeupsWithSlack, latenessWithSlack, errorMessage))
+        {
+            return false;
+        }
+
+        if (wakeupsWithSlack >= wakeupsWithoutSlack)
+        {
+            errorMessage = "Slack time did not reduce timer thread wakeups";
+            return false;
+        }
+
+        // Add results to name for test visibility
+        name += "; Timers = " + toString(numberOfTimers) + ", Wakeups / Sec = " + toString(wakeupsWithoutSlack) + " Without Slack, "
+            + toString(wakeupsWithSlack) + " With " + toString(convertTime(slackTime, TimeUnitsPerSecond, MilliSecondsPerSecond)) + " mS Slack; Max Lateness = "
+            + toString(convertTime(latenessWithoutSlack, TimeUnitsPerSecond, MilliSecondsPerSecond)) + " / "
+            + toString(convertTime(latenessWithSlack, TimeUnitsPerSecond, MilliSecondsPerSecond)) + " mS";
+
+        return true;
+    }
+
+    bool TimerCoalescingTest::measureWakeups(NSFTime slackTime, NSFTime& wakeupsPerSecond, NSFTime& maxLateness, NSFString& errorMessage)
+    {
+        const NSFTime Period = TimeUnitsPerSecond;
+
+        NSFTimerThread* timerThread = new NSFTimerThread("TimerCoalescingTestThread", TimingWheelTimerQueue);
+        std::vector<TimerCoalescingTestAction*> actions;
+
+        // Phases are spread evenly over the period, as for keepalives started at different times
+        NSFTime startTime = timerThread->getCurrentTime() + (100 * TimeUnitsPerMilliSecond);
+        for (int i = 0; i < numberOfTimers; ++i)
+        {
+            actions.push_back(new TimerCoalescingTestAction("TimerCoalescingTestAction", timerThread));
+            actions[i]->setExecutionTime(startTime + ((Period * i) / numberOfTimers));
+            actions[i]->setRepeatTime(Period);
+            actions[i]->setSlackTime(slackTime);
+            timerThread->scheduleAction(actions[i]);
+        }
+
+        while (timerThread->getCurrentTime() < startTime)
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        UInt64 startWakeupCount = timerThread->getWakeupCount();
+        NSFTime measurementStartTime = timerThread->getCurrentTime();
+
+        NSFOSThread::sleep((Int32)convertTime(NumberOfPeriods * Period, TimeUnitsPerSecond, MilliSecondsPerSecond));
+
+        UInt64 endWakeupCount = timerThread->getWakeupCount();
+        NSFTime measurementEndTime = timerThread->getCurrentTime();
+
+        // Terminate the thread before reading the actions' statistics
+        delete timerThread;
+
+        wakeupsPerSecond = (NSFTime)(endWakeupCount - startWakeupCount) * TimeUnitsPerSecond / (measurementEndTime - measurementStartTime);
+        maxLateness = 0;
+
+        bool result = true;
+
+        for (int i = 0; i < numberOfTimers; ++i)
+        {
+            if (actions[i]->getExecutionCount() < NumberOfPeriods - 1)
+            {
+                errorMessage = "Periodic action executed " + toString(actions[i]->getExecutionCount()) + " times";
+                result = false;
+            }
+
+            if (actions[i]->getMaxLateness() > maxLateness)
+            {
+                maxLateness = actions[i]->getMaxLateness();
+            }
+
+            delete actions[i];
+        }
+
+        return result;
+    }
+}
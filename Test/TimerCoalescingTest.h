@@ -0,0 +1,82 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TIMER_COALESCING_TEST_H
+#define TIMER_COALESCING_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Periodic timer action that counts its executions and records its maximum lateness.
+    /// </summary>
+    class TimerCoalescingTestAction : public NSFTimerAction
+    {
+    public:
+
+        TimerCoalescingTestAction(const NSFString& name, NSFTimerThread* timerThread);
+
+        int getExecutionCount() const { return executionCount; }
+
+        NSFTime getMaxLateness() const { return maxLateness; }
+
+    private:
+
+        NSFTimerThread* timerThread;
+        int executionCount;
+        NSFTime maxLateness;
+
+        void execute();
+    };
+
+    /// <summary>
+    /// Measure timer thread wakeups per second for many periodic actions with evenly spread phases, with and without slack time.
+    /// </summary>
+    class TimerCoalescingTest : public ITestInterface
+    {
+    public:
+
+        TimerCoalescingTest(const NSFString& name, int numberOfTimers);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const int NumberOfPeriods = 3;
+
+        NSFString name;
+        int numberOfTimers;
+
+        bool measureWakeups(NSFTime slackTime, NSFTime& wakeupsPerSecond, NSFTime& maxLateness, NSFString& errorMessage);
+    };
+}
+
+#endif // TIMER_COALESCING_TEST_H
@@ -0,0 +1,147 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TimerExpiryStormTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    TimerExpiryStormTest::TimerExpiryStormTest(const NSFString& name, int numberOfThreads, int numberOfEvents)
+        : name(name.c_str()), numberOfThreads(numberOfThreads), numberOfEvents(numberOfEvents), handledMutex(NSFOSMutex::create()),
+        handledCount(0), lastHandledTime(0), orderError(false)
+    {
+    }
+
+    TimerExpiryStormTest::~TimerExpiryStormTest()
+    {
+        delete handledMutex;
+    }
+
+    bool TimerExpiryStormTest::runTest(NSFString& errorMessage)
+    {
+        std::vector<NSFEventThread*> eventThreads;
+        std::vector<NSFEventHandler*> eventHandlers;
+        std::vector<NSFEvent*> events;
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            eventThreads.push_back(new NSFEventThread("TimerExpiryStormTestThread"));
+            eventHandlers.push_back(new NSFEventHandler("TimerExpiryStormTestHandler", eventThreads[i]));
+            eventHandlers[i]->setLoggingEnabled(false);
+            eventHandlers[i]->startEventHandler();
+            lastHandledIndices.push_back(-1);
+        }
+
+        // Destinations are interleaved, as for timeouts started by many connections at once
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            NSFEventHandler* eventHandler = eventHandlers[i % numberOfThreads];
+
+            events.push_back(new NSFEvent("TimerExpiryStormTestEvent", eventHandler));
+            eventHandler->addEventReaction(events[i], NSFAction(this, &TimerExpiryStormTest::handleEvent));
+            eventIndices[events[i]] = i;
+        }
+
+        NSFTime expiryTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (200 * TimeUnitsPerMilliSecond);
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            events[i]->scheduleAbsoluteExecution(expiryTime);
+        }
+
+        NSFTime timeout = expiryTime + (30 * TimeUnitsPerSecond);
+        bool completed = false;
+
+        while (!completed && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            NSFOSThread::sleep(1);
+
+            LOCK(handledMutex)
+            {
+                completed = (handledCount == numberOfEvents);
+            }
+            ENDLOCK;
+        }
+
+        for (int i = 0; i < numberOfEvents; ++i)
+        {
+            delete events[i];
+        }
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            delete eventHandlers[i];
+            delete eventThreads[i];
+        }
+
+        if (!completed)
+        {
+            errorMessage = "Only " + toString(handledCount) + " of " + toString(numberOfEvents) + " expired events handled";
+            return false;
+        }
+
+        if (orderError)
+        {
+            errorMessage = "Expired events not handled in scheduled order";
+            return false;
+        }
+
+        NSFTime deliveryTime = lastHandledTime - expiryTime;
+
+        if (deliveryTime <= 0)
+        {
+            deliveryTime = 1;
+        }
+
+        // Add results to name for test visibility
+        name += "; Threads = " + toString(numberOfThreads) + ", Events = " + toString(numberOfEvents) + ", Delivery Time = "
+            + toString(convertTime(deliveryTime, TimeUnitsPerSecond, MicroSecondsPerSecond)) + " uS, Events / Sec = "
+            + toString((NSFTime)numberOfEvents * TimeUnitsPerSecond / deliveryTime);
+
+        return true;
+    }
+
+    // Private
+
+    void TimerExpiryStormTest::handleEvent(const NSFEventContext& context)
+    {
+        // Each destination has its own thread, so its last handled index is only accessed from that thread
+        int index = eventIndices.find(context.getEvent())->second;
+        int& lastHandledIndex = lastHandledIndices[index % numberOfThreads];
+
+        if (index < lastHandledIndex)
+        {
+            orderError = true;
+        }
+
+        lastHandledIndex = index;
+
+        LOCK(handledMutex)
+        {
+            ++handledCount;
+            lastHandledTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+        }
+        ENDLOCK;
+    }
+}
@@ -0,0 +1,69 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TIMER_EXPIRY_STORM_TEST_H
+#define TIMER_EXPIRY_STORM_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <map>
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Measure the delivery rate of many scheduled events expiring at the same time, spread over several event threads,
+    /// and verify that each destination receives its events in scheduled order.
+    /// </summary>
+    class TimerExpiryStormTest : public ITestInterface
+    {
+    public:
+
+        TimerExpiryStormTest(const NSFString& name, int numberOfThreads, int numberOfEvents);
+
+        ~TimerExpiryStormTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfThreads;
+        int numberOfEvents;
+        NSFOSMutex* handledMutex;
+        int handledCount;
+        NSFTime lastHandledTime;
+        bool orderError;
+        std::map<NSFEvent*, int> eventIndices;
+        std::vector<int> lastHandledIndices;
+
+        void handleEvent(const NSFEventContext& context);
+    };
+}
+
+#endif // TIMER_EXPIRY_STORM_TEST_H
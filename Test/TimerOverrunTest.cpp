@@ -0,0 +1,152 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TimerOverrunTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    // TimerOverrunTestAction
+
+    TimerOverrunTestAction::TimerOverrunTestAction(const NSFString& name, NSFTimerThread* timerThread)
+        : NSFTimerAction(name), timerThread(timerThread), burstCount(0), executionCount(0), lastExecutionTime(0)
+    {
+    }
+
+    void TimerOverrunTestAction::execute()
+    {
+        NSFTime currentTime = timerThread->getCurrentTime();
+
+        if ((executionCount > 0) && ((currentTime - lastExecutionTime) < (getRepeatTime() / 2)))
+        {
+            ++burstCount;
+        }
+
+        lastExecutionTime = currentTime;
+        ++executionCount;
+    }
+
+    // TimerOverrunTestStallAction
+
+    TimerOverrunTestStallAction::TimerOverrunTestStallAction(const NSFString& name, Int32 stallTime)
+        : NSFTimerAction(name), stallTime(stallTime)
+    {
+    }
+
+    void TimerOverrunTestStallAction::execute()
+    {
+        NSFOSThread::sleep(stallTime);
+    }
+
+    // TimerOverrunTest
+
+    const Int32 TimerOverrunTest::Period;
+    const Int32 TimerOverrunTest::StallTime;
+    const Int32 TimerOverrunTest::RunTime;
+
+    TimerOverrunTest::TimerOverrunTest(const NSFString& name)
+        : name(name.c_str())
+    {
+    }
+
+    bool TimerOverrunTest::runTest(NSFString& errorMessage)
+    {
+        NSFString listResult;
+        NSFString wheelResult;
+        NSFString heapResult;
+
+        if (!testQueueType(SortedListTimerQueue, listResult, errorMessage) ||
+            !testQueueType(TimingWheelTimerQueue, wheelResult, errorMessage) ||
+            !testQueueType(IndexedHeapTimerQueue, heapResult, errorMessage))
+        {
+            return false;
+        }
+
+        // Add results to name for test visibility
+        name += "; Executions / Overruns / Bursts After " + toString(StallTime) + " mS Stall: List " + listResult + "; Wheel " + wheelResult + "; Heap " + heapResult;
+
+        return true;
+    }
+
+    // Private
+
+    bool TimerOverrunTest::testQueueType(NSFTimerQueueType queueType, NSFString& result, NSFString& errorMessage)
+    {
+        const int MinimumMissedPeriods = (StallTime / Period) / 2;
+
+        NSFTimerThread* timerThread = new NSFTimerThread("TimerOverrunTestThread", queueType);
+        TimerOverrunTestAction catchUpAction("CatchUpAction", timerThread);
+        TimerOverrunTestAction skipAction("SkipAction", timerThread);
+        TimerOverrunTestAction realignAction("RealignAction", timerThread);
+        TimerOverrunTestStallAction stallAction("StallAction", StallTime);
+
+        catchUpAction.setOverrunPolicy(CatchUpOverrunPolicy);
+        skipAction.setOverrunPolicy(SkipOverrunPolicy);
+        realignAction.setOverrunPolicy(RealignOverrunPolicy);
+
+        NSFTime period = Period * TimeUnitsPerMilliSecond;
+
+        timerThread->scheduleAction(&catchUpAction, period, period);
+        timerThread->scheduleAction(&skipAction, period, period);
+        timerThread->scheduleAction(&realignAction, period, period);
+        // Stall the timer thread between periods, well after the actions are running
+        timerThread->scheduleAction(&stallAction, (5 * period) + (period / 2), 0);
+
+        NSFOSThread::sleep(RunTime);
+
+        // Terminate the thread before reading the actions' statistics
+        delete timerThread;
+
+        int expectedExecutions = RunTime / Period;
+
+        result = toString(catchUpAction.getExecutionCount()) + " / " + toString(catchUpAction.getOverrunCount()) + " / " + toString(catchUpAction.getBurstCount()) + " Catch Up, "
+            + toString(skipAction.getExecutionCount()) + " / " + toString(skipAction.getOverrunCount()) + " / " + toString(skipAction.getBurstCount()) + " Skip, "
+            + toString(realignAction.getExecutionCount()) + " / " + toString(realignAction.getOverrunCount()) + " / " + toString(realignAction.getBurstCount()) + " Realign";
+
+        // Catching up executes every period, including those missed during the stall, back to back
+        if ((catchUpAction.getOverrunCount() < (UInt32)MinimumMissedPeriods) || (catchUpAction.getBurstCount() < MinimumMissedPeriods) ||
+            (catchUpAction.getExecutionCount() < expectedExecutions - MinimumMissedPeriods))
+        {
+            errorMessage = "Catch up overrun policy did not execute missed periods: " + result;
+            return false;
+        }
+
+        // Skipping and realigning drop the missed periods, executing once when the stall ends
+        if ((skipAction.getOverrunCount() < (UInt32)MinimumMissedPeriods) || (skipAction.getBurstCount() > 2) ||
+            (skipAction.getExecutionCount() > catchUpAction.getExecutionCount() - MinimumMissedPeriods))
+        {
+            errorMessage = "Skip overrun policy did not skip missed periods: " + result;
+            return false;
+        }
+
+        if ((realignAction.getOverrunCount() < (UInt32)MinimumMissedPeriods) || (realignAction.getBurstCount() > 2) ||
+            (realignAction.getExecutionCount() > catchUpAction.getExecutionCount() - MinimumMissedPeriods))
+        {
+            errorMessage = "Realign overrun policy did not skip missed periods: " + result;
+            return false;
+        }
+
+        return true;
+    }
+}
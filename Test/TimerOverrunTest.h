@@ -0,0 +1,98 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TIMER_OVERRUN_TEST_H
+#define TIMER_OVERRUN_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Periodic timer action that counts its executions, and the executions that follow the previous one by less than half a period.
+    /// </summary>
+    class TimerOverrunTestAction : public NSFTimerAction
+    {
+    public:
+
+        TimerOverrunTestAction(const NSFString& name, NSFTimerThread* timerThread);
+
+        int getBurstCount() const { return burstCount; }
+
+        int getExecutionCount() const { return executionCount; }
+
+    private:
+
+        NSFTimerThread* timerThread;
+        int burstCount;
+        int executionCount;
+        NSFTime lastExecutionTime;
+
+        void execute();
+    };
+
+    /// <summary>
+    /// Timer action that stalls its timer thread.
+    /// </summary>
+    class TimerOverrunTestStallAction : public NSFTimerAction
+    {
+    public:
+
+        TimerOverrunTestStallAction(const NSFString& name, Int32 stallTime);
+
+    private:
+
+        Int32 stallTime;
+
+        void execute();
+    };
+
+    /// <summary>
+    /// Stall a timer thread and verify the executions of periodic actions with each overrun policy.
+    /// </summary>
+    class TimerOverrunTest : public ITestInterface
+    {
+    public:
+
+        TimerOverrunTest(const NSFString& name);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const Int32 Period = 10;
+        static const Int32 StallTime = 200;
+        static const Int32 RunTime = 500;
+
+        NSFString name;
+
+        bool testQueueType(NSFTimerQueueType queueType, NSFString& result, NSFString& errorMessage);
+    };
+}
+
+#endif // TIMER_OVERRUN_TEST_H
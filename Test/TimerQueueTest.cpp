@@ -0,0 +1,352 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TimerQueueTest.h"
+
+#include "NSFTimerWheel.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    // TimerQueueTestAction
+
+    TimerQueueTestAction::TimerQueueTestAction(const NSFString& name, int index, std::vector<TimerQueueTestAction*>* executedActions, NSFOSMutex* executedActionsMutex)
+        : NSFTimerAction(name), index(index), executedActions(executedActions), executedActionsMutex(executedActionsMutex)
+    {
+    }
+
+    void TimerQueueTestAction::execute()
+    {
+        LOCK(executedActionsMutex)
+        {
+            executedActions->push_back(this);
+        }
+        ENDLOCK;
+    }
+
+    // TimerQueueTest
+
+    TimerQueueTest::TimerQueueTest(const NSFString& name, int maxNumberOfTimers)
+        : name(name.c_str()), maxNumberOfTimers(maxNumberOfTimers), executedActionsMutex(NSFOSMutex::create())
+    {
+    }
+
+    TimerQueueTest::~TimerQueueTest()
+    {
+        delete executedActionsMutex;
+    }
+
+    bool TimerQueueTest::runTest(NSFString& errorMessage)
+    {
+        if (!testExecutionOrder(SortedListTimerQueue, errorMessage) || !testExecutionOrder(TimingWheelTimerQueue, errorMessage) ||
+            !testExecutionOrder(IndexedHeapTimerQueue, errorMessage) || !testFarFutureActions(SortedListTimerQueue, errorMessage) ||
+            !testFarFutureActions(TimingWheelTimerQueue, errorMessage) || !testFarFutureActions(IndexedHeapTimerQueue, errorMessage))
+        {
+            return false;
+        }
+
+        // Add results to name for test visibility
+        name += "; Schedule / Unschedule Time";
+
+        for (int numberOfTimers = 1000; numberOfTimers <= maxNumberOfTimers; numberOfTimers *= 10)
+        {
+            name += ((numberOfTimers == 1000) ? " = " : "; ") + toString(numberOfTimers) + " Timers:";
+
+            if (numberOfTimers <= 10000)
+            {
+                name += " List " + measureScheduling(SortedListTimerQueue, numberOfTimers) + ",";
+            }
+
+            name += " Wheel " + measureScheduling(TimingWheelTimerQueue, numberOfTimers) + ",";
+            name += " Heap " + measureScheduling(IndexedHeapTimerQueue, numberOfTimers) + " nS";
+        }
+
+        return true;
+    }
+
+    NSFString TimerQueueTest::measureScheduling(NSFTimerQueueType queueType, int numberOfTimers)
+    {
+        NSFTimerThread* timerThread = new NSFTimerThread("TimerQueueTestThread", queueType);
+        std::vector<TimerQueueTestAction*> actions;
+        std::vector<NSFTime> delayTimes;
+
+        // Delays are spread over an hour, so that the timing wheel uses all of its levels
+        UInt32 random = 12345;
+        for (int i = 0; i < numberOfTimers; ++i)
+        {
+            actions.push_back(new TimerQueueTestAction("TimerQueueTestAction", i, &executedActions, executedActionsMutex));
+
+            random = (random * 1103515245) + 12345;
+            delayTimes.push_back((10000 + ((random >> 8) % 3600000)) * TimeUnitsPerMilliSecond);
+        }
+
+        // Repeat small counts so that the measured time is well above the timer resolution
+        int numberOfRounds = (numberOfTimers < 100000) ? (100000 / numberOfTimers) : 1;
+        NSFTime scheduleTime = 0;
+        NSFTime unscheduleTime = 0;
+
+        for (int round = 0; round < numberOfRounds; ++round)
+        {
+            NSFTime startTime = timerThread->getCurrentTime();
+
+            for (int i = 0; i < numberOfTimers; ++i)
+            {
+                timerThread->scheduleAction(actions[i], delayTimes[i], 0);
+            }
+
+            NSFTime scheduleEndTime = timerThread->getCurrentTime();
+
+            // Unschedule in a different order than scheduled
+            for (int i = numberOfTimers - 1; i >= 0; --i)
+            {
+                timerThread->unscheduleAction(actions[i]);
+            }
+
+            NSFTime unscheduleEndTime = timerThread->getCurrentTime();
+
+            scheduleTime += scheduleEndTime - startTime;
+            unscheduleTime += unscheduleEndTime - scheduleEndTime;
+        }
+
+        delete timerThread;
+
+        for (int i = 0; i < numberOfTimers; ++i)
+        {
+            delete actions[i];
+        }
+
+        NSFTime numberOfOperations = (NSFTime)numberOfTimers * numberOfRounds;
+
+        return toString(convertTime(scheduleTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfOperations) + " / "
+            + toString(convertTime(unscheduleTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfOperations);
+    }
+
+    bool TimerQueueTest::testExecutionOrder(NSFTimerQueueType queueType, NSFString& errorMessage)
+    {
+        const int NumberOfActions = 600;
+        const int NumberOfTimes = 6;
+        const NSFTime TimeSpacing = 100 * TimeUnitsPerMilliSecond;
+
+        NSFString queueName = (queueType == SortedListTimerQueue) ? "Sorted list" : ((queueType == TimingWheelTimerQueue) ? "Timing wheel" : "Indexed heap");
+
+        // Start with the default queue type, and switch part way through scheduling to test moving actions between queues
+        NSFTimerThread* timerThread = new NSFTimerThread("TimerQueueTestThread");
+        std::vector<TimerQueueTestAction*> actions;
+
+        LOCK(executedActionsMutex)
+        {
+            executedActions.clear();
+        }
+        ENDLOCK;
+
+        // Groups of actions have equal execution times, spanning several lowest level timing wheel slots
+        NSFTime baseTime = timerThread->getCurrentTime() + (50 * TimeUnitsPerMilliSecond);
+        for (int i = 0; i < NumberOfActions; ++i)
+        {
+            if (i == NumberOfActions / 2)
+            {
+                timerThread->setTimerQueueType(queueType);
+            }
+
+            actions.push_back(new TimerQueueTestAction("TimerQueueTestAction", i, &executedActions, executedActionsMutex));
+            actions[i]->setExecutionTime(baseTime + ((i % NumberOfTimes) * TimeSpacing));
+            timerThread->scheduleAction(actions[i]);
+        }
+
+        // A periodic action records its executions separately
+        std::vector<TimerQueueTestAction*> periodicExecutions;
+        TimerQueueTestAction periodicAction("TimerQueueTestPeriodicAction", -1, &periodicExecutions, executedActionsMutex);
+        periodicAction.setExecutionTime(baseTime);
+        periodicAction.setRepeatTime(TimeSpacing);
+        timerThread->scheduleAction(&periodicAction);
+
+        // Unschedule every fifth action
+        bool scheduledCorrectly = true;
+        for (int i = 0; i < NumberOfActions; ++i)
+        {
+            if ((i % 5) == 0)
+            {
+                timerThread->unscheduleAction(actions[i]);
+                scheduledCorrectly &= !timerThread->isScheduled(actions[i]);
+            }
+            else
+            {
+                scheduledCorrectly &= timerThread->isScheduled(actions[i]);
+            }
+        }
+
+        int expectedExecutions = NumberOfActions - (NumberOfActions / 5);
+        NSFTime timeoutTime = baseTime + (NumberOfTimes * TimeSpacing) + (2000 * TimeUnitsPerMilliSecond);
+        size_t numberOfExecutions = 0;
+
+        while (timerThread->getCurrentTime() < timeoutTime)
+        {
+            LOCK(executedActionsMutex)
+            {
+                numberOfExecutions = executedActions.size();
+            }
+            ENDLOCK;
+
+            if (numberOfExecutions >= (size_t)expectedExecutions)
+            {
+                break;
+            }
+
+            NSFOSThread::sleep(10);
+        }
+
+        timerThread->unscheduleAction(&periodicAction);
+        scheduledCorrectly &= !timerThread->isScheduled(&periodicAction);
+
+        size_t numberOfPeriodicExecutions = 0;
+        LOCK(executedActionsMutex)
+        {
+            numberOfPeriodicExecutions = periodicExecutions.size();
+        }
+        ENDLOCK;
+
+        bool result = true;
+
+        if (!scheduledCorrectly)
+        {
+            errorMessage = queueName + " queue reported incorrect scheduled status";
+            result = false;
+        }
+        else if (numberOfExecutions != (size_t)expectedExecutions)
+        {
+            errorMessage = queueName + " queue executed " + toString(numberOfExecutions) + " of " + toString(expectedExecutions) + " actions";
+            result = false;
+        }
+        else if (numberOfPeriodicExecutions < (size_t)NumberOfTimes)
+        {
+            errorMessage = queueName + " queue executed periodic action " + toString(numberOfPeriodicExecutions) + " times";
+            result = false;
+        }
+        else
+        {
+            // Actions must execute in order of execution time, and in FIFO order for equal execution times
+            LOCK(executedActionsMutex)
+            {
+                for (size_t i = 0; i < executedActions.size(); ++i)
+                {
+                    TimerQueueTestAction* action = executedActions[i];
+
+                    if ((action->getIndex() % 5) == 0)
+                    {
+                        errorMessage = queueName + " queue executed an unscheduled action";
+                        result = false;
+                        break;
+                    }
+
+                    if (i == 0)
+                    {
+                        continue;
+                    }
+
+                    TimerQueueTestAction* previousAction = executedActions[i - 1];
+
+                    if ((action->getExecutionTime() < previousAction->getExecutionTime()) ||
+                        ((action->getExecutionTime() == previousAction->getExecutionTime()) && (action->getIndex() < previousAction->getIndex())))
+                    {
+                        errorMessage = queueName + " queue executed actions out of order";
+                        result = false;
+                        break;
+                    }
+                }
+            }
+            ENDLOCK;
+        }
+
+        delete timerThread;
+
+        for (int i = 0; i < NumberOfActions; ++i)
+        {
+            delete actions[i];
+        }
+
+        return result;
+    }
+
+    bool TimerQueueTest::testFarFutureActions(NSFTimerQueueType queueType, NSFString& errorMessage)
+    {
+        const int NumberOfActions = 3;
+
+        NSFString queueName = (queueType == SortedListTimerQueue) ? "Sorted list" : ((queueType == TimingWheelTimerQueue) ? "Timing wheel" : "Indexed heap");
+
+        NSFVirtualTimer* virtualTimer = new NSFVirtualTimer("TimerQueueTestTimer", 0);
+        NSFTimerThread* timerThread = new NSFTimerThread("TimerQueueTestThread", queueType, virtualTimer);
+        std::vector<TimerQueueTestAction*> actions;
+
+        LOCK(executedActionsMutex)
+        {
+            executedActions.clear();
+        }
+        ENDLOCK;
+
+        // Several actions beyond the timing wheel's span stay in its overflow list as the wheel completes revolutions
+        for (int i = 0; i < NumberOfActions; ++i)
+        {
+            actions.push_back(new TimerQueueTestAction("TimerQueueTestAction", i, &executedActions, executedActionsMutex));
+            timerThread->scheduleAction(actions[i], ((NSFTime)(i + 2) * NSFTimerWheel::WheelSpan) + i + 1, 0);
+        }
+
+        bool result = true;
+
+        try
+        {
+            virtualTimer->advanceTime((NumberOfActions + 2) * NSFTimerWheel::WheelSpan);
+        }
+        catch(const std::exception& exception)
+        {
+            errorMessage = queueName + " queue: " + exception.what();
+            result = false;
+        }
+
+        if (result)
+        {
+            LOCK(executedActionsMutex)
+            {
+                for (int i = 0; result && (i < NumberOfActions); ++i)
+                {
+                    if ((executedActions.size() != (size_t)NumberOfActions) || (executedActions[i] != actions[i]) ||
+                        (actions[i]->getExecutionTime() != ((NSFTime)(i + 2) * NSFTimerWheel::WheelSpan) + i + 1))
+                    {
+                        errorMessage = queueName + " queue did not execute actions beyond the timing wheel span at their scheduled times";
+                        result = false;
+                    }
+                }
+            }
+            ENDLOCK;
+        }
+
+        delete timerThread;
+
+        for (int i = 0; i < NumberOfActions; ++i)
+        {
+            delete actions[i];
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,89 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TIMER_QUEUE_TEST_H
+#define TIMER_QUEUE_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Timer action that records its executions.
+    /// </summary>
+    class TimerQueueTestAction : public NSFTimerAction
+    {
+    public:
+
+        TimerQueueTestAction(const NSFString& name, int index, std::vector<TimerQueueTestAction*>* executedActions, NSFOSMutex* executedActionsMutex);
+
+        int getIndex() const { return index; }
+
+    private:
+
+        int index;
+        std::vector<TimerQueueTestAction*>* executedActions;
+        NSFOSMutex* executedActionsMutex;
+
+        void execute();
+    };
+
+    /// <summary>
+    /// Test execution order of each timer queue type, and measure schedule and unschedule times for 1k to 1M outstanding timers.
+    /// </summary>
+    /// <remarks>
+    /// The sorted list queue is only measured up to 10k timers, as its linear scheduling time makes larger counts impractical.
+    /// </remarks>
+    class TimerQueueTest : public ITestInterface
+    {
+    public:
+
+        TimerQueueTest(const NSFString& name, int maxNumberOfTimers);
+
+        ~TimerQueueTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int maxNumberOfTimers;
+        std::vector<TimerQueueTestAction*> executedActions;
+        NSFOSMutex* executedActionsMutex;
+
+        NSFString measureScheduling(NSFTimerQueueType queueType, int numberOfTimers);
+
+        bool testExecutionOrder(NSFTimerQueueType queueType, NSFString& errorMessage);
+
+        bool testFarFutureActions(NSFTimerQueueType queueType, NSFString& errorMessage);
+    };
+}
+
+#endif // TIMER_QUEUE_TEST_H
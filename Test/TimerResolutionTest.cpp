@@ -1,70 +1,122 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "TimerResolutionTest.h"
-#include <limits.h>
-
-
-namespace NSFTest
-{
-    TimerResolutionTest::TimerResolutionTest(const NSFString& name)
-        : name(name.c_str())
-    {
-    }
-
-    bool TimerResolutionTest::runTest(NSFString&)
-    {
-        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
-        NSFTime lastTime = startTime;
-        NSFTime maxDeltaTime = 0;
-        NSFTime minDeltaTime = LONG_MAX;
-
-        while(true)
-        {
-            NSFTime currentTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
-
-            if (currentTime != lastTime)
-            {
-                NSFTime deltaTime = currentTime - lastTime;
-
-                // Record max and min observed delta times
-                if (deltaTime > maxDeltaTime) { maxDeltaTime = deltaTime; }
-                if (deltaTime < minDeltaTime) { minDeltaTime = deltaTime; }
-            }
-
-            // Record current time as last time through loop
-            lastTime = currentTime;
-
-            // End after 1000 mS
-            if (currentTime > startTime + 1000)
-            {
-                break;
-            }
-        }
-
-        // Add results to name for test visibility
-        name += "; Min / Max Delta Time = " + toString(minDeltaTime) + " / " + toString(maxDeltaTime) + " mS";
-
-        return true;
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TimerResolutionTest.h"
+#include <algorithm>
+#include <limits.h>
+#include <vector>
+
+
+namespace NSFTest
+{
+    TimerResolutionTest::TimerResolutionTest(const NSFString& name)
+        : name(name.c_str())
+    {
+    }
+
+    bool TimerResolutionTest::runTest(NSFString& errorMessage)
+    {
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+        NSFTime lastTime = startTime;
+        NSFTime maxDeltaTime = 0;
+        NSFTime minDeltaTime = LONG_MAX;
+
+        while(true)
+        {
+            NSFTime currentTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+            if (currentTime != lastTime)
+            {
+                NSFTime deltaTime = currentTime - lastTime;
+
+                // Record max and min observed delta times
+                if (deltaTime > maxDeltaTime) { maxDeltaTime = deltaTime; }
+                if (deltaTime < minDeltaTime) { minDeltaTime = deltaTime; }
+            }
+
+            // Record current time as last time through loop
+            lastTime = currentTime;
+
+            // End after 1000 mS
+            if (currentTime > startTime + TimeUnitsPerSecond)
+            {
+                break;
+            }
+        }
+
+        // Add results to name for test visibility
+        name += "; Min / Max Delta Time = " + toString(convertTime(minDeltaTime, TimeUnitsPerSecond, MicroSecondsPerSecond)) + " / "
+            + toString(convertTime(maxDeltaTime, TimeUnitsPerSecond, MicroSecondsPerSecond)) + " uS";
+
+        // Measure the lateness of short delays, 250 uS or the shortest delay the time units allow, with each type of operating system timer
+        NSFTime delayTime = (TimeUnitsPerMilliSecond / 4 > 0) ? (TimeUnitsPerMilliSecond / 4) : 1;
+        NSFString relativeWaitLateness;
+        NSFString absoluteDeadlineLateness;
+
+        if (!measureLateness(RelativeWaitOSTimer, delayTime, relativeWaitLateness, errorMessage) ||
+            !measureLateness(AbsoluteDeadlineOSTimer, delayTime, absoluteDeadlineLateness, errorMessage))
+        {
+            return false;
+        }
+
+        name += "; Delay = " + toString(convertTime(delayTime, TimeUnitsPerSecond, MicroSecondsPerSecond)) + " uS, 50th / 99th / Max Lateness: Relative Wait = "
+            + relativeWaitLateness + ", Absolute Deadline = " + absoluteDeadlineLateness + " uS";
+
+        return true;
+    }
+
+    bool TimerResolutionTest::measureLateness(NSFOSTimerType timerType, NSFTime delayTime, NSFString& result, NSFString& errorMessage)
+    {
+        NSFTimerThread* timerThread = new NSFTimerThread("TimerResolutionTestThread", SortedListTimerQueue, timerType);
+        NSFOSSignal* delaySignal = NSFOSSignal::create("TimerResolutionTestSignal");
+        std::vector<NSFTime> latenesses;
+
+        for (int i = 0; i < NumberOfDelays; ++i)
+        {
+            NSFTime scheduleTime = timerThread->getCurrentTime();
+
+            timerThread->scheduleAction(delaySignal, delayTime, 0);
+
+            if (!delaySignal->wait(1000))
+            {
+                delete timerThread;
+                delete delaySignal;
+                errorMessage = "Delay signal not sent";
+                return false;
+            }
+
+            latenesses.push_back(timerThread->getCurrentTime() - scheduleTime - delayTime);
+        }
+
+        delete timerThread;
+        delete delaySignal;
+
+        std::sort(latenesses.begin(), latenesses.end());
+
+        result = toString(convertTime(latenesses[NumberOfDelays / 2], TimeUnitsPerSecond, MicroSecondsPerSecond)) + " / "
+            + toString(convertTime(latenesses[(NumberOfDelays * 99) / 100], TimeUnitsPerSecond, MicroSecondsPerSecond)) + " / "
+            + toString(convertTime(latenesses.back(), TimeUnitsPerSecond, MicroSecondsPerSecond));
+
+        return true;
+    }
+}
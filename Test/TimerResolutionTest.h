@@ -1,53 +1,65 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#ifndef TIMER_RESOLUTION_TEST_H
-#define TIMER_RESOLUTION_TEST_H
-
-#include "TestHarness.h"
-#include "TestInterface.h"
-
-using namespace NorthStateFramework;
-
-namespace NSFTest
-{
-    /// <summary>
-    /// Test the resolution of the timer
-    /// </summary>
-    class TimerResolutionTest :  public ITestInterface
-    {
-    public:
-
-        TimerResolutionTest(const NSFString& name);
-
-        const NSFString& getName() { return name; }
-
-        bool runTest(NSFString& errorMessage);
-
-    private:
-
-        NSFString name;
-    };
-}
-
-#endif //TIMER_RESOLUTION_TEST_H
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TIMER_RESOLUTION_TEST_H
+#define TIMER_RESOLUTION_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test the resolution of the timer, and measure the lateness of short timer delays with each type of operating system timer.
+    /// </summary>
+    class TimerResolutionTest :  public ITestInterface
+    {
+    public:
+
+        TimerResolutionTest(const NSFString& name);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const int NumberOfDelays = 1000;
+
+        NSFString name;
+
+        /// <summary>
+        /// Measures the lateness of repeated short delays on a timer thread with the specified type of operating system timer.
+        /// </summary>
+        /// <param name="timerType">The type of operating system timer.</param>
+        /// <param name="delayTime">The delay to measure.</param>
+        /// <param name="result">The 50th percentile, 99th percentile, and maximum lateness, in micro-seconds.</param>
+        /// <param name="errorMessage">The error message if a delay did not complete.</param>
+        /// <returns>True if every delay completed, otherwise false.</returns>
+        bool measureLateness(NSFOSTimerType timerType, NSFTime delayTime, NSFString& result, NSFString& errorMessage);
+    };
+}
+
+#endif //TIMER_RESOLUTION_TEST_H
@@ -1,66 +1,66 @@
-// MIT License
-
-// North State Framework
-// Copyright (c) 2004-2022 North State Software, LLC
-
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-
-#include "TraceAddTest.h"
-
-using namespace NorthStateFramework;
-
-namespace NSFTest
-{
-#if (defined WIN32) || (defined WINCE)
-    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
-#pragma warning( disable : 4355 )
-#endif
-
-    TraceAddTest::TraceAddTest(const NSFString& name, int numberOfTraces)
-        : name(name.c_str()), numberOfTraces(numberOfTraces)
-    {
-    }
-
-    bool TraceAddTest::runTest(NSFString&)
-    {
-        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
-
-        for (int i = 0; i < numberOfTraces; ++i)
-        {
-            NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::SourceTag(), name);
-        }
-
-        NSFTime addEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
-
-        while (!NSFTraceLog::getPrimaryTraceLog().allTracesLogged())
-        {
-            NSFOSThread::sleep(1);
-        }
-
-        NSFTime logEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
-
-        NSFTime addTime = ((addEndTime - startTime) * 1000) / numberOfTraces;
-        NSFTime logTime = ((logEndTime - startTime) * 1000) / numberOfTraces;
-
-        // Add results to name for test visibility
-        name += "; Add / Log Time = " + toString(addTime) + " / " + toString(logTime) + " uS";
-
-        return true;
-    }
-}
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TraceAddTest.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    TraceAddTest::TraceAddTest(const NSFString& name, int numberOfTraces)
+        : name(name.c_str()), numberOfTraces(numberOfTraces)
+    {
+    }
+
+    bool TraceAddTest::runTest(NSFString&)
+    {
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfTraces; ++i)
+        {
+            NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::SourceTag(), name);
+        }
+
+        NSFTime addEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        while (!NSFTraceLog::getPrimaryTraceLog().allTracesLogged())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        NSFTime logEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        NSFTime addTime = convertTime(addEndTime - startTime, TimeUnitsPerSecond, MicroSecondsPerSecond) / numberOfTraces;
+        NSFTime logTime = convertTime(logEndTime - startTime, TimeUnitsPerSecond, MicroSecondsPerSecond) / numberOfTraces;
+
+        // Add results to name for test visibility
+        name += "; Add / Log Time = " + toString(addTime) + " / " + toString(logTime) + " uS";
+
+        return true;
+    }
+}
@@ -0,0 +1,226 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TraceBinaryFileTest.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    TraceBinaryFileTest::TraceBinaryFileTest(const NSFString& name, int numberOfTraces)
+        : name(name.c_str()), numberOfTraces(numberOfTraces)
+    {
+    }
+
+    bool TraceBinaryFileTest::runTest(NSFString& errorMessage)
+    {
+        // Traces similar to those recorded by a running state machine
+        NSFTraceBinaryFile traceFile;
+
+        for (int i = 0; i < numberOfTraces; ++i)
+        {
+            NSFTime time = 1000000 + (i * 3);
+
+            switch (i % 3)
+            {
+            case 0:
+                traceFile.addTrace(time, NSFTraceTags::StateEnteredTag(), NSFTraceTags::StateMachineTag(), "TestStateMachine",
+                    NSFTraceTags::StateTag(), "State" + toString(i % 10), emptyString(), emptyString());
+                break;
+
+            case 1:
+                traceFile.addTrace(time, NSFTraceTags::EventQueuedTag(), NSFTraceTags::NameTag(), "Event" + toString(i % 7),
+                    NSFTraceTags::SourceTag(), "TestSource", NSFTraceTags::DestinationTag(), "TestStateMachine");
+                break;
+
+            default:
+                traceFile.addTrace(time, NSFTraceTags::InformationalTag(), NSFTraceTags::ValueTag(), toString(i),
+                    NSFTraceTags::MessageTag(), SpecialText(), emptyString(), emptyString());
+                break;
+            }
+        }
+
+        const NSFString BinaryFileName = "TraceBinaryFileTest.nsftrace";
+        const NSFString UncompressedFileName = "TraceBinaryFileTest_Uncompressed.nsftrace";
+        const NSFString XMLFileName = "TraceBinaryFileTest.xml";
+        const NSFString DecodedFileName = "TraceBinaryFileTest_Decoded.xml";
+        const NSFString CSVFileName = "TraceBinaryFileTest.csv";
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+        traceFile.save(BinaryFileName);
+        NSFTime binarySaveTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() - startTime;
+
+        traceFile.saveXML(XMLFileName);
+
+        traceFile.setCompressionEnabled(false);
+        traceFile.save(UncompressedFileName);
+
+        // Decode both binary files and compare them with the xml saved from the original traces
+        NSFTraceBinaryFile decodedFile;
+        decodedFile.load(BinaryFileName);
+
+        if (decodedFile.getTraceCount() != (UInt32)numberOfTraces)
+        {
+            errorMessage = "Decoded " + toString(decodedFile.getTraceCount()) + " of " + toString(numberOfTraces) + " traces";
+            return false;
+        }
+
+        decodedFile.saveXML(DecodedFileName);
+
+        if (readFile(DecodedFileName) != readFile(XMLFileName))
+        {
+            errorMessage = "Decoded xml differs from the original traces";
+            return false;
+        }
+
+        decodedFile.load(UncompressedFileName);
+        decodedFile.saveXML(DecodedFileName);
+
+        if (readFile(DecodedFileName) != readFile(XMLFileName))
+        {
+            errorMessage = "Decoded uncompressed xml differs from the original traces";
+            return false;
+        }
+
+        NSFXMLDocument xmlLog;
+
+        if (!xmlLog.loadFile(DecodedFileName) || !xmlLog.jumpToChildElementFront())
+        {
+            errorMessage = "Unable to load " + DecodedFileName;
+            return false;
+        }
+
+        // The third trace holds the special characters
+        NSFString messageText;
+
+        if (!xmlLog.jumpToNextElement() || !xmlLog.jumpToNextElement() || !xmlLog.jumpToChildElement(NSFTraceTags::InformationalTag()) ||
+            !xmlLog.getChildElementText(NSFTraceTags::MessageTag(), messageText) || (messageText != SpecialText()))
+        {
+            errorMessage = "Decoded xml does not hold the special characters of the original trace";
+            return false;
+        }
+
+        decodedFile.saveCSV(CSVFileName);
+
+        NSFString csvText = readFile(CSVFileName);
+
+        if ((csvText.find("Time,Type,Tag1,Data1,Tag2,Data2,Tag3,Data3\n") != 0) ||
+            (csvText.find("1000006,Informational,Value,2,Message,\"<a & \"\"b\"\", c>\"\n") == NSFString::npos))
+        {
+            errorMessage = "Comma separated values do not hold the original traces";
+            return false;
+        }
+
+        std::streamoff binarySize = getFileSize(BinaryFileName);
+        std::streamoff uncompressedSize = getFileSize(UncompressedFileName);
+        std::streamoff xmlSize = getFileSize(XMLFileName);
+
+        if ((binarySize >= uncompressedSize) || ((binarySize * 20) > xmlSize))
+        {
+            errorMessage = "Binary file of " + toString(binarySize) + " bytes is not compact compared with xml of " + toString(xmlSize) + " bytes";
+            return false;
+        }
+
+        if (!checkTraceLogSave(errorMessage))
+        {
+            return false;
+        }
+
+        // Add results to name for test visibility
+        name += "; Binary = " + toString(binarySize) + " bytes, Uncompressed = " + toString(uncompressedSize) + " bytes, XML = " + toString(xmlSize) +
+            " bytes, Save Time = " + toString(convertTime(binarySaveTime, TimeUnitsPerSecond, MilliSecondsPerSecond)) + " mS";
+
+        return true;
+    }
+
+    // Private
+
+    bool TraceBinaryFileTest::checkTraceLogSave(NSFString& errorMessage)
+    {
+        const NSFString FileName = "TraceBinaryFileTestLog.nsftrace";
+        const int TraceCount = 100;
+
+        remove(FileName.c_str());
+
+        NSFTraceLog* traceLog = new NSFTraceLog("TraceBinaryFileTestLog");
+        traceLog->setMaxTraces(2 * TraceCount);
+        traceLog->setEnabled(true);
+
+        for (int i = 0; i < TraceCount; ++i)
+        {
+            traceLog->addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::ValueTag(), toString(i), NSFTraceTags::MessageTag(), SpecialText());
+        }
+
+        traceLog->saveLog(FileName, BinaryTraceFileFormat);
+
+        // The file may be incomplete while the trace log's thread saves it
+        NSFTraceBinaryFile traceFile;
+        bool loaded = false;
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (10 * TimeUnitsPerSecond);
+
+        while (!loaded && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            try
+            {
+                traceFile.load(FileName);
+                loaded = true;
+            }
+            catch (const std::exception&)
+            {
+                NSFOSThread::sleep(1);
+            }
+        }
+
+        delete traceLog;
+
+        // The trace log adds a save trace to the traces added here
+        if (!loaded || (traceFile.getTraceCount() != (UInt32)(TraceCount + 1)))
+        {
+            errorMessage = "Trace log was not saved in binary format";
+            return false;
+        }
+
+        return true;
+    }
+
+    std::streamoff TraceBinaryFileTest::getFileSize(const NSFString& fileName)
+    {
+        std::ifstream file(fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+        file.seekg(0, std::ios_base::end);
+
+        return file.tellg();
+    }
+
+    NSFString TraceBinaryFileTest::readFile(const NSFString& fileName)
+    {
+        std::ifstream file(fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+        std::ostringstream text;
+        text << file.rdbuf();
+
+        return text.str();
+    }
+}
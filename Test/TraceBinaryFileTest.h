@@ -0,0 +1,63 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TRACE_BINARY_FILE_TEST_H
+#define TRACE_BINARY_FILE_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Save traces in the binary trace file format, then verify that they decode to the same xml as the original traces,
+    /// and that the binary file is much smaller than the xml file.
+    /// </summary>
+    class TraceBinaryFileTest : public ITestInterface
+    {
+    public:
+
+        TraceBinaryFileTest(const NSFString& name, int numberOfTraces);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfTraces;
+
+        bool checkTraceLogSave(NSFString& errorMessage);
+
+        static std::streamoff getFileSize(const NSFString& fileName);
+
+        static NSFString readFile(const NSFString& fileName);
+
+        static const NSFString& SpecialText() { static NSFString string("<a & \"b\", c>"); return string; };
+    };
+}
+
+#endif // TRACE_BINARY_FILE_TEST_H
@@ -0,0 +1,306 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TraceBufferTest.h"
+
+#include <map>
+#include <stdlib.h>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    const UInt32 TraceBufferTest::MaxTraces;
+    const int TraceBufferTest::NumberOfValues;
+
+    TraceBufferTest::TraceBufferTest(const NSFString& name, int numberOfThreads, int numberOfTraces)
+        : name(name.c_str()), numberOfThreads(numberOfThreads), numberOfTraces(numberOfTraces), traceLog(NULL), workerMutex(NSFOSMutex::create()),
+        workersStarted(0), workersCompleted(0)
+    {
+    }
+
+    TraceBufferTest::~TraceBufferTest()
+    {
+        delete workerMutex;
+    }
+
+    bool TraceBufferTest::runTest(NSFString& errorMessage)
+    {
+        const NSFString FileName = "TraceBufferTest.xml";
+
+        traceLog = new NSFTraceLog("TraceBufferTestLog");
+        traceLog->setMaxTraces(MaxTraces);
+        traceLog->setEnabled(true);
+
+        // Convert values ahead of time, so that only tracing is measured
+        values.clear();
+        for (int i = 0; i < NumberOfValues; ++i)
+        {
+            values.push_back(toString(i));
+        }
+
+        std::vector<NSFOSThread*> workerThreads;
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads.push_back(NSFOSThread::create("TraceBufferTestWorker", NSFAction(this, &TraceBufferTest::workerLoop), NSFOSThread::getMediumPriority()));
+        }
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            workerThreads[i]->startThread();
+        }
+
+        NSFTime timeout = startTime + (60 * TimeUnitsPerSecond);
+        bool completed = false;
+
+        while (!completed && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            NSFOSThread::sleep(1);
+
+            LOCK(workerMutex)
+            {
+                completed = (workersCompleted == numberOfThreads);
+            }
+            ENDLOCK;
+        }
+
+        NSFTime addEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        if (!completed)
+        {
+            // Worker threads still reference the trace log, so it is intentionally leaked
+            errorMessage = "Tracing workers did not complete";
+            return false;
+        }
+
+        traceLog->saveLog(FileName);
+
+        while (!traceLog->allTracesLogged())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        NSFTime saveEndTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfThreads; ++i)
+        {
+            delete workerThreads[i];
+        }
+
+        delete traceLog;
+        traceLog = NULL;
+
+        if (!checkSavedLog(FileName, errorMessage))
+        {
+            return false;
+        }
+
+        if (!testLongData(errorMessage))
+        {
+            return false;
+        }
+
+        NSFTime addTime = convertTime(addEndTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / ((NSFTime)numberOfThreads * numberOfTraces);
+        NSFTime saveTime = convertTime(saveEndTime - addEndTime, TimeUnitsPerSecond, MicroSecondsPerSecond);
+
+        // Add results to name for test visibility
+        name += "; Threads = " + toString(numberOfThreads) + ", Add Time = " + toString(addTime) + " nS, Save " + toString(MaxTraces) + " Traces = " + toString(saveTime) + " uS";
+
+        return true;
+    }
+
+    // Private
+
+    bool TraceBufferTest::checkSavedLog(const NSFString& fileName, NSFString& errorMessage)
+    {
+        NSFXMLDocument xmlLog;
+
+        if (!xmlLog.loadFile(fileName))
+        {
+            errorMessage = "Unable to load saved trace log";
+            return false;
+        }
+
+        UInt32 numberOfTraces;
+        xmlLog.getNumberOfChildElements(numberOfTraces);
+
+        if (numberOfTraces != MaxTraces)
+        {
+            errorMessage = "Saved trace log has " + toString(numberOfTraces) + " traces instead of " + toString(MaxTraces);
+            return false;
+        }
+
+        NSFTime lastTime = 0;
+        std::map<NSFString, int> lastValues;
+
+        xmlLog.jumpToChildElementFront();
+
+        do
+        {
+            NSFString timeText;
+            xmlLog.getChildElementText("Time", timeText);
+            NSFTime time = (NSFTime)atoll(timeText.c_str());
+
+            if (time < lastTime)
+            {
+                errorMessage = "Saved traces are not in time order";
+                return false;
+            }
+            lastTime = time;
+
+            // Traces added by the workers must follow each other in the order each worker added them
+            if (xmlLog.jumpToChildElement(NSFTraceTags::InformationalTag()))
+            {
+                NSFString source;
+                NSFString valueText;
+
+                if (xmlLog.getChildElementText(NSFTraceTags::SourceTag(), source) && xmlLog.getChildElementText(NSFTraceTags::ValueTag(), valueText))
+                {
+                    int value = atoi(valueText.c_str());
+
+                    if ((lastValues.find(source) != lastValues.end()) && (value != ((lastValues[source] + 1) % NumberOfValues)))
+                    {
+                        errorMessage = "Saved traces of " + source + " are out of order";
+                        return false;
+                    }
+
+                    lastValues[source] = value;
+                }
+
+                xmlLog.jumpToParentElement();
+            }
+        }
+        while (xmlLog.jumpToNextElement());
+
+        return true;
+    }
+
+    bool TraceBufferTest::testLongData(NSFString& errorMessage)
+    {
+        const NSFString FileName = "TraceBufferTestLongData.xml";
+
+        // More distinct long data strings than the trace string table holds, which must still be saved intact
+        const int NumberOfLongTraces = 10000;
+        const NSFString LongDataPrefix = "TraceBufferTestLongData";
+
+        NSFTraceLog* longDataLog = new NSFTraceLog("TraceBufferTestLongDataLog");
+        longDataLog->setMaxTraces(MaxTraces);
+        longDataLog->setEnabled(true);
+
+        for (int i = 0; i < NumberOfLongTraces; ++i)
+        {
+            longDataLog->addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::ValueTag(), LongDataPrefix + toString(i));
+        }
+
+        // Data longer than the maximum is truncated and marked
+        NSFString tooLongData(NSFTraceRecord::MaxTextDataLength + 1, 'x');
+        longDataLog->addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::ValueTag(), tooLongData);
+
+        longDataLog->saveLog(FileName);
+
+        while (!longDataLog->allTracesLogged())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        delete longDataLog;
+
+        NSFXMLDocument xmlLog;
+
+        if (!xmlLog.loadFile(FileName))
+        {
+            errorMessage = "Unable to load saved long data trace log";
+            return false;
+        }
+
+        std::vector<NSFString> data;
+
+        xmlLog.jumpToChildElementFront();
+
+        do
+        {
+            NSFString value;
+
+            if (xmlLog.jumpToChildElement(NSFTraceTags::InformationalTag()))
+            {
+                if (xmlLog.getChildElementText(NSFTraceTags::ValueTag(), value))
+                {
+                    data.push_back(value);
+                }
+
+                xmlLog.jumpToParentElement();
+            }
+        }
+        while (xmlLog.jumpToNextElement());
+
+        if (data.empty() || (data.back() != tooLongData.substr(0, NSFTraceRecord::MaxTextDataLength) + "..."))
+        {
+            errorMessage = "Too long trace data was not truncated";
+            return false;
+        }
+
+        data.pop_back();
+
+        if (data.empty())
+        {
+            errorMessage = "Long trace data was not saved";
+            return false;
+        }
+
+        // The traces held are the latest ones added, each with its own data
+        for (std::vector<NSFString>::size_type i = 0; i < data.size(); ++i)
+        {
+            if (data[i] != LongDataPrefix + toString(NumberOfLongTraces - (int)(data.size() - i)))
+            {
+                errorMessage = "Long trace data was not saved intact";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void TraceBufferTest::workerLoop(const NSFContext&)
+    {
+        NSFString source;
+
+        LOCK(workerMutex)
+        {
+            source = "TraceBufferTestWorker" + toString(workersStarted++);
+        }
+        ENDLOCK;
+
+        for (int i = 0; i < numberOfTraces; ++i)
+        {
+            traceLog->addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::SourceTag(), source, NSFTraceTags::ValueTag(), values[i % NumberOfValues]);
+        }
+
+        LOCK(workerMutex)
+        {
+            ++workersCompleted;
+        }
+        ENDLOCK;
+    }
+}
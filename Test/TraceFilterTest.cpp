@@ -0,0 +1,258 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TraceFilterTest.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    TraceFilterTest::TraceFilterTest(const NSFString& name, int numberOfTransitions)
+        : NSFStateMachine("TraceFilterTest", new NSFEventThread("TraceFilterTest")), testName(name.c_str()),
+        numberOfTransitions(numberOfTransitions), transitionCount(0),
+        // Events
+        toggleEvent("TraceFilterTestToggle", this),
+        hiddenEvent("TraceFilterTestHidden", this),
+        // States
+        initialState("Initial", this),
+        stateA("StateA", this, NSFAction(this, &TraceFilterTest::countTransition), NULL),
+        stateB("StateB", this, NSFAction(this, &TraceFilterTest::countTransition), NULL),
+        // Transitions
+        hiddenReaction("HiddenReaction", this, &hiddenEvent, NULL, NULL),
+        initialToStateATransition("InitialToStateA", &initialState, &stateA, NULL, NULL, NULL),
+        stateAToStateBTransition("StateAToStateB", &stateA, &stateB, &toggleEvent, NULL, NULL),
+        stateBToStateATransition("StateBToStateA", &stateB, &stateA, &toggleEvent, NULL, NULL)
+    {
+        // The timing loops queue many toggle events back to back
+        setConsecutiveLoopDetectionEnabled(false);
+    }
+
+    TraceFilterTest::~TraceFilterTest()
+    {
+        terminate(true);
+        delete getEventThread();
+    }
+
+    bool TraceFilterTest::runTest(NSFString& errorMessage)
+    {
+        NSFTraceLog& traceLog = NSFTraceLog::getPrimaryTraceLog();
+        NSFTraceFilter& filter = traceLog.getFilter();
+
+        startStateMachine();
+
+        if (!testHarness.doesEventResultInState(NULL, &stateA))
+        {
+            errorMessage = "State machine did not start";
+            return false;
+        }
+
+        // Event filter
+        filter.setEventEnabled(hiddenEvent.getName(), false);
+        hiddenEvent.queueEvent();
+
+        if (!toggle())
+        {
+            errorMessage = "State machine did not transition with the event filter set";
+            return false;
+        }
+
+        filter.reset();
+        addMarker("TraceFilterTestMarker1");
+
+        // State machine filter
+        filter.setStateMachinesEnabledByDefault(false);
+        filter.setStateMachineEnabled("TraceFilterTestOther", true);
+
+        if (!toggle())
+        {
+            errorMessage = "State machine did not transition with the state machine filter set";
+            return false;
+        }
+
+        filter.reset();
+        addMarker("TraceFilterTestMarker2");
+
+        // Category filter
+        filter.setCategoryEnabled(StateEnteredTraceCategory, false);
+
+        if (!toggle())
+        {
+            errorMessage = "State machine did not transition with the category filter set";
+            return false;
+        }
+
+        filter.reset();
+        addMarker("TraceFilterTestMarker3");
+
+        if (!checkSavedTraces(errorMessage))
+        {
+            return false;
+        }
+
+        NSFTime tracedTime = measureTransitionTime();
+
+        filter.setCategories(ErrorTraceCategory | ExceptionTraceCategory);
+        NSFTime filteredTime = measureTransitionTime();
+        filter.reset();
+
+        traceLog.setEnabled(false);
+        NSFTime disabledTime = measureTransitionTime();
+        traceLog.setEnabled(true);
+
+        stopStateMachine();
+
+        // Add results to name for test visibility
+        testName += "; Transition Time Traced = " + toString(tracedTime) + " nS, Filtered = " + toString(filteredTime) +
+            " nS, Disabled = " + toString(disabledTime) + " nS, Trace Level = " + toString(NSF_TRACE_LEVEL);
+
+        return true;
+    }
+
+    // Private
+
+    void TraceFilterTest::addMarker(const NSFString& marker)
+    {
+        // Traces from different threads with the same time may be saved in either order, so the marker is kept apart in time
+        NSFOSThread::sleep(5);
+        NSFTraceLog::getPrimaryTraceLog().addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::NameTag(), marker);
+        NSFOSThread::sleep(5);
+    }
+
+    bool TraceFilterTest::checkSavedTraces(NSFString& errorMessage)
+    {
+        const NSFString FileName = "TraceFilterTest.nsftrace";
+        const NSFString CSVFileName = "TraceFilterTest.csv";
+
+        remove(FileName.c_str());
+        NSFTraceLog::getPrimaryTraceLog().saveLog(FileName, BinaryTraceFileFormat);
+
+        // The file may be incomplete while the trace log's thread saves it
+        NSFTraceBinaryFile traceFile;
+        bool loaded = false;
+        NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (10 * TimeUnitsPerSecond);
+
+        while (!loaded && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+        {
+            try
+            {
+                traceFile.load(FileName);
+                loaded = true;
+            }
+            catch (const std::exception&)
+            {
+                NSFOSThread::sleep(1);
+            }
+        }
+
+        if (!loaded)
+        {
+            errorMessage = "Unable to load saved trace log";
+            return false;
+        }
+
+        traceFile.saveCSV(CSVFileName);
+
+        std::ifstream file(CSVFileName.c_str(), std::ios_base::in | std::ios_base::binary);
+        std::ostringstream textStream;
+        textStream << file.rdbuf();
+        NSFString text = textStream.str();
+
+        NSFString::size_type marker1 = text.find("TraceFilterTestMarker1");
+        NSFString::size_type marker2 = text.find("TraceFilterTestMarker2");
+        NSFString::size_type marker3 = text.find("TraceFilterTestMarker3");
+
+        if ((marker1 == NSFString::npos) || (marker2 == NSFString::npos) || (marker3 == NSFString::npos))
+        {
+            errorMessage = "Saved trace log is missing markers";
+            return false;
+        }
+
+        NSFString eventFilterTraces = text.substr(0, marker1);
+        NSFString stateMachineFilterTraces = text.substr(marker1, marker2 - marker1);
+        NSFString categoryFilterTraces = text.substr(marker2, marker3 - marker2);
+
+        const NSFString StateEnteredText = "StateEntered,StateMachine,TraceFilterTest,";
+        const NSFString ToggleQueuedText = "EventQueued,Name,TraceFilterTestToggle,";
+
+        if ((eventFilterTraces.find("EventQueued,Name,TraceFilterTestHidden,") != NSFString::npos) ||
+            (eventFilterTraces.find(ToggleQueuedText) == NSFString::npos) || (eventFilterTraces.find(StateEnteredText) == NSFString::npos))
+        {
+            errorMessage = "Event filter did not remove only the filtered event";
+            return false;
+        }
+
+        if ((stateMachineFilterTraces.find(StateEnteredText) != NSFString::npos) || (stateMachineFilterTraces.find(ToggleQueuedText) != NSFString::npos))
+        {
+            errorMessage = "State machine filter did not remove the state machine's traces";
+            return false;
+        }
+
+        if ((categoryFilterTraces.find(StateEnteredText) != NSFString::npos) || (categoryFilterTraces.find(ToggleQueuedText) == NSFString::npos))
+        {
+            errorMessage = "Category filter did not remove only the state entered traces";
+            return false;
+        }
+
+        return true;
+    }
+
+    void TraceFilterTest::countTransition(const NSFStateMachineContext&)
+    {
+        ++transitionCount;
+    }
+
+    NSFTime TraceFilterTest::measureTransitionTime()
+    {
+        int endCount = transitionCount + numberOfTransitions;
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfTransitions; ++i)
+        {
+            toggleEvent.queueEvent();
+        }
+
+        while (transitionCount < endCount)
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        return convertTime(endTime - startTime, TimeUnitsPerSecond, NanoSecondsPerSecond) / numberOfTransitions;
+    }
+
+    bool TraceFilterTest::toggle()
+    {
+        return testHarness.doesEventResultInState(&toggleEvent, stateA.isActive() ? (NSFState*)&stateB : (NSFState*)&stateA);
+    }
+}
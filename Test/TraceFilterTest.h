@@ -0,0 +1,84 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TRACE_FILTER_TEST_H
+#define TRACE_FILTER_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Filter framework traces by event name, state machine and category, verify the traces saved,
+    /// then measure the time per transition with tracing enabled, filtered and disabled.
+    /// </summary>
+    class TraceFilterTest : public NSFStateMachine, public ITestInterface
+    {
+    public:
+
+        TraceFilterTest(const NSFString& name, int numberOfTransitions);
+
+        ~TraceFilterTest();
+
+        const NSFString& getName() { return testName; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString testName;
+        int numberOfTransitions;
+        volatile int transitionCount;
+        TestHarness testHarness;
+
+        // Events
+        NSFEvent toggleEvent;
+        NSFEvent hiddenEvent;
+
+        // States
+        NSFInitialState initialState;
+        NSFCompositeState stateA;
+        NSFCompositeState stateB;
+
+        // Transitions
+        NSFInternalTransition hiddenReaction;
+        NSFExternalTransition initialToStateATransition;
+        NSFExternalTransition stateAToStateBTransition;
+        NSFExternalTransition stateBToStateATransition;
+
+        void addMarker(const NSFString& marker);
+
+        bool checkSavedTraces(NSFString& errorMessage);
+
+        void countTransition(const NSFStateMachineContext& context);
+
+        NSFTime measureTransitionTime();
+
+        bool toggle();
+    };
+}
+
+#endif // TRACE_FILTER_TEST_H
@@ -0,0 +1,186 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TraceStreamTest.h"
+
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    const int TraceStreamTest::BatchSize;
+    const UInt32 TraceStreamTest::MaxFileSize;
+
+    TraceStreamTest::TraceStreamTest(const NSFString& name, int numberOfTraces)
+        : name(name.c_str()), numberOfTraces(numberOfTraces)
+    {
+    }
+
+    bool TraceStreamTest::runTest(NSFString& errorMessage)
+    {
+        // Remove files from earlier runs, so that numbering starts from the first file
+        for (UInt32 fileNumber = 1; remove(getFileName(fileNumber).c_str()) == 0; ++fileNumber)
+        {
+        }
+
+        NSFTraceLog* traceLog = new NSFTraceLog("TraceStreamTestLog");
+        traceLog->setMaxTraces(2 * BatchSize);
+        traceLog->setEnabled(true);
+
+        NSFTraceFileSink* sink = new NSFTraceFileSink("TraceStreamTest");
+        sink->setBufferSize(8 * 1024);
+        sink->setFlushInterval(10 * TimeUnitsPerMilliSecond);
+        sink->setMaxFileSize(MaxFileSize);
+
+        traceLog->startStreaming(sink);
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int i = 0; i < numberOfTraces; ++i)
+        {
+            traceLog->addTrace(NSFTraceTags::InformationalTag(), NSFTraceTags::ValueTag(), toString(i), NSFTraceTags::MessageTag(), SpecialText());
+
+            // Wait for each batch to be streamed, so that no traces are overwritten before they are written
+            if ((((i + 1) % BatchSize) == 0) || ((i + 1) == numberOfTraces))
+            {
+                NSFTime timeout = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() + (10 * TimeUnitsPerSecond);
+
+                while ((sink->getTraceCount() < (UInt32)(i + 1)) && (NSFTimerThread::getPrimaryTimerThread().getCurrentTime() < timeout))
+                {
+                    NSFOSThread::sleep(1);
+                }
+            }
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        UInt32 traceCount = sink->getTraceCount();
+        UInt32 droppedTraceCount = sink->getDroppedTraceCount();
+        UInt32 fileCount = sink->getFileCount();
+
+        // Deleting the log stops streaming and closes the last file
+        delete traceLog;
+
+        if ((traceCount != (UInt32)numberOfTraces) || (droppedTraceCount != 0))
+        {
+            errorMessage = "Streamed " + toString(traceCount) + " of " + toString(numberOfTraces) + " traces, with " + toString(droppedTraceCount) + " dropped";
+            return false;
+        }
+
+        if (fileCount < 2)
+        {
+            errorMessage = "Trace files were not rotated";
+            return false;
+        }
+
+        if (!checkStreamedFiles(fileCount, errorMessage))
+        {
+            return false;
+        }
+
+        NSFTime streamTime = convertTime(endTime - startTime, TimeUnitsPerSecond, MilliSecondsPerSecond);
+
+        // Add results to name for test visibility
+        name += "; Traces = " + toString(numberOfTraces) + ", Files = " + toString(fileCount) + ", Stream Time = " + toString(streamTime) + " mS";
+
+        return true;
+    }
+
+    // Private
+
+    bool TraceStreamTest::checkStreamedFiles(UInt32 fileCount, NSFString& errorMessage)
+    {
+        int nextValue = 0;
+
+        for (UInt32 fileNumber = 1; fileNumber <= fileCount; ++fileNumber)
+        {
+            NSFString fileName = getFileName(fileNumber);
+
+            std::ifstream file(fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+            file.seekg(0, std::ios_base::end);
+            std::streamoff fileSize = file.tellg();
+            file.close();
+
+            if (fileSize > (std::streamoff)MaxFileSize)
+            {
+                errorMessage = fileName + " exceeds the maximum file size";
+                return false;
+            }
+
+            NSFXMLDocument xmlLog;
+
+            if (!xmlLog.loadFile(fileName))
+            {
+                errorMessage = "Unable to load " + fileName;
+                return false;
+            }
+
+            xmlLog.jumpToChildElementFront();
+
+            do
+            {
+                NSFString valueText;
+
+                if (!xmlLog.jumpToChildElement(NSFTraceTags::InformationalTag()) || !xmlLog.getChildElementText(NSFTraceTags::ValueTag(), valueText))
+                {
+                    errorMessage = fileName + " has an unexpected trace";
+                    return false;
+                }
+
+                NSFString messageText;
+
+                if (!xmlLog.getChildElementText(NSFTraceTags::MessageTag(), messageText) || (messageText != SpecialText()))
+                {
+                    errorMessage = fileName + " has a trace whose special characters were not escaped";
+                    return false;
+                }
+
+                if (atoi(valueText.c_str()) != nextValue)
+                {
+                    errorMessage = fileName + " has trace " + valueText + " instead of " + toString(nextValue);
+                    return false;
+                }
+
+                ++nextValue;
+                xmlLog.jumpToParentElement();
+            }
+            while (xmlLog.jumpToNextElement());
+        }
+
+        if (nextValue != numberOfTraces)
+        {
+            errorMessage = "Trace files hold " + toString(nextValue) + " of " + toString(numberOfTraces) + " traces";
+            return false;
+        }
+
+        return true;
+    }
+
+    NSFString TraceStreamTest::getFileName(UInt32 fileNumber)
+    {
+        return "TraceStreamTest_" + toString(fileNumber) + ".xml";
+    }
+}
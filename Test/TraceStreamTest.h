@@ -0,0 +1,63 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef TRACE_STREAM_TEST_H
+#define TRACE_STREAM_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Stream traces to a series of size limited files, then verify that every trace was written, in order, across the files.
+    /// </summary>
+    class TraceStreamTest : public ITestInterface
+    {
+    public:
+
+        TraceStreamTest(const NSFString& name, int numberOfTraces);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const int BatchSize = 1000;
+        static const UInt32 MaxFileSize = 32 * 1024;
+
+        NSFString name;
+        int numberOfTraces;
+
+        bool checkStreamedFiles(UInt32 fileCount, NSFString& errorMessage);
+
+        static NSFString getFileName(UInt32 fileNumber);
+
+        static const NSFString& SpecialText() { static NSFString string("<a & \"b\">"); return string; };
+    };
+}
+
+#endif // TRACE_STREAM_TEST_H
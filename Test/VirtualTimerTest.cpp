@@ -0,0 +1,229 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "VirtualTimerTest.h"
+
+#include "NSFVirtualTimer.h"
+
+#include <vector>
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    // VirtualTimerTestAction
+
+    VirtualTimerTestAction::VirtualTimerTestAction(const NSFString& name, NSFTimerThread* timerThread, NSFTime* lastTime, int* orderErrors)
+        : NSFTimerAction(name), timerThread(timerThread), lastTime(lastTime), orderErrors(orderErrors), executionCount(0),
+        firstExecutionTime(0), lastExecutionTime(0), maxJitter(0)
+    {
+    }
+
+    void VirtualTimerTestAction::execute()
+    {
+        NSFTime currentTime = timerThread->getCurrentTime();
+
+        // Actions execute on the timer thread, so the shared log needs no lock
+        if (currentTime < *lastTime)
+        {
+            ++(*orderErrors);
+        }
+        *lastTime = currentTime;
+
+        if (executionCount == 0)
+        {
+            firstExecutionTime = currentTime;
+        }
+        else
+        {
+            // Record jitter as the deviation from the repeat time
+            NSFTime deltaTime = currentTime - lastExecutionTime;
+            NSFTime jitter = (deltaTime > getRepeatTime()) ? (deltaTime - getRepeatTime()) : (getRepeatTime() - deltaTime);
+            if (jitter > maxJitter) { maxJitter = jitter; }
+        }
+
+        lastExecutionTime = currentTime;
+        ++executionCount;
+    }
+
+    // VirtualTimerTest
+
+    const int VirtualTimerTest::NumberOfOneShotActions;
+    const NSFTime VirtualTimerTest::RunTime;
+    const NSFTime VirtualTimerTest::Period;
+
+    VirtualTimerTest::VirtualTimerTest(const NSFString& name)
+        : name(name.c_str())
+    {
+    }
+
+    bool VirtualTimerTest::runTest(NSFString& errorMessage)
+    {
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        if (!testQueueType(SortedListTimerQueue, errorMessage) ||
+            !testQueueType(TimingWheelTimerQueue, errorMessage) ||
+            !testQueueType(IndexedHeapTimerQueue, errorMessage) ||
+            !testSetTimer(errorMessage))
+        {
+            return false;
+        }
+
+        NSFTime elapsedTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime() - startTime;
+
+        // Add results to name for test visibility
+        name += "; " + toString(convertTime(RunTime, TimeUnitsPerSecond, 1)) + " S Run For Each Queue Type In "
+            + toString(convertTime(elapsedTime, TimeUnitsPerSecond, MilliSecondsPerSecond)) + " mS";
+
+        return true;
+    }
+
+    // Private
+
+    bool VirtualTimerTest::testQueueType(NSFTimerQueueType queueType, NSFString& errorMessage)
+    {
+        NSFVirtualTimer* virtualTimer = new NSFVirtualTimer("VirtualTimerTestTimer", 0);
+        NSFTimerThread* timerThread = new NSFTimerThread("VirtualTimerTestThread", queueType, virtualTimer);
+
+        NSFTime lastTime = 0;
+        int orderErrors = 0;
+
+        VirtualTimerTestAction periodicAction("PeriodicAction", timerThread, &lastTime, &orderErrors);
+        timerThread->scheduleAction(&periodicAction, Period, Period);
+
+        // Spread the one-shot actions over the run time in a scrambled order, some sharing execution times with the periodic action
+        std::vector<VirtualTimerTestAction*> oneShotActions;
+        std::vector<NSFTime> delayTimes;
+        for (int i = 0; i < NumberOfOneShotActions; ++i)
+        {
+            NSFTime delayTime = ((((NSFTime)i * 7919) % NumberOfOneShotActions) + 1) * (RunTime / NumberOfOneShotActions);
+            if ((i % 3) == 0)
+            {
+                delayTime -= TimeUnitsPerMilliSecond;
+            }
+
+            VirtualTimerTestAction* oneShotAction = new VirtualTimerTestAction("OneShotAction", timerThread, &lastTime, &orderErrors);
+            timerThread->scheduleAction(oneShotAction, delayTime, 0);
+
+            oneShotActions.push_back(oneShotAction);
+            delayTimes.push_back(delayTime);
+        }
+
+        bool result = true;
+
+        try
+        {
+            virtualTimer->advanceTime(RunTime);
+        }
+        catch(const std::exception& exception)
+        {
+            errorMessage = exception.what();
+            result = false;
+        }
+
+        // Stop the periodic action before checking, as the timer thread is idle once the time is advanced
+        timerThread->unscheduleAction(&periodicAction);
+
+        if (result && (virtualTimer->getCurrentTime() != RunTime))
+        {
+            errorMessage = "Virtual time did not advance to the end of the run";
+            result = false;
+        }
+
+        if (result && ((periodicAction.getExecutionCount() != (int)(RunTime / Period)) || (periodicAction.getMaxJitter() != 0)))
+        {
+            errorMessage = "Periodic action executed " + toString(periodicAction.getExecutionCount()) + " times with "
+                + toString(periodicAction.getMaxJitter()) + " max jitter";
+            result = false;
+        }
+
+        for (int i = 0; result && (i < NumberOfOneShotActions); ++i)
+        {
+            if ((oneShotActions[i]->getExecutionCount() != 1) || (oneShotActions[i]->getFirstExecutionTime() != delayTimes[i]))
+            {
+                errorMessage = "One-shot action " + toString(i) + " did not execute exactly at its scheduled time";
+                result = false;
+            }
+        }
+
+        if (result && (orderErrors != 0))
+        {
+            errorMessage = toString(orderErrors) + " actions executed out of order";
+            result = false;
+        }
+
+        delete timerThread;
+
+        for (int i = 0; i < NumberOfOneShotActions; ++i)
+        {
+            delete oneShotActions[i];
+        }
+
+        return result;
+    }
+
+    bool VirtualTimerTest::testSetTimer(NSFString& errorMessage)
+    {
+        NSFTimerThread* timerThread = new NSFTimerThread("VirtualTimerTestThread");
+
+        NSFTime lastTime = 0;
+        int orderErrors = 0;
+
+        // An action scheduled in real time must keep its remaining delay when the timer is replaced
+        VirtualTimerTestAction oneShotAction("OneShotAction", timerThread, &lastTime, &orderErrors);
+        timerThread->scheduleAction(&oneShotAction, RunTime, 0);
+
+        NSFVirtualTimer* virtualTimer = new NSFVirtualTimer("VirtualTimerTestTimer", 0);
+        timerThread->setTimer(virtualTimer);
+
+        bool result = true;
+
+        try
+        {
+            virtualTimer->advanceTime(RunTime - TimeUnitsPerSecond);
+
+            if (oneShotAction.getExecutionCount() != 0)
+            {
+                errorMessage = "Action executed early after the timer was replaced";
+                result = false;
+            }
+
+            virtualTimer->advanceTime(TimeUnitsPerSecond);
+
+            if (result && (oneShotAction.getExecutionCount() != 1))
+            {
+                errorMessage = "Action did not execute after the timer was replaced";
+                result = false;
+            }
+        }
+        catch(const std::exception& exception)
+        {
+            errorMessage = exception.what();
+            result = false;
+        }
+
+        delete timerThread;
+
+        return result;
+    }
+}
@@ -0,0 +1,89 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef VIRTUAL_TIMER_TEST_H
+#define VIRTUAL_TIMER_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+using namespace NorthStateFramework;
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Timer action that records its execution times, and whether it executed before an action already executed by the timer thread.
+    /// </summary>
+    class VirtualTimerTestAction : public NSFTimerAction
+    {
+    public:
+
+        VirtualTimerTestAction(const NSFString& name, NSFTimerThread* timerThread, NSFTime* lastTime, int* orderErrors);
+
+        int getExecutionCount() const { return executionCount; }
+
+        NSFTime getFirstExecutionTime() const { return firstExecutionTime; }
+
+        NSFTime getMaxJitter() const { return maxJitter; }
+
+    private:
+
+        NSFTimerThread* timerThread;
+        NSFTime* lastTime;
+        int* orderErrors;
+        int executionCount;
+        NSFTime firstExecutionTime;
+        NSFTime lastExecutionTime;
+        NSFTime maxJitter;
+
+        void execute();
+    };
+
+    /// <summary>
+    /// Run an hour of periodic and one-shot timer actions under a virtual timer, and verify they execute in order at exactly their scheduled times.
+    /// </summary>
+    class VirtualTimerTest : public ITestInterface
+    {
+    public:
+
+        VirtualTimerTest(const NSFString& name);
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        static const int NumberOfOneShotActions = 1000;
+        static const NSFTime RunTime = (NSFTime)3600 * TimeUnitsPerSecond;
+        static const NSFTime Period = TimeUnitsPerSecond;
+
+        NSFString name;
+
+        bool testQueueType(NSFTimerQueueType queueType, NSFString& errorMessage);
+
+        bool testSetTimer(NSFString& errorMessage);
+    };
+}
+
+#endif // VIRTUAL_TIMER_TEST_H
@@ -0,0 +1,170 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "WideForkJoinTest.h"
+
+namespace NSFTest
+{
+#if (defined WIN32) || (defined WINCE)
+    // Using "this" in initializer as pointer to base type, disable warning as this is perfectly safe.
+#pragma warning( disable : 4355 )
+#endif
+
+    WideForkJoinTest::WideForkJoinTest(const NSFString& name, int numberOfRegions, int numberOfCycles)
+        : NSFStateMachine(name, new NSFEventThread(name)), name(name.c_str()), numberOfRegions(numberOfRegions), numberOfCycles(numberOfCycles), joinCount(0),
+        // Events
+        resetEvent("Reset", this),
+        // ForkJoins
+        wideForkJoin("WideForkJoin", this)
+    {
+        for (int i = 0; i < numberOfRegions; ++i)
+        {
+            NSFString index = toString(i);
+
+            joinEvents.push_back(new NSFEvent("Join" + index, this));
+
+            // States
+            regions.push_back(new NSFRegion("Region" + index, this));
+            initialStates.push_back(new NSFInitialState("Initial" + index, regions.back()));
+            waitingStates.push_back(new NSFCompositeState("Waiting" + index, regions.back(), NULL, NULL));
+            joinedStates.push_back(new NSFCompositeState("Joined" + index, regions.back(), NULL, NULL));
+
+            // Transitions
+            transitions.push_back(new NSFExternalTransition("Initial" + index + "ToWaiting" + index, initialStates.back(), waitingStates.back(), NULL, NULL, NULL));
+            transitions.push_back(new NSFExternalTransition("Waiting" + index + "ToWideForkJoin", waitingStates.back(), &wideForkJoin, joinEvents.back(), NULL, NULL));
+            transitions.push_back(new NSFExternalTransition("WideForkJoinToJoined" + index, &wideForkJoin, joinedStates.back(), NULL, NULL, NULL));
+            transitions.push_back(new NSFExternalTransition("Joined" + index + "ToWaiting" + index, joinedStates.back(), waitingStates.back(), &resetEvent, NULL, NULL));
+        }
+
+        joinedStates.front()->EntryActions += NSFAction(this, &WideForkJoinTest::countJoin);
+    }
+
+    WideForkJoinTest::~WideForkJoinTest()
+    {
+        terminate(true);
+        delete getEventThread();
+
+        for (int i = 0; i < numberOfRegions; ++i)
+        {
+            delete joinEvents[i];
+            delete initialStates[i];
+            delete waitingStates[i];
+            delete joinedStates[i];
+            delete regions[i];
+        }
+
+        for (std::vector<NSFExternalTransition*>::size_type i = 0; i < transitions.size(); ++i)
+        {
+            delete transitions[i];
+        }
+    }
+
+    bool WideForkJoinTest::runTest(NSFString& errorMessage)
+    {
+        // Join cycles are queued back to back, which would otherwise be detected as a consecutive loop
+        setConsecutiveLoopDetectionEnabled(false);
+        setLoggingEnabled(false);
+        startStateMachine();
+
+        // Test
+        //  state machine start up with many congruent regions
+        if (!testHarness.doesEventResultInState(NULL, waitingStates.back()))
+        {
+            errorMessage = "State Machine did not start properly with many congruent regions.";
+            stopStateMachine();
+            return false;
+        }
+
+        // Test
+        //  fork join is not exited until the last incoming transition completes
+        for (int i = 0; i < numberOfRegions - 1; ++i)
+        {
+            queueEvent(joinEvents[i]);
+        }
+
+        if (!testHarness.doesEventResultInState(NULL, &wideForkJoin, waitingStates.back()) || isInState(joinedStates.front()))
+        {
+            errorMessage = "State Machine did not wait in the fork join for the last region.";
+            stopStateMachine();
+            return false;
+        }
+
+        // Test
+        //  fork join exit to all regions
+        if (!testHarness.doesEventResultInState(joinEvents.back(), joinedStates.front(), joinedStates.back()))
+        {
+            errorMessage = "State Machine did not exit the fork join properly.";
+            stopStateMachine();
+            return false;
+        }
+
+        if (!testHarness.doesEventResultInState(&resetEvent, waitingStates.front(), waitingStates.back()))
+        {
+            errorMessage = "State Machine did not return to the waiting states.";
+            stopStateMachine();
+            return false;
+        }
+
+        // Measure join cycles, each with one event per region plus a reset
+        joinCount = 0;
+
+        NSFTime startTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        for (int cycle = 0; cycle < numberOfCycles; ++cycle)
+        {
+            for (int i = 0; i < numberOfRegions; ++i)
+            {
+                queueEvent(joinEvents[i]);
+            }
+
+            queueEvent(&resetEvent);
+        }
+
+        while (hasEvent())
+        {
+            NSFOSThread::sleep(1);
+        }
+
+        NSFTime endTime = NSFTimerThread::getPrimaryTimerThread().getCurrentTime();
+
+        stopStateMachine();
+
+        if (joinCount != numberOfCycles)
+        {
+            errorMessage = "State Machine did not complete every join cycle.";
+            return false;
+        }
+
+        NSFTime cycleTime = convertTime(endTime - startTime, TimeUnitsPerSecond, MicroSecondsPerSecond) / numberOfCycles;
+
+        // Add results to name for test visibility
+        name += "; Regions = " + toString(numberOfRegions) + ", Join Cycle Time = " + toString(cycleTime) + " uS";
+
+        return true;
+    }
+
+    void WideForkJoinTest::countJoin(const NSFStateMachineContext&)
+    {
+        ++joinCount;
+    }
+}
@@ -0,0 +1,79 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef WIDE_FORK_JOIN_TEST_H
+#define WIDE_FORK_JOIN_TEST_H
+
+#include "TestHarness.h"
+#include "TestInterface.h"
+
+#include <vector>
+
+namespace NSFTest
+{
+    /// <summary>
+    /// Test Fork Join synchronization across many regions, and measure join cycle time.
+    /// </summary>
+    /// <remarks>
+    /// Each region has its own event into the fork join, so the join is evaluated once per region while partially complete.
+    /// </remarks>
+    class WideForkJoinTest : public NSFStateMachine, public ITestInterface
+    {
+    public:
+        WideForkJoinTest(const NSFString& name, int numberOfRegions, int numberOfCycles);
+
+        ~WideForkJoinTest();
+
+        const NSFString& getName() { return name; }
+
+        bool runTest(NSFString& errorMessage);
+
+    private:
+
+        NSFString name;
+        int numberOfRegions;
+        int numberOfCycles;
+        int joinCount;
+        TestHarness testHarness;
+
+        // Events
+        std::vector<NSFEvent*> joinEvents;
+        NSFEvent resetEvent;
+
+        // Regions and states, one per region
+        std::vector<NSFRegion*> regions;
+        std::vector<NSFInitialState*> initialStates;
+        std::vector<NSFCompositeState*> waitingStates;
+        std::vector<NSFCompositeState*> joinedStates;
+
+        // ForkJoins
+        NSFForkJoin wideForkJoin;
+
+        // Transitions, one set per region
+        std::vector<NSFExternalTransition*> transitions;
+
+        void countJoin(const NSFStateMachineContext& context);
+    };
+}
+
+#endif // WIDE_FORK_JOIN_TEST_H
@@ -0,0 +1,116 @@
+// MIT License
+
+// North State Framework
+// Copyright (c) 2004-2022 North State Software, LLC
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include "NorthStateFramework.h"
+
+using namespace NorthStateFramework;
+
+// Converts a binary trace file, such as one saved by the exception handler, to the xml format of a saved trace log or to comma separated values.
+
+void printUsage()
+{
+    std::cerr << "Usage: TraceDecoder [-xml | -csv] <binary trace file> [<output file>]" << std::endl;
+    std::cerr << "The output is xml by default, and is written to the binary trace file name with an .xml or .csv extension if no output file is given." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    bool csvOutput = false;
+    NSFString inputFileName;
+    NSFString outputFileName;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        NSFString argument(argv[i]);
+
+        if (argument == "-xml")
+        {
+            csvOutput = false;
+        }
+        else if (argument == "-csv")
+        {
+            csvOutput = true;
+        }
+        else if (inputFileName.empty())
+        {
+            inputFileName = argument;
+        }
+        else if (outputFileName.empty())
+        {
+            outputFileName = argument;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (inputFileName.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    if (outputFileName.empty())
+    {
+        NSFString::size_type extensionPosition = inputFileName.find_last_of('.');
+        NSFString::size_type directoryPosition = inputFileName.find_last_of("/\\");
+
+        if ((extensionPosition != NSFString::npos) && ((directoryPosition == NSFString::npos) || (extensionPosition > directoryPosition)))
+        {
+            outputFileName = inputFileName.substr(0, extensionPosition);
+        }
+        else
+        {
+            outputFileName = inputFileName;
+        }
+
+        outputFileName += csvOutput ? ".csv" : ".xml";
+    }
+
+    try
+    {
+        NSFTraceBinaryFile traceFile;
+        traceFile.load(inputFileName);
+
+        if (csvOutput)
+        {
+            traceFile.saveCSV(outputFileName);
+        }
+        else
+        {
+            traceFile.saveXML(outputFileName);
+        }
+
+        std::cout << "Decoded " << traceFile.getTraceCount() << " traces to " << outputFileName << std::endl;
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}